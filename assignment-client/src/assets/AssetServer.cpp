@@ -12,6 +12,7 @@
 
 #include "AssetServer.h"
 
+#include <algorithm>
 #include <thread>
 #include <memory>
 
@@ -328,8 +329,10 @@ AssetServer::AssetServer(ReceivedMessage& message) :
 
 void AssetServer::aboutToFinish() {
 
-    // remove pending transfer tasks
+    // remove pending transfer tasks, and wait for the running ones that may still hold cached assets
     _transferTaskPool.clear();
+    _transferTaskPool.waitForDone();
+    _hotAssetCache.clear();
 
     // abort each of our still running bake tasks, remove pending bakes that were never put on the thread pool
     auto it = _pendingBakes.begin();
@@ -452,6 +455,13 @@ void AssetServer::completeSetup() {
         setFinished(true);
     }
 
+    // get the budget for the hot asset cache
+    static const QString HOT_CACHE_SIZE_OPTION = "hot_cache_size";
+    auto hotCacheSizeMB = assetServerObject[HOT_CACHE_SIZE_OPTION].toInt(HotAssetCache::DEFAULT_MAX_SIZE_MB);
+    static const qint64 BYTES_PER_MEGABYTE = 1024 * 1024;
+    _hotAssetCache.setMaxSize((qint64)std::max(0, hotCacheSizeMB) * BYTES_PER_MEGABYTE);
+    qCInfo(asset_server) << "Hot asset cache size set to" << _hotAssetCache.getMaxSize() / BYTES_PER_MEGABYTE << "MB";
+
     // get file size limit for an asset
     static const QString ASSETS_FILESIZE_LIMIT_OPTION = "assets_filesize_limit";
     auto assetsFilesizeLimitJSONValue = assetServerObject[ASSETS_FILESIZE_LIMIT_OPTION];
@@ -543,6 +553,7 @@ void AssetServer::cleanupUnmappedFiles() {
             }
             if (!matched) {
                 // remove the unmapped file
+                _hotAssetCache.remove(filename);
                 QFile removeableFile { fileInfo.absoluteFilePath() };
 
                 if (removeableFile.remove()) {
@@ -874,7 +885,7 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
     }
 
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, _hotAssetCache);
     _transferTaskPool.start(task);
 }
 
@@ -967,6 +978,8 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    serverStats["Hot Asset Cache"] = _hotAssetCache.getStats();
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
@@ -1180,6 +1193,7 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
         // we now have a set of hashes that are unmapped - we will delete those asset files
         for (auto& hash : hashesToCheckForDeletion) {
             // remove the unmapped file
+            _hotAssetCache.remove(hash);
             QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
 
             if (removeableFile.remove()) {
@@ -1548,6 +1562,7 @@ bool AssetServer::writeMetaFile(AssetUtils::AssetHash originalAssetHash, const A
     AssetUtils::AssetHash metaFileHash = QCryptographicHash::hash(metaFileJSON, QCryptographicHash::Sha256).toHex();
 
     // create the meta file in our files folder, named by the hash of its contents
+    _hotAssetCache.remove(metaFileHash);
     QFile metaFile(_filesDirectory.absoluteFilePath(metaFileHash));
 
     if (metaFile.open(QIODevice::WriteOnly)) {
@@ -20,6 +20,7 @@
 #include <ThreadedAssignment.h>
 
 #include "AssetUtils.h"
+#include "HotAssetCache.h"
 #include "ReceivedMessage.h"
 
 #include "RegisteredMetaTypes.h"
@@ -154,6 +155,9 @@ private:
     QDir _resourcesDirectory;
     QDir _filesDirectory;
 
+    /// Recently requested asset files, kept mapped for the download tasks, so declared before their pool
+    HotAssetCache _hotAssetCache;
+
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
 
@@ -0,0 +1,150 @@
+//
+//  HotAssetCache.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "HotAssetCache.h"
+
+#include <algorithm>
+
+#include "AssetServerLogging.h"
+
+const int HotAssetCache::DEFAULT_MAX_SIZE_MB = 256;
+
+// a single asset may take at most this fraction of the budget, so that one large file can't flush every other asset
+static const int MAX_ASSET_SIZE_DIVISOR = 4;
+
+static const float BYTES_PER_MEGABYTE = 1024.0f * 1024.0f;
+
+void HotAssetCache::setMaxSize(qint64 maxSize) {
+    QMutexLocker locker(&_mutex);
+    _maxSize = std::max<qint64>(0, maxSize);
+    evict(_maxSize);
+}
+
+HotAssetCache::AssetPointer HotAssetCache::get(const QDir& filesDirectory, const AssetUtils::AssetHash& hash) {
+    qint64 maxSize = _maxSize;
+    if (maxSize == 0) {
+        return nullptr;
+    }
+
+    quint64 numRemovals;
+    {
+        QMutexLocker locker(&_mutex);
+        auto it = _entries.find(hash);
+        if (it != _entries.end()) {
+            _lru.splice(_lru.begin(), _lru, it->lruPosition);
+            ++_hits;
+            return it->asset;
+        }
+        numRemovals = _numRemovals;
+    }
+
+    // load without holding the lock, the other transfer tasks shouldn't wait on the disk
+    ++_misses;
+    auto asset = load(filesDirectory.filePath(hash), maxSize / MAX_ASSET_SIZE_DIVISOR);
+    if (!asset) {
+        ++_uncached;
+        return nullptr;
+    }
+
+    QMutexLocker locker(&_mutex);
+    auto it = _entries.find(hash);
+    if (it != _entries.end()) {
+        // another task loaded it in the meantime
+        return it->asset;
+    }
+    if (numRemovals != _numRemovals) {
+        // an asset file may have been deleted while this one was loading, serve it but don't keep it
+        return asset;
+    }
+
+    evict(_maxSize - asset->getSize());
+    _lru.push_front(hash);
+    _entries.insert(hash, { asset, _lru.begin() });
+    _size += asset->getSize();
+    return asset;
+}
+
+HotAssetCache::AssetPointer HotAssetCache::load(const QString& filePath, qint64 maxAssetSize) {
+    auto asset = std::make_shared<Asset>();
+    asset->_file.setFileName(filePath);
+    if (!asset->_file.open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+
+    asset->_size = asset->_file.size();
+    if (asset->_size > maxAssetSize) {
+        return nullptr;
+    }
+
+    if (asset->_size == 0) {
+        static const char EMPTY[] = "";
+        asset->_data = EMPTY;
+    } else if (auto mapped = asset->_file.map(0, asset->_size)) {
+        asset->_data = reinterpret_cast<const char*>(mapped);
+    } else {
+        asset->_buffer = asset->_file.readAll();
+        asset->_file.close();
+        if (asset->_buffer.size() != asset->_size) {
+            qCWarning(asset_server) << "Failed to read" << filePath << "into the hot asset cache";
+            return nullptr;
+        }
+        asset->_data = asset->_buffer.constData();
+    }
+    return asset;
+}
+
+void HotAssetCache::evict(qint64 maxSize) {
+    while (_size > maxSize && !_lru.empty()) {
+        auto it = _entries.find(_lru.back());
+        qint64 size = it->asset->getSize();
+        _size -= size;
+        ++_evictions;
+        _evictedBytes += size;
+        _entries.erase(it);
+        _lru.pop_back();
+    }
+}
+
+void HotAssetCache::remove(const AssetUtils::AssetHash& hash) {
+    QMutexLocker locker(&_mutex);
+    ++_numRemovals;
+    auto it = _entries.find(hash);
+    if (it != _entries.end()) {
+        _size -= it->asset->getSize();
+        _lru.erase(it->lruPosition);
+        _entries.erase(it);
+    }
+}
+
+void HotAssetCache::clear() {
+    QMutexLocker locker(&_mutex);
+    _entries.clear();
+    _lru.clear();
+    _size = 0;
+}
+
+QJsonObject HotAssetCache::getStats() const {
+    QJsonObject stats;
+    {
+        QMutexLocker locker(&_mutex);
+        stats["1. Assets"] = _entries.size();
+        stats["2. Size (MB)"] = (float)_size / BYTES_PER_MEGABYTE;
+    }
+    quint64 hits = _hits;
+    quint64 misses = _misses;
+    stats["3. Max Size (MB)"] = (float)_maxSize / BYTES_PER_MEGABYTE;
+    stats["4. Hits"] = (double)hits;
+    stats["5. Misses"] = (double)misses;
+    stats["6. Hit Rate"] = hits + misses > 0 ? (float)hits / (float)(hits + misses) : 0.0f;
+    stats["7. Not Cached"] = (double)_uncached;
+    stats["8. Evictions"] = (double)_evictions;
+    stats["9. Evicted (MB)"] = (float)_evictedBytes / BYTES_PER_MEGABYTE;
+    return stats;
+}
@@ -0,0 +1,90 @@
+//
+//  HotAssetCache.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_HotAssetCache_h
+#define hifi_HotAssetCache_h
+
+#include <atomic>
+#include <list>
+#include <memory>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+
+#include "AssetUtils.h"
+
+// Keeps the most recently requested asset files open for the asset server's transfer tasks.
+//   Each file is mapped into memory whole, or read into a buffer that stays pinned if the file system can't map it, so
+//   that replies are written into their packets straight from it instead of seeking and reading the file every time.
+//   Assets are named by the hash of their contents and never change, so entries only leave the cache when it is over
+//   its byte budget, least recently used first, or when the asset file is about to be deleted or rewritten.
+class HotAssetCache {
+public:
+    static const int DEFAULT_MAX_SIZE_MB;
+
+    class Asset {
+    public:
+        const char* getData() const { return _data; }
+        qint64 getSize() const { return _size; }
+
+    private:
+        friend class HotAssetCache;
+
+        QFile _file;
+        QByteArray _buffer; // when the file couldn't be mapped
+        const char* _data { nullptr };
+        qint64 _size { 0 };
+    };
+    using AssetPointer = std::shared_ptr<const Asset>;
+
+    // the budget in bytes, 0 disables the cache
+    void setMaxSize(qint64 maxSize);
+    qint64 getMaxSize() const { return _maxSize; }
+    bool isEnabled() const { return _maxSize > 0; }
+
+    // Returns the asset with that hash from the files directory, loading it if needed. Returns nullptr when the cache
+    // is disabled, the asset doesn't exist, or it is too large to cache, in which case it should be read from the file.
+    // The asset stays valid while the pointer is held, even if it is evicted in the meantime.
+    AssetPointer get(const QDir& filesDirectory, const AssetUtils::AssetHash& hash);
+
+    // Must be called before an asset file is deleted or written, so that it isn't held open
+    void remove(const AssetUtils::AssetHash& hash);
+    void clear();
+
+    QJsonObject getStats() const;
+
+private:
+    struct Entry {
+        AssetPointer asset;
+        std::list<AssetUtils::AssetHash>::iterator lruPosition;
+    };
+
+    static AssetPointer load(const QString& filePath, qint64 maxAssetSize);
+    void evict(qint64 maxSize); // expects _mutex to be locked
+
+    mutable QMutex _mutex;
+    QHash<AssetUtils::AssetHash, Entry> _entries;
+    std::list<AssetUtils::AssetHash> _lru; // most recently used first
+    qint64 _size { 0 };
+    quint64 _numRemovals { 0 };
+    std::atomic<qint64> _maxSize { 0 };
+
+    std::atomic<quint64> _hits { 0 };
+    std::atomic<quint64> _misses { 0 };
+    std::atomic<quint64> _uncached { 0 };
+    std::atomic<quint64> _evictions { 0 };
+    std::atomic<quint64> _evictedBytes { 0 };
+};
+
+#endif // hifi_HotAssetCache_h
@@ -26,11 +26,13 @@
 #include "ByteRange.h"
 #include "ClientServerUtils.h"
 
-SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir) :
+SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                             HotAssetCache& hotAssetCache) :
     QRunnable(),
     _message(message),
     _senderNode(sendToNode),
-    _resourcesDir(resourcesDir)
+    _resourcesDir(resourcesDir),
+    _hotAssetCache(hotAssetCache)
 {
     
 }
@@ -60,8 +62,32 @@ void SendAssetTask::run() {
 
     replyPacketList->writePrimitive(messageID);
 
+    HotAssetCache::AssetPointer cachedAsset;
+    if (byteRange.isValid()) {
+        cachedAsset = _hotAssetCache.get(_resourcesDir, hexHash);
+    }
+
     if (!byteRange.isValid()) {
         replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
+    } else if (cachedAsset) {
+        auto fileSize = cachedAsset->getSize();
+        byteRange.fixupRange(fileSize);
+
+        if (fileSize < byteRange.fromInclusive || fileSize < byteRange.toExclusive) {
+            replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
+            qCDebug(networking) << "Bad byte range: " << hexHash << " "
+                << byteRange.fromInclusive << ":" << byteRange.toExclusive;
+        } else {
+            // a negative range starts back from the end of the file
+            auto size = byteRange.size();
+            auto offset = byteRange.fromInclusive >= 0 ? byteRange.fromInclusive : fileSize + byteRange.fromInclusive;
+
+            replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
+            replyPacketList->writePrimitive(size);
+            replyPacketList->write(cachedAsset->getData() + offset, size);
+
+            qCDebug(networking) << "Sending cached asset: " << hexHash;
+        }
     } else {
         QString filePath = _resourcesDir.filePath(QString(hexHash));
         
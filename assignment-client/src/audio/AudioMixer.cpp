@@ -316,6 +316,7 @@ void AudioMixer::sendStatsPacket() {
     addTiming(_sleepTiming, "sleep");
     addTiming(_frameTiming, "frame");
     addTiming(_packetsTiming, "packets");
+    addTiming(_prepareTiming, "prepare");
     addTiming(_mixTiming, "mix");
     addTiming(_eventsTiming, "events");
 
@@ -348,6 +349,10 @@ void AudioMixer::sendStatsPacket() {
     mixStats["3_active_to_skippped"] = (int)(_stats.activeToSkipped / (float)_numStatFrames);
     mixStats["3_active_to_inactive"] = (int)(_stats.activeToInactive / (float)_numStatFrames);
 
+    mixStats["4_source_frames_prepared"] = (int)(_stats.sourceFramesPrepared / (float)_numStatFrames);
+    mixStats["4_source_bytes_copied"] = (qint64)(_stats.sourceBytesCopied / _numStatFrames);
+    mixStats["4_source_bytes_mixed"] = (qint64)(_stats.sourceBytesMixed / _numStatFrames);
+
     mixStats["total_mixes"] = _stats.totalMixes;
     mixStats["avg_mixes_per_block"] = _stats.totalMixes / _numStatFrames;
 
@@ -476,9 +481,20 @@ void AudioMixer::start() {
             numToRetain = nodeList->size() * (1.0f - _throttlingRatio);
         }
         nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+            // prepare the source-side frame view shared by all listeners
+            {
+                auto prepareTimer = _prepareTiming.timer();
+                _workerSharedData.sourceFrames.prepare(cbegin, cend);
+                _stats.sourceFramesPrepared += _workerSharedData.sourceFrames.getNumFrames();
+                _stats.sourceBytesCopied += _workerSharedData.sourceFrames.getNumBytesCopied();
+            }
+
             // mix across worker threads
             auto mixTimer = _mixTiming.timer();
             _workerPool.mix(cbegin, cend, frame, numToRetain);
+
+            // the view holds raw stream pointers, drop it before the node list is unlocked
+            _workerSharedData.sourceFrames.clear();
         });
 
         // gather stats
@@ -605,6 +621,11 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
         }
 
         qCDebug(audio) << "Throttle Start:" << _throttleStartTarget << "Throttle Backoff:" << _throttleBackoffTarget;
+
+        const QString SHARED_SOURCE_FRAMES_KEY = "shared_source_frames";
+        bool sharedSourceFrames = audioThreadingGroupObject[SHARED_SOURCE_FRAMES_KEY].toBool(true);
+        _workerSharedData.sourceFrames.setEnabled(sharedSourceFrames);
+        qCDebug(audio) << "Shared source frames:" << (sharedSourceFrames ? "enabled" : "disabled");
     }
 
     if (settingsObject.contains(AUDIO_BUFFER_GROUP_KEY)) {
@@ -0,0 +1,109 @@
+//
+//  AudioMixerSourceFrames.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerSourceFrames.h"
+
+#include <AudioConstants.h>
+#include <InjectedAudioStream.h>
+
+#include "AudioMixerClientData.h"
+
+AudioMixerSourceFrames::Frame AudioMixerSourceFrames::prepareFrame(const PositionalAudioStream& stream, int16_t* samples) {
+    Frame frame;
+    frame.isStereo = stream.isStereo();
+
+    if (!stream.lastPopSucceeded()) {
+        bool forceSilentBlock = true;
+
+        if (!stream.getLastPopOutput().isNull()) {
+            bool isInjector = dynamic_cast<const InjectedAudioStream*>(&stream);
+
+            // in an injector, just go silent - the injector has likely ended
+            // in other inputs (microphone, &c.), repeat with fade to avoid the harsh jump to silence
+            if (!isInjector) {
+                // calculate its fade factor, which depends on how many times it's already been repeated.
+                float fadeFactor = calculateRepeatedFrameFadeFactor(stream.getConsecutiveNotMixedCount() - 1);
+                if (fadeFactor > 0.0f) {
+                    frame.fadeFactor = fadeFactor;
+                    forceSilentBlock = false;
+                }
+            }
+        }
+
+        if (forceSilentBlock) {
+            return frame;
+        }
+    }
+
+    // grab the stream from the ring buffer
+    AudioRingBuffer::ConstIterator streamPopOutput = stream.getLastPopOutput();
+    streamPopOutput.readSamples(samples, frame.isStereo ? AudioConstants::NETWORK_FRAME_SAMPLES_STEREO
+                                                        : AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+    frame.samples = samples;
+    return frame;
+}
+
+void AudioMixerSourceFrames::prepare(ConstIter begin, ConstIter end) {
+    clear();
+
+    if (!_isEnabled) {
+        return;
+    }
+
+    // size the sample storage up front, so that it isn't reallocated while frames are prepared
+    int numStreams = 0;
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        auto data = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (data) {
+            numStreams += (int)data->getAudioStreams().size();
+        }
+    });
+    _samples.resize((size_t)numStreams * AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
+
+    int offset = 0;
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        auto data = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (!data) {
+            return;
+        }
+
+        for (const auto& stream : data->getAudioStreams()) {
+            Frame frame = prepareFrame(*stream, &_samples[offset]);
+
+            Entry entry { -1, frame.fadeFactor, frame.isStereo };
+            if (frame.samples) {
+                int numSamples = frame.isStereo ? AudioConstants::NETWORK_FRAME_SAMPLES_STEREO
+                                                : AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+                entry.sampleOffset = offset;
+                offset += numSamples;
+                _numBytesCopied += numSamples * (int)sizeof(int16_t);
+            }
+            _frames[stream.get()] = entry;
+        }
+    });
+}
+
+void AudioMixerSourceFrames::clear() {
+    _frames.clear();
+    _numBytesCopied = 0;
+}
+
+bool AudioMixerSourceFrames::find(const PositionalAudioStream* stream, Frame& frame) const {
+    auto it = _frames.find(stream);
+    if (it == _frames.end()) {
+        return false;
+    }
+
+    const Entry& entry = it->second;
+    frame.samples = entry.sampleOffset >= 0 ? &_samples[entry.sampleOffset] : nullptr;
+    frame.fadeFactor = entry.fadeFactor;
+    frame.isStereo = entry.isStereo;
+    return true;
+}
@@ -0,0 +1,66 @@
+//
+//  AudioMixerSourceFrames.h
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerSourceFrames_h
+#define hifi_AudioMixerSourceFrames_h
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <NodeList.h>
+#include <PositionalAudioStream.h>
+
+// Source-side audio of one mix frame, prepared once and shared by every listener.
+//   Between processing packets and mixing, each stream's popped block is copied out of its ring buffer together with
+//   the repeat/fade decision. Workers then read this view instead of re-reading every source's ring buffer once per
+//   listener. It is only written by prepare(), while no worker is mixing.
+class AudioMixerSourceFrames {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    struct Frame {
+        const int16_t* samples { nullptr }; // nullptr when the source should be flushed with a silent block
+        float fadeFactor { 1.0f };          // gain applied to a repeated block
+        bool isStereo { false };
+    };
+
+    // Computes the frame of a single stream, reading its samples into the given buffer
+    // (which must hold AudioConstants::NETWORK_FRAME_SAMPLES_STEREO samples).
+    static Frame prepareFrame(const PositionalAudioStream& stream, int16_t* samples);
+
+    void setEnabled(bool enabled) { _isEnabled = enabled; }
+    bool isEnabled() const { return _isEnabled; }
+
+    // Must be called with the node list locked, after the streams have popped their block for this frame.
+    void prepare(ConstIter begin, ConstIter end);
+    void clear();
+
+    // Returns false if the stream was not prepared this frame.
+    bool find(const PositionalAudioStream* stream, Frame& frame) const;
+
+    int getNumFrames() const { return (int)_frames.size(); }
+    int getNumBytesCopied() const { return _numBytesCopied; }
+
+private:
+    struct Entry {
+        int sampleOffset; // -1 for a silent block
+        float fadeFactor;
+        bool isStereo;
+    };
+
+    std::unordered_map<const PositionalAudioStream*, Entry> _frames;
+    std::vector<int16_t> _samples;
+    int _numBytesCopied { 0 };
+    bool _isEnabled { true };
+};
+
+#endif // hifi_AudioMixerSourceFrames_h
@@ -36,6 +36,10 @@ void AudioMixerStats::reset() {
     inactive = 0;
     active = 0;
 
+    sourceFramesPrepared = 0;
+    sourceBytesCopied = 0;
+    sourceBytesMixed = 0;
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime = 0;
 #endif
@@ -66,6 +70,10 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     inactive += otherStats.inactive;
     active += otherStats.active;
 
+    sourceFramesPrepared += otherStats.sourceFramesPrepared;
+    sourceBytesCopied += otherStats.sourceBytesCopied;
+    sourceBytesMixed += otherStats.sourceBytesMixed;
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime += otherStats.mixTime;
 #endif
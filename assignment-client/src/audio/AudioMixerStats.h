@@ -12,9 +12,7 @@
 #ifndef hifi_AudioMixerStats_h
 #define hifi_AudioMixerStats_h
 
-#ifdef HIFI_AUDIO_MIXER_DEBUG
 #include <cstdint>
-#endif
 
 struct AudioMixerStats {
     int sumStreams { 0 };
@@ -41,6 +39,11 @@ struct AudioMixerStats {
     int inactive { 0 };
     int active { 0 };
 
+    // source-side memory traffic: samples copied out of ring buffers, and samples read by mixes
+    int sourceFramesPrepared { 0 };
+    uint64_t sourceBytesCopied { 0 };
+    uint64_t sourceBytesMixed { 0 };
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     uint64_t mixTime { 0 };
 #endif
@@ -460,6 +460,9 @@ bool AudioMixerWorker::prepareMix(const SharedNodePointer& listener) {
         });
     }
 
+    // render whatever is left in the HRTF batch
+    flushHRTFRenders();
+
     stats.skipped += (int)streams.skipped.size();
     stats.inactive += (int)streams.inactive.size();
     stats.active += (int)streams.active.size();
@@ -510,71 +513,81 @@ void AudioMixerWorker::addStream(AudioMixerClientData::MixableStream& mixableStr
                                                    relativePosition, distance));
     float azimuth = isEcho ? 0.0f : computeAzimuth(listeningNodeStream, listeningNodeStream, relativePosition);
 
-    const int HRTF_DATASET_INDEX = 1;
-
-    if (!streamToAdd->lastPopSucceeded()) {
-        bool forceSilentBlock = true;
-
-        if (!streamToAdd->getLastPopOutput().isNull()) {
-            bool isInjector = dynamic_cast<const InjectedAudioStream*>(streamToAdd);
-
-            // in an injector, just go silent - the injector has likely ended
-            // in other inputs (microphone, &c.), repeat with fade to avoid the harsh jump to silence
-            if (!isInjector) {
-                // calculate its fade factor, which depends on how many times it's already been repeated.
-                float fadeFactor = calculateRepeatedFrameFadeFactor(streamToAdd->getConsecutiveNotMixedCount() - 1);
-                if (fadeFactor > 0.0f) {
-                    // apply the fadeFactor to the gain
-                    gain *= fadeFactor;
-                    forceSilentBlock = false;
-                }
-            }
+    // the source-side samples and repeat/fade state are shared by all listeners when prepared for this frame
+    AudioMixerSourceFrames::Frame sourceFrame;
+    if (!_sharedData.sourceFrames.find(streamToAdd, sourceFrame)) {
+        sourceFrame = AudioMixerSourceFrames::prepareFrame(*streamToAdd, nextHRTFInput());
+        if (sourceFrame.samples) {
+            stats.sourceBytesCopied += (sourceFrame.isStereo ? AudioConstants::NETWORK_FRAME_BYTES_STEREO
+                                                             : AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL);
         }
+    }
 
-        if (forceSilentBlock) {
-            // call renderSilent with a forced silent block to reduce artifacts
-            // (this is not done for stereo streams since they do not go through the HRTF)
-            if (!streamToAdd->isStereo() && !isEcho) {
-                static int16_t silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
-                mixableStream.hrtf->render(silentMonoBlock, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                           AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-
-                ++stats.hrtfRenders;
-            }
+    if (!sourceFrame.samples) {
+        // call renderSilent with a forced silent block to reduce artifacts
+        // (this is not done for stereo streams since they do not go through the HRTF)
+        if (!streamToAdd->isStereo() && !isEcho) {
+            static const int16_t silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
+            queueHRTFRender(mixableStream.hrtf.get(), silentMonoBlock, azimuth, distance, gain);
 
-            return;
+            ++stats.hrtfRenders;
         }
-    }
 
-    // grab the stream from the ring buffer
-    AudioRingBuffer::ConstIterator streamPopOutput = streamToAdd->getLastPopOutput();
+        return;
+    }
 
-    if (streamToAdd->isStereo()) {
+    // apply the fade of a repeated block
+    gain *= sourceFrame.fadeFactor;
 
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
+    if (sourceFrame.isStereo) {
+        stats.sourceBytesMixed += AudioConstants::NETWORK_FRAME_BYTES_STEREO;
 
         // stereo sources are not passed through HRTF
-        mixableStream.hrtf->mixStereo(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        mixableStream.hrtf->mixStereo(sourceFrame.samples, _mixSamples, gain,
+                                      AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         ++stats.manualStereoMixes;
     } else if (isEcho) {
-
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        stats.sourceBytesMixed += AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL;
 
         // echo sources are not passed through HRTF
-        mixableStream.hrtf->mixMono(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        mixableStream.hrtf->mixMono(sourceFrame.samples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         ++stats.manualEchoMixes;
     } else {
+        stats.sourceBytesMixed += AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL;
 
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        queueHRTFRender(mixableStream.hrtf.get(), sourceFrame.samples, azimuth, distance, gain);
 
-        mixableStream.hrtf->render(_bufferSamples, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                   AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
         ++stats.hrtfRenders;
     }
 }
 
+int16_t* AudioMixerWorker::nextHRTFInput() {
+    if (_numHRTFBatched == HRTF_BATCH_SIZE) {
+        flushHRTFRenders();
+    }
+    return _hrtfBatchSamples[_numHRTFBatched];
+}
+
+void AudioMixerWorker::queueHRTFRender(AudioHRTF* hrtf, const int16_t* input, float azimuth, float distance, float gain) {
+    if (_numHRTFBatched == HRTF_BATCH_SIZE) {
+        flushHRTFRenders();
+    }
+
+    _hrtfBatch[_numHRTFBatched++] = { hrtf, input, azimuth, distance, gain };
+}
+
+void AudioMixerWorker::flushHRTFRenders() {
+    const int HRTF_DATASET_INDEX = 1;
+
+    if (_numHRTFBatched > 0) {
+        AudioHRTF::renderBatch(_hrtfBatch, _numHRTFBatched, _mixSamples, HRTF_DATASET_INDEX,
+                               AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        _numHRTFBatched = 0;
+    }
+}
+
 void AudioMixerWorker::updateHRTFParameters(AudioMixerClientData::MixableStream& mixableStream,
                                            AvatarAudioStream& listeningNodeStream,
                                            float primaryAvatarGain,
@@ -22,6 +22,7 @@
 #include <TBBHelpers.h>
 
 #include "AudioMixerClientData.h"
+#include "AudioMixerSourceFrames.h"
 #include "AudioMixerStats.h"
 
 class AvatarAudioStream;
@@ -35,6 +36,7 @@ public:
         AudioMixerClientData::ConcurrentAddedStreams addedStreams;
         std::vector<Node::LocalID> removedNodes;
         std::vector<NodeIDStreamID> removedStreams;
+        AudioMixerSourceFrames sourceFrames;
     };
 
     AudioMixerWorker(SharedData& sharedData) : _sharedData(sharedData) {};
@@ -65,12 +67,23 @@ private:
                               float primaryInjectorGain);
     void resetHRTFState(AudioMixerClientData::MixableStream& mixableStream);
 
+    // HRTF renders are queued and rendered in batches into the mix
+    int16_t* nextHRTFInput(); // buffer for the samples of the next queued render, if they aren't shared
+    void queueHRTFRender(AudioHRTF* hrtf, const int16_t* input, float azimuth, float distance, float gain);
+    void flushHRTFRenders();
+
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
 
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
 
+    // queued HRTF renders
+    static const int HRTF_BATCH_SIZE = 16;
+    AudioHRTF::BatchSource _hrtfBatch[HRTF_BATCH_SIZE];
+    int16_t _hrtfBatchSamples[HRTF_BATCH_SIZE][AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    int _numHRTFBatched { 0 };
+
     // frame state
     ConstIter _begin;
     ConstIter _end;
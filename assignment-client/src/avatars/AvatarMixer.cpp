@@ -328,11 +328,31 @@ void AvatarMixer::start() {
             _broadcastAvatarDataNodeFunctor += functor;
         }
 
+        // encode the avatar data that listeners can share, now that this frame's packets have been processed
+        _workerSharedData.frame = frame;
+        if (_workerSharedData.useSharedPayloads) {
+            auto start = usecTimestampNow();
+            nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+                _workerPool.encodeSharedPayloads(cbegin, cend);
+            }, &lockWait, &nodeTransform, &functor);
+            auto end = usecTimestampNow();
+            _encodeSharedPayloadsElapsedTime += (end - start);
+
+            _broadcastAvatarDataLockWait += lockWait;
+            _broadcastAvatarDataNodeTransform += nodeTransform;
+            _broadcastAvatarDataNodeFunctor += functor;
+        }
+
         // this is where we need to put the real work...
         {
             auto start = usecTimestampNow();
             nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
                 auto start = usecTimestampNow();
+                // the grid holds raw node pointers, so it is built under the same node list lock the workers use
+                _workerSharedData.spatialGrid.build(cbegin, cend, frame);
+                auto gridBuilt = usecTimestampNow();
+                _spatialGridBuildElapsedTime += (gridBuilt - start);
+
                 _workerPool.broadcastAvatarData(cbegin, cend, _lastFrameTimestamp, _maxKbpsPerNode, _throttlingRatio);
                 auto end = usecTimestampNow();
                 _broadcastAvatarDataInner += (end - start);
@@ -818,6 +838,10 @@ void AvatarMixer::sendStatsPacket() {
     displayNameManagementStats["1_total"] = TIGHT_LOOP_STAT_UINT64(_displayNameManagementElapsedTime);
     parallelTasks["displayNameManagement"] = displayNameManagementStats;
 
+    QJsonObject encodeSharedPayloadsStats;
+    encodeSharedPayloadsStats["1_total"] = TIGHT_LOOP_STAT_UINT64(_encodeSharedPayloadsElapsedTime);
+    parallelTasks["encodeSharedPayloads"] = encodeSharedPayloadsStats;
+
     statsObject["parallelTasks"] = parallelTasks;
 
 
@@ -848,12 +872,52 @@ void AvatarMixer::sendStatsPacket() {
     workersAggregatObject["sent_6_averageIdentityBytes"] = TIGHT_LOOP_STAT(aggregateStats.numIdentityBytesSent);
     workersAggregatObject["sent_7_averageHeroAvatars"] = TIGHT_LOOP_STAT(aggregateStats.numHeroesIncluded);
 
+    float averageCandidates = averageNodes ? aggregateStats.numCandidatesConsidered / averageNodes : 0.0f;
+    workersAggregatObject["sent_8_averageCandidatesConsidered"] = TIGHT_LOOP_STAT(averageCandidates);
+    workersAggregatObject["sent_9_fullScans"] = TIGHT_LOOP_STAT(aggregateStats.numFullScans);
+    workersAggregatObject["sent_10_sharedPayloadsEncoded"] = TIGHT_LOOP_STAT(aggregateStats.numSharedPayloadsEncoded);
+    float averageSharedPayloads = averageNodes ? aggregateStats.numSharedPayloadsSent / averageNodes : 0.0f;
+    workersAggregatObject["sent_11_averageSharedPayloadsSent"] = TIGHT_LOOP_STAT(averageSharedPayloads);
+
+    QJsonObject spatialGridObject;
+    spatialGridObject["cellSize"] = _workerSharedData.spatialGrid.getCellSize();
+    spatialGridObject["farUpdateInterval"] = _workerSharedData.spatialGrid.getFarUpdateInterval();
+    spatialGridObject["numCells"] = _workerSharedData.spatialGrid.getNumCells();
+    spatialGridObject["1_buildTime"] = TIGHT_LOOP_STAT_UINT64(_spatialGridBuildElapsedTime);
+    float averageNearCandidates = averageNodes ? aggregateStats.numNearCandidates / averageNodes : 0.0f;
+    spatialGridObject["2_averageNearCandidates"] = TIGHT_LOOP_STAT(averageNearCandidates);
+    float averageHeroCandidates = averageNodes ? aggregateStats.numHeroCandidates / averageNodes : 0.0f;
+    spatialGridObject["3_averageHeroCandidates"] = TIGHT_LOOP_STAT(averageHeroCandidates);
+    float averageFarCandidates = averageNodes ? aggregateStats.numFarCandidates / averageNodes : 0.0f;
+    spatialGridObject["4_averageFarCandidates"] = TIGHT_LOOP_STAT(averageFarCandidates);
+    workersAggregatObject["spatialGrid"] = spatialGridObject;
+
+    const auto& updateRateTiers = _workerSharedData.updateRateTiers;
+    if (updateRateTiers.isEnabled()) {
+        QJsonObject updateRateTiersObject;
+        float averageRateLimitedAvatars = averageNodes ? aggregateStats.numRateLimitedAvatars / averageNodes : 0.0f;
+        updateRateTiersObject["averageRateLimitedAvatars"] = TIGHT_LOOP_STAT(averageRateLimitedAvatars);
+        for (int i = 0; i < updateRateTiers.getNumTiers(); ++i) {
+            const auto& tier = updateRateTiers.getTier(i);
+            QJsonObject tierObject;
+            tierObject["maxDistance"] = tier.maxDistance;
+            tierObject["rate"] = tier.rate;
+            tierObject["detail"] = AvatarUpdateRateTiers::detailToString(tier.detail);
+            float averageTierAvatars = averageNodes ? aggregateStats.numTierAvatarsSent[i] / averageNodes : 0.0f;
+            tierObject["1_averageAvatarsSent"] = TIGHT_LOOP_STAT(averageTierAvatars);
+            tierObject["2_averageDataBytes"] = TIGHT_LOOP_STAT(aggregateStats.numTierDataBytesSent[i]);
+            updateRateTiersObject["tier_" + QString::number(i)] = tierObject;
+        }
+        workersAggregatObject["updateRateTiers"] = updateRateTiersObject;
+    }
+
     workersAggregatObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processIncomingPacketsElapsedTime);
     workersAggregatObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.ignoreCalculationElapsedTime);
     workersAggregatObject["timing_3_toByteArray"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.toByteArrayElapsedTime);
     workersAggregatObject["timing_4_avatarDataPacking"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.avatarDataPackingElapsedTime);
     workersAggregatObject["timing_5_packetSending"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.packetSendingElapsedTime);
     workersAggregatObject["timing_6_jobElapsedTime"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.jobElapsedTime);
+    workersAggregatObject["timing_7_sharedPayloadEncode"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.sharedPayloadEncodeElapsedTime);
 
     statsObject["workers_aggregate (per frame)"] = workersAggregatObject;
 
@@ -923,7 +987,8 @@ void AvatarMixer::sendStatsPacket() {
     _ignoreCalculationElapsedTime = 0;
     _avatarDataPackingElapsedTime = 0;
     _packetSendingElapsedTime = 0;
-
+    _spatialGridBuildElapsedTime = 0;
+    _encodeSharedPayloadsElapsedTime = 0;
 
     auto end = usecTimestampNow();
     _sendStatsElapsedTime = (end - start);
@@ -1031,6 +1096,42 @@ void AvatarMixer::parseDomainServerSettings(const QJsonObject& domainSettings) {
         }
     }
 
+    {   // Spatial culling of candidate avatars per listener:
+        static const QString SPATIAL_CULLING_RADIUS_KEY = "spatial_culling_radius";
+        static const QString FAR_AVATAR_UPDATE_INTERVAL_KEY = "far_avatar_update_interval";
+        const float DEFAULT_SPATIAL_CULLING_RADIUS = 0.0f;
+        const int DEFAULT_FAR_AVATAR_UPDATE_INTERVAL = 4;
+
+        float cullingRadius = (float)avatarMixerGroupObject[SPATIAL_CULLING_RADIUS_KEY].toDouble(DEFAULT_SPATIAL_CULLING_RADIUS);
+        int farUpdateInterval = avatarMixerGroupObject[FAR_AVATAR_UPDATE_INTERVAL_KEY].toInt(DEFAULT_FAR_AVATAR_UPDATE_INTERVAL);
+        _workerSharedData.spatialGrid.setCellSize(std::max(0.0f, cullingRadius));
+        _workerSharedData.spatialGrid.setFarUpdateInterval(farUpdateInterval);
+        if (_workerSharedData.spatialGrid.isEnabled()) {
+            qCDebug(avatars) << "Avatar mixer culling candidates beyond" << cullingRadius << "m, distant avatars considered every"
+                             << _workerSharedData.spatialGrid.getFarUpdateInterval() << "frames";
+        } else {
+            qCDebug(avatars) << "Avatar mixer spatial culling is disabled";
+        }
+    }
+
+    {   // Encoding avatar data once per frame for all the listeners that can share it:
+        static const QString SHARED_PAYLOADS_KEY = "shared_avatar_payloads";
+        _workerSharedData.useSharedPayloads = avatarMixerGroupObject[SHARED_PAYLOADS_KEY].toBool(true);
+        qCDebug(avatars) << "Avatar mixer shared payloads are" << (_workerSharedData.useSharedPayloads ? "enabled" : "disabled");
+    }
+
+    {   // Distance tiers limiting the rate and detail of the avatar data sent to each listener:
+        static const QString UPDATE_RATE_TIERS_KEY = "update_rate_tiers";
+        auto& updateRateTiers = _workerSharedData.updateRateTiers;
+        updateRateTiers.parseSettings(avatarMixerGroupObject[UPDATE_RATE_TIERS_KEY].toArray(),
+                                      AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND);
+        for (int i = 0; i < updateRateTiers.getNumTiers(); ++i) {
+            const auto& tier = updateRateTiers.getTier(i);
+            qCDebug(avatars) << "Avatar mixer sending avatars within" << tier.maxDistance << "m at" << tier.rate << "Hz with"
+                             << AvatarUpdateRateTiers::detailToString(tier.detail) << "detail";
+        }
+    }
+
     {   // Fraction of downstream bandwidth reserved for 'hero' avatars:
         static const QString PRIORITY_FRACTION_KEY = "priority_fraction";
         if (avatarMixerGroupObject.contains(PRIORITY_FRACTION_KEY)) {
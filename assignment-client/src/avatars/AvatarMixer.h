@@ -128,6 +128,8 @@ private:
     quint64 _ignoreCalculationElapsedTime { 0 };
     quint64 _avatarDataPackingElapsedTime { 0 };
     quint64 _packetSendingElapsedTime { 0 };
+    quint64 _spatialGridBuildElapsedTime { 0 };
+    quint64 _encodeSharedPayloadsElapsedTime { 0 };
 
     quint64 _broadcastAvatarDataElapsedTime { 0 }; // total time spent in broadcastAvatarData since last stats window
     quint64 _broadcastAvatarDataInner { 0 };
@@ -22,6 +22,7 @@
 #include <QtCore/QSharedPointer>
 #include <QtCore/QUrl>
 
+#include "AvatarSharedPayloads.h"
 #include "MixerAvatar.h"
 #include <AssociatedTraitValues.h>
 #include <NodeData.h>
@@ -128,6 +129,12 @@ public:
     void setLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar, uint64_t time);
 
     QVector<JointData>& getLastOtherAvatarSentJoints(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarSentJoints[otherAvatar]; }
+    AvatarSharedPayloads::ListenerState& getLastOtherAvatarSharedPayload(NLPacket::LocalID otherAvatar) {
+        return _lastOtherAvatarSharedPayloads[otherAvatar];
+    }
+
+    AvatarSharedPayloads& getSharedPayloads() { return _sharedPayloads; }
+    const AvatarSharedPayloads& getSharedPayloads() const { return _sharedPayloads; }
 
     void queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
     int processPackets(const WorkerSharedData& workerSharedData); // returns number of packets processed
@@ -176,6 +183,10 @@ private:
     // sending to "this" node
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeTime;
     std::unordered_map<NLPacket::LocalID, QVector<JointData>> _lastOtherAvatarSentJoints;
+    std::unordered_map<NLPacket::LocalID, AvatarSharedPayloads::ListenerState> _lastOtherAvatarSharedPayloads;
+
+    // this avatar's data, as encoded for all listeners this frame
+    AvatarSharedPayloads _sharedPayloads;
 
     uint64_t _identityChangeTimestamp;
     bool _avatarSessionDisplayNameMustChange{ true };
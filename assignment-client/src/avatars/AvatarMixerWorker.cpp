@@ -12,6 +12,7 @@
 #include "AvatarMixerWorker.h"
 
 #include <algorithm>
+#include <limits>
 #include <random>
 #include <chrono>
 
@@ -70,6 +71,18 @@ void AvatarMixerWorker::processIncomingPackets(const SharedNodePointer& node) {
     _stats.processIncomingPacketsElapsedTime += (end - start);
 }
 
+void AvatarMixerWorker::encodeSharedPayloads(const SharedNodePointer& node) {
+    auto start = usecTimestampNow();
+    auto nodeData = dynamic_cast<AvatarMixerClientData*>(node->getLinkedData());
+    if (node->getType() == NodeType::Agent && nodeData) {
+        auto& sharedPayloads = nodeData->getSharedPayloads();
+        sharedPayloads.encode(nodeData->getAvatar(), node->getLocalID(), _sharedData->frame);
+        _stats.numSharedPayloadsEncoded += sharedPayloads.getNumEncoded();
+    }
+    auto end = usecTimestampNow();
+    _stats.sharedPayloadEncodeElapsedTime += (end - start);
+}
+
 int AvatarMixerWorker::sendIdentityPacket(NLPacketList& packetList, const AvatarMixerClientData* nodeData, const Node& destinationNode) {
     if (destinationNode.getType() == NodeType::Agent && !destinationNode.isUpstream()) {
         QByteArray individualData = nodeData->getConstAvatarData()->identityByteArray();
@@ -372,6 +385,10 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
 
     // prepare to sort
     const auto& cameraViews = destinationNodeData->getViewFrustums();
+    std::vector<glm::vec3> listenerPositions { destinationPosition };
+    for (const auto& view : cameraViews) {
+        listenerPositions.push_back(view.getPosition());
+    }
 
     using AvatarPriorityQueue = PrioritySortUtil::PriorityQueue<SortableAvatar>;
     // Keep two independent queues, one for heroes and one for the riff-raff.
@@ -384,15 +401,30 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
             AvatarData::_avatarSortCoefficientCenter, AvatarData::_avatarSortCoefficientAge}
     };
 
-    avatarPriorityQueues[kNonhero].reserve(_end - _begin);
+    // Only visit the avatars the spatial grid considers relevant to this listener. A closing PAL needs to see every
+    // ignored avatar to send kill packets, and an open one wants everyone, so those listeners still scan all nodes.
+    const auto& spatialGrid = _sharedData->spatialGrid;
+    bool useSpatialGrid = spatialGrid.isEnabled() && !PALIsOpen && !PALWasOpen;
+    AvatarSpatialGrid::Candidates candidates;
+    if (useSpatialGrid) {
+        spatialGrid.query(listenerPositions, candidates);
+
+        _stats.numNearCandidates += candidates.numNear;
+        _stats.numHeroCandidates += candidates.numHeroes;
+        _stats.numFarCandidates += candidates.numFar;
+        avatarPriorityQueues[kNonhero].reserve(candidates.nodes.size());
+    } else {
+        ++_stats.numFullScans;
+        avatarPriorityQueues[kNonhero].reserve(_end - _begin);
+    }
 
-    for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
-        Node* otherNodeRaw = (*listedNode).data();
+    auto considerSourceNode = [&](Node* otherNodeRaw) {
         if (otherNodeRaw->getType() != NodeType::Agent
             || !otherNodeRaw->getLinkedData()
             || otherNodeRaw == destinationNode) {
-            continue;
+            return;
         }
+        ++_stats.numCandidatesConsidered;
 
         auto sourceAvatarNode = otherNodeRaw;
 
@@ -500,10 +532,20 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
             nodeList->sendPacket(std::move(packet), *destinationNode);
             destinationNodeData->cleanupKilledNode(sourceAvatarNode->getUUID(), sourceAvatarNode->getLocalID());
         }
+    };
 
-        destinationNodeData->setPrevRequestsDomainListData(PALIsOpen);
+    if (useSpatialGrid) {
+        for (Node* candidate : candidates.nodes) {
+            considerSourceNode(candidate);
+        }
+    } else {
+        for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
+            considerSourceNode((*listedNode).data());
+        }
     }
 
+    destinationNodeData->setPrevRequestsDomainListData(PALIsOpen);
+
     // loop through our sorted avatars and allocate our bandwidth to them accordingly
 
     int remainingAvatars = (int)avatarPriorityQueues[kHero].size() + (int)avatarPriorityQueues[kNonhero].size();
@@ -516,6 +558,14 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
     int numAvatarsSent = 0;
     auto identityPacketList = NLPacketList::create(PacketType::AvatarIdentity, QByteArray(), true, true);
 
+    // Distant and out-of-view avatars may be sent less often, and with less detail. Priority avatars are exempt, as are
+    // listeners with the PAL open.
+    const auto& updateRateTiers = _sharedData->updateRateTiers;
+    bool useUpdateRateTiers = updateRateTiers.isEnabled() && !PALIsOpen;
+    const uint64_t frameStartTime = usecTimestampNow();
+    const bool useSharedPayloads = _sharedData->useSharedPayloads;
+    const uint32_t frame = _sharedData->frame;
+
     // Loop over two priorities - hero avatars then everyone else:
     std::array<PriorityVariants, 2> priority_order = { PriorityVariants::kHero, PriorityVariants::kNonhero };
     for (PriorityVariants currentVariant : priority_order) {
@@ -556,11 +606,37 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
             // Typically all out-of-view avatars but such avatars' priorities will rise with time:
             bool isLowerPriority = sortedAvatar.getPriority() <= OUT_OF_VIEW_THRESHOLD;
 
+            int tier = -1;
+            if (useUpdateRateTiers && !sourceAvatar->getHasPriority()) {
+                if (isLowerPriority) {
+                    tier = updateRateTiers.getFurthestTier();
+                } else {
+                    float distance = std::numeric_limits<float>::max();
+                    for (const auto& position : listenerPositions) {
+                        distance = std::min(distance, glm::distance(position, sortedAvatar.getPosition()));
+                    }
+                    tier = updateRateTiers.findTier(distance);
+                }
+            }
+            bool isRateLimited = tier >= 0 && !updateRateTiers.isDue(tier, lastEncodeForOther, frameStartTime);
+
+            const AvatarSharedPayloads& sharedPayloads = sourceNodeData->getSharedPayloads();
+            auto& sharedPayloadState = destinationNodeData->getLastOtherAvatarSharedPayload(sourceNode->getLocalID());
+            int distanceLevel = AvatarSharedPayloads::getDistanceLevel(
+                glm::distance(sourceAvatar->getClientGlobalPosition(), destinationPosition));
+
             if (isLowerPriority) {
                 detail = PALIsOpen ? AvatarData::PALMinimum : AvatarData::MinimumData;
                 destinationNodeData->incrementAvatarOutOfView();
             } else if (!overBudget) {
-                detail = distribution(generator) < AVATAR_SEND_FULL_UPDATE_RATIO ? AvatarData::SendAllData : AvatarData::CullSmallData;
+                if (useSharedPayloads && sharedPayloads.isKeyFrame(frame)) {
+                    // key frames take the place of the random full updates for the listeners that share payloads
+                    detail = AvatarData::SendAllData;
+                } else if (useSharedPayloads && sharedPayloads.isInSync(frame, distanceLevel, sharedPayloadState)) {
+                    detail = AvatarData::CullSmallData;
+                } else {
+                    detail = distribution(generator) < AVATAR_SEND_FULL_UPDATE_RATIO ? AvatarData::SendAllData : AvatarData::CullSmallData;
+                }
                 destinationNodeData->incrementAvatarInView();
 
                 // If the time that the mixer sent AVATAR DATA about Avatar B to Node A is BEFORE OR EQUAL TO
@@ -574,39 +650,88 @@ void AvatarMixerWorker::broadcastAvatarDataToAgent(const SharedNodePointer& node
                 }
             }
 
+            if (isRateLimited) {
+                // Not due this frame; its priority keeps rising with age until it is.
+                detail = AvatarData::NoData;
+                _stats.numRateLimitedAvatars++;
+            } else if (tier >= 0 && detail > AvatarData::MinimumData
+                       && updateRateTiers.getTier(tier).detail == AvatarUpdateRateTiers::MinimalDetail) {
+                detail = AvatarData::MinimumData;
+            }
+
             QVector<JointData>& lastSentJointsForOther = destinationNodeData->getLastOtherAvatarSentJoints(sourceNode->getLocalID());
 
             const bool distanceAdjust = true;
             const bool dropFaceTracking = false;
             AvatarDataPacket::SendStatus sendStatus;
             sendStatus.sendUUID = true;
+            int avatarDataBytes = 0;
 
-            do {
-                auto startSerialize = chrono::high_resolution_clock::now();
-                QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
-                    sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
-                    &lastSentJointsForOther, avatarSpaceAvailable);
-                auto endSerialize = chrono::high_resolution_clock::now();
-                _stats.toByteArrayElapsedTime +=
-                    (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
-
-                avatarPacket->write(bytes);
-                avatarSpaceAvailable -= bytes.size();
-                numAvatarDataBytes += bytes.size();
-                if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
-                    // Weren't able to fit everything.
+            const QByteArray* sharedPayload = nullptr;
+            if (useSharedPayloads && !isRateLimited) {
+                sharedPayload = sharedPayloads.find(frame, detail, distanceLevel, sharedPayloadState, lastEncodeForOther);
+                if (sharedPayload && sharedPayload->size() > avatarPacketCapacity) {
+                    sharedPayload = nullptr; // needs splitting across packets
+                }
+            }
+
+            if (sharedPayload) {
+                if (sharedPayload->size() > avatarSpaceAvailable) {
                     nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
                     ++numPacketsSent;
                     avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
                     avatarSpaceAvailable = avatarPacketCapacity;
                 }
-            } while (!sendStatus);
+
+                avatarPacket->write(*sharedPayload);
+                avatarSpaceAvailable -= sharedPayload->size();
+                numAvatarDataBytes += sharedPayload->size();
+                avatarDataBytes += sharedPayload->size();
+                if (avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
+                    nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+                    ++numPacketsSent;
+                    avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                    avatarSpaceAvailable = avatarPacketCapacity;
+                }
+
+                sharedPayloads.markSent(detail, distanceLevel, sharedPayloadState, lastSentJointsForOther);
+                _stats.numSharedPayloadsSent++;
+            } else if (!isRateLimited) {
+                // encoding for this listener alone takes it off the shared joint streams until the next key frame
+                sharedPayloadState = AvatarSharedPayloads::ListenerState();
+
+                do {
+                    auto startSerialize = chrono::high_resolution_clock::now();
+                    QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
+                        sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
+                        &lastSentJointsForOther, avatarSpaceAvailable);
+                    auto endSerialize = chrono::high_resolution_clock::now();
+                    _stats.toByteArrayElapsedTime +=
+                        (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
+
+                    avatarPacket->write(bytes);
+                    avatarSpaceAvailable -= bytes.size();
+                    numAvatarDataBytes += bytes.size();
+                    avatarDataBytes += bytes.size();
+                    if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
+                        // Weren't able to fit everything.
+                        nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+                        ++numPacketsSent;
+                        avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                        avatarSpaceAvailable = avatarPacketCapacity;
+                    }
+                } while (!sendStatus);
+            }
 
             if (detail != AvatarData::NoData) {
                 _stats.numOthersIncluded++;
                 if (sourceAvatar->getHasPriority()) {
                     _stats.numHeroesIncluded++;
                 }
+                if (tier >= 0) {
+                    _stats.numTierDataBytesSent[tier] += avatarDataBytes;
+                    _stats.numTierAvatarsSent[tier]++;
+                }
 
                 // increment the number of avatars sent to this receiver
                 destinationNodeData->incrementNumAvatarsSentLastFrame();
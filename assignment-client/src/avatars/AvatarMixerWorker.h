@@ -12,8 +12,13 @@
 #ifndef hifi_AvatarMixerWorker_h
 #define hifi_AvatarMixerWorker_h
 
+#include <array>
+
 #include <NodeList.h>
 
+#include "AvatarSpatialGrid.h"
+#include "AvatarUpdateRateTiers.h"
+
 class AvatarMixerClientData;
 
 class AvatarMixerWorkerStats {
@@ -34,10 +39,24 @@ public:
     int overBudgetAvatars { 0 };
     int numHeroesIncluded { 0 };
 
+    int numCandidatesConsidered { 0 };
+    int numNearCandidates { 0 };
+    int numHeroCandidates { 0 };
+    int numFarCandidates { 0 };
+    int numFullScans { 0 };
+
+    std::array<int, AvatarUpdateRateTiers::MAX_TIERS> numTierDataBytesSent {};
+    std::array<int, AvatarUpdateRateTiers::MAX_TIERS> numTierAvatarsSent {};
+    int numRateLimitedAvatars { 0 };
+
+    int numSharedPayloadsEncoded { 0 };
+    int numSharedPayloadsSent { 0 };
+
     quint64 ignoreCalculationElapsedTime { 0 };
     quint64 avatarDataPackingElapsedTime { 0 };
     quint64 packetSendingElapsedTime { 0 };
     quint64 toByteArrayElapsedTime { 0 };
+    quint64 sharedPayloadEncodeElapsedTime { 0 };
     quint64 jobElapsedTime { 0 };
 
     void reset() {
@@ -60,10 +79,24 @@ public:
         overBudgetAvatars = 0;
         numHeroesIncluded = 0;
 
+        numCandidatesConsidered = 0;
+        numNearCandidates = 0;
+        numHeroCandidates = 0;
+        numFarCandidates = 0;
+        numFullScans = 0;
+
+        numTierDataBytesSent.fill(0);
+        numTierAvatarsSent.fill(0);
+        numRateLimitedAvatars = 0;
+
+        numSharedPayloadsEncoded = 0;
+        numSharedPayloadsSent = 0;
+
         ignoreCalculationElapsedTime = 0;
         avatarDataPackingElapsedTime = 0;
         packetSendingElapsedTime = 0;
         toByteArrayElapsedTime = 0;
+        sharedPayloadEncodeElapsedTime = 0;
         jobElapsedTime = 0;
     }
 
@@ -84,10 +117,26 @@ public:
         overBudgetAvatars += rhs.overBudgetAvatars;
         numHeroesIncluded += rhs.numHeroesIncluded;
 
+        numCandidatesConsidered += rhs.numCandidatesConsidered;
+        numNearCandidates += rhs.numNearCandidates;
+        numHeroCandidates += rhs.numHeroCandidates;
+        numFarCandidates += rhs.numFarCandidates;
+        numFullScans += rhs.numFullScans;
+
+        for (int i = 0; i < AvatarUpdateRateTiers::MAX_TIERS; ++i) {
+            numTierDataBytesSent[i] += rhs.numTierDataBytesSent[i];
+            numTierAvatarsSent[i] += rhs.numTierAvatarsSent[i];
+        }
+        numRateLimitedAvatars += rhs.numRateLimitedAvatars;
+
+        numSharedPayloadsEncoded += rhs.numSharedPayloadsEncoded;
+        numSharedPayloadsSent += rhs.numSharedPayloadsSent;
+
         ignoreCalculationElapsedTime += rhs.ignoreCalculationElapsedTime;
         avatarDataPackingElapsedTime += rhs.avatarDataPackingElapsedTime;
         packetSendingElapsedTime += rhs.packetSendingElapsedTime;
         toByteArrayElapsedTime += rhs.toByteArrayElapsedTime;
+        sharedPayloadEncodeElapsedTime += rhs.sharedPayloadEncodeElapsedTime;
         jobElapsedTime += rhs.jobElapsedTime;
         return *this;
     }
@@ -100,6 +149,10 @@ struct WorkerSharedData {
     QStringList skeletonURLAllowlist;
     QUrl skeletonReplacementURL;
     EntityTreePointer entityTree;
+    AvatarSpatialGrid spatialGrid; // rebuilt by the mixer before each broadcast, read-only for workers
+    AvatarUpdateRateTiers updateRateTiers;
+    bool useSharedPayloads { true }; // encode avatar data once per frame for the listeners that can share it
+    uint32_t frame { 0 }; // the current mixer frame
 };
 
 class AvatarMixerWorker {
@@ -114,6 +167,7 @@ public:
                     float priorityReservedFraction);
 
     void processIncomingPackets(const SharedNodePointer& node);
+    void encodeSharedPayloads(const SharedNodePointer& node);
     void broadcastAvatarData(const SharedNodePointer& node);
 
     void harvestStats(AvatarMixerWorkerStats& stats);
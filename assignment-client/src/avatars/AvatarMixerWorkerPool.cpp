@@ -71,6 +71,14 @@ void AvatarMixerWorkerPool::processIncomingPackets(ConstIter begin, ConstIter en
     run(begin, end);
 }
 
+void AvatarMixerWorkerPool::encodeSharedPayloads(ConstIter begin, ConstIter end) {
+    _function = &AvatarMixerWorker::encodeSharedPayloads;
+    _configure = [=](AvatarMixerWorker& worker) {
+        worker.configure(begin, end);
+    };
+    run(begin, end);
+}
+
 void AvatarMixerWorkerPool::broadcastAvatarData(ConstIter begin, ConstIter end,
                                                p_high_resolution_clock::time_point lastFrameTimestamp,
                                                float maxKbpsPerNode, float throttlingRatio) {
@@ -68,6 +68,7 @@ public:
 
     // Jobs the worker pool can do...
     void processIncomingPackets(ConstIter begin, ConstIter end);
+    void encodeSharedPayloads(ConstIter begin, ConstIter end);
     void broadcastAvatarData(ConstIter begin, ConstIter end, 
                     p_high_resolution_clock::time_point lastFrameTimestamp, float maxKbpsPerNode, float throttlingRatio);
 
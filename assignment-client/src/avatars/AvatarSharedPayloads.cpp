@@ -0,0 +1,143 @@
+//
+//  AvatarSharedPayloads.cpp
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarSharedPayloads.h"
+
+#include <SharedUtil.h>
+
+#include "MixerAvatar.h"
+
+namespace {
+    // Upper bounds of the distance levels, as used by AvatarData::getDistanceBasedMinRotationDOT().
+    const float DISTANCE_LEVELS[AvatarSharedPayloads::NUM_DISTANCE_LEVELS - 1] = {
+        AVATAR_DISTANCE_LEVEL_1, AVATAR_DISTANCE_LEVEL_2, AVATAR_DISTANCE_LEVEL_3,
+        AVATAR_DISTANCE_LEVEL_4, AVATAR_DISTANCE_LEVEL_5
+    };
+
+    // A distance well inside each level, so that rounding doesn't move the encoding viewer to the next one.
+    float getDistanceLevelMidpoint(int level) {
+        float lower = level > 0 ? DISTANCE_LEVELS[level - 1] : 0.0f;
+        float upper = level < AvatarSharedPayloads::NUM_DISTANCE_LEVELS - 1 ? DISTANCE_LEVELS[level] : 2.0f * lower;
+        return 0.5f * (lower + upper);
+    }
+}
+
+int AvatarSharedPayloads::getDistanceLevel(float distance) {
+    int level = 0;
+    while (level < NUM_DISTANCE_LEVELS - 1 && distance >= DISTANCE_LEVELS[level]) {
+        ++level;
+    }
+    return level;
+}
+
+void AvatarSharedPayloads::encode(const MixerAvatar& avatar, uint16_t localID, uint32_t frame) {
+    // Nothing changes between the end of the previous frame's encoding and the end of its broadcast, so the previous
+    // encoding time stands for the time every listener sent data last frame was last sent it.
+    _previousEncodeTime = _encodeTime;
+    _encodeTime = usecTimestampNow();
+    _frame = frame;
+    _isKeyFrame = (frame + localID) % KEY_FRAME_INTERVAL == 0; // staggered, to spread the full payloads over frames
+    _numEncoded = 0;
+
+    const bool dropFaceTracking = false;
+    const bool distanceAdjust = true;
+    const glm::vec3 avatarPosition = avatar.getClientGlobalPosition();
+    const QVector<JointData> noJoints;
+
+    AvatarDataPacket::SendStatus sendStatus;
+    sendStatus.sendUUID = true;
+    _palMinimumPayload = avatar.toByteArray(AvatarData::PALMinimum, _previousEncodeTime, noJoints, sendStatus,
+                                            dropFaceTracking, distanceAdjust, avatarPosition, nullptr);
+    sendStatus = AvatarDataPacket::SendStatus();
+    sendStatus.sendUUID = true;
+    _minimumPayload = avatar.toByteArray(AvatarData::MinimumData, _previousEncodeTime, noJoints, sendStatus,
+                                         dropFaceTracking, distanceAdjust, avatarPosition, nullptr);
+    _numEncoded += 2;
+
+    if (_isKeyFrame) {
+        sendStatus = AvatarDataPacket::SendStatus();
+        sendStatus.sendUUID = true;
+        _fullPayload = avatar.toByteArray(AvatarData::SendAllData, _previousEncodeTime, _fullJoints, sendStatus,
+                                          dropFaceTracking, distanceAdjust, avatarPosition, &_fullJoints);
+        ++_numEncoded;
+
+        // every stream restarts from the joints of the full payload
+        for (auto& stream : _streams) {
+            stream.sentJoints = _fullJoints;
+            stream.payload.clear();
+            stream.frame = frame;
+            stream.baseFrame = INVALID_FRAME;
+            stream.isWanted = false;
+        }
+        return;
+    }
+    _fullPayload.clear();
+
+    for (int level = 0; level < NUM_DISTANCE_LEVELS; ++level) {
+        auto& stream = _streams[level];
+        bool wasWanted = stream.isWanted.exchange(false);
+
+        // A stream can only be followed from one frame to the next; left alone for a frame, it waits for a key frame.
+        if (!wasWanted || stream.frame != frame - 1) {
+            stream.payload.clear();
+            continue;
+        }
+
+        glm::vec3 viewerPosition = avatarPosition + glm::vec3(getDistanceLevelMidpoint(level), 0.0f, 0.0f);
+        sendStatus = AvatarDataPacket::SendStatus();
+        sendStatus.sendUUID = true;
+        stream.payload = avatar.toByteArray(AvatarData::CullSmallData, _previousEncodeTime, stream.sentJoints, sendStatus,
+                                            dropFaceTracking, distanceAdjust, viewerPosition, &stream.sentJoints);
+        stream.baseFrame = stream.frame;
+        stream.frame = frame;
+        ++_numEncoded;
+    }
+}
+
+bool AvatarSharedPayloads::isInSync(uint32_t frame, int level, const ListenerState& listener) const {
+    const auto& stream = _streams[level];
+    return _frame == frame && stream.frame == frame && !stream.payload.isEmpty()
+        && listener.level == level && listener.frame == stream.baseFrame;
+}
+
+const QByteArray* AvatarSharedPayloads::find(uint32_t frame, AvatarData::AvatarDataDetail detail, int level,
+                                             const ListenerState& listener, uint64_t lastEncodeTime) const {
+    if (_frame != frame) {
+        return nullptr; // the avatar arrived after this frame's encoding
+    }
+
+    switch (detail) {
+        case AvatarData::PALMinimum:
+            return &_palMinimumPayload;
+        case AvatarData::MinimumData:
+            return lastEncodeTime >= _previousEncodeTime ? &_minimumPayload : nullptr;
+        case AvatarData::SendAllData:
+            return _isKeyFrame ? &_fullPayload : nullptr;
+        case AvatarData::CullSmallData:
+            return isInSync(frame, level, listener) ? &_streams[level].payload : nullptr;
+        default:
+            return nullptr;
+    }
+}
+
+void AvatarSharedPayloads::markSent(AvatarData::AvatarDataDetail detail, int level, ListenerState& listener,
+                                    QVector<JointData>& lastSentJoints) const {
+    if (detail == AvatarData::SendAllData) {
+        lastSentJoints = _fullJoints;
+    } else if (detail == AvatarData::CullSmallData) {
+        lastSentJoints = _streams[level].sentJoints;
+    } else {
+        return; // no joints were sent
+    }
+
+    listener.frame = _frame;
+    listener.level = level;
+    _streams[level].isWanted.store(true, std::memory_order_relaxed);
+}
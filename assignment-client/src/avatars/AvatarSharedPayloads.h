@@ -0,0 +1,85 @@
+//
+//  AvatarSharedPayloads.h
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarSharedPayloads_h
+#define hifi_AvatarSharedPayloads_h
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+
+#include <AvatarData.h>
+
+class MixerAvatar;
+
+// Avatar data encoded once per frame and shared by all the listeners of an avatar.
+//   AvatarData::toByteArray() only depends on the listener through the time and joints it was last sent and, for culled
+//   joints, its distance. The minimal payloads are encoded against the previous frame, so they suit every listener that
+//   was sent the avatar last frame. Culled joints are encoded as one stream per distance level: a listener that was sent
+//   a stream's payload last frame has the stream's joints, and so can be sent its next payload. Listeners join the
+//   streams on key frames, when every listener with the avatar in view is sent the full payload. All other cases are
+//   left to per-listener encoding.
+class AvatarSharedPayloads {
+public:
+    static const int NUM_DISTANCE_LEVELS = 6; // see AvatarData::getDistanceBasedMinRotationDOT()
+    static const uint32_t KEY_FRAME_INTERVAL = 50; // frames, about 1 / AVATAR_SEND_FULL_UPDATE_RATIO
+    static const uint32_t INVALID_FRAME = 0; // mixer frames start at 1
+
+    // What a listener was last sent of a source avatar's joint streams.
+    struct ListenerState {
+        uint32_t frame { INVALID_FRAME };
+        int level { -1 };
+    };
+
+    static int getDistanceLevel(float distance);
+
+    // Encodes this frame's payloads. Called once per frame for every avatar, after the incoming packets are processed and
+    // before any listener is sent data.
+    void encode(const MixerAvatar& avatar, uint16_t localID, uint32_t frame);
+
+    bool isKeyFrame(uint32_t frame) const { return _frame == frame && _isKeyFrame; }
+    bool isInSync(uint32_t frame, int level, const ListenerState& listener) const;
+
+    // The payload for the given detail that the listener can be sent this frame, or nullptr if it must be encoded for it.
+    const QByteArray* find(uint32_t frame, AvatarData::AvatarDataDetail detail, int level, const ListenerState& listener,
+                           uint64_t lastEncodeTime) const;
+
+    // Records that the listener was sent the payload returned by find().
+    void markSent(AvatarData::AvatarDataDetail detail, int level, ListenerState& listener,
+                  QVector<JointData>& lastSentJoints) const;
+
+    int getNumEncoded() const { return _numEncoded; }
+
+private:
+    struct Stream {
+        QVector<JointData> sentJoints;
+        QByteArray payload;
+        uint32_t frame { INVALID_FRAME }; // of the payload, or of the key frame the stream was reset to
+        uint32_t baseFrame { INVALID_FRAME }; // the payload is relative to the joints sent on this frame
+        mutable std::atomic<bool> isWanted { false }; // a listener joined or followed the stream this frame
+    };
+
+    uint32_t _frame { INVALID_FRAME };
+    uint64_t _encodeTime { 0 };
+    uint64_t _previousEncodeTime { 0 };
+    bool _isKeyFrame { false };
+    int _numEncoded { 0 };
+
+    QByteArray _palMinimumPayload;
+    QByteArray _minimumPayload;
+    QByteArray _fullPayload;
+    QVector<JointData> _fullJoints;
+    std::array<Stream, NUM_DISTANCE_LEVELS> _streams;
+};
+
+#endif // hifi_AvatarSharedPayloads_h
@@ -0,0 +1,120 @@
+//
+//  AvatarSpatialGrid.cpp
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarSpatialGrid.h"
+
+#include <glm/gtx/norm.hpp>
+
+#include "AvatarMixerClientData.h"
+
+void AvatarSpatialGrid::clear() {
+    _entries.clear();
+    _cells.clear();
+    _heroes.clear();
+    _farSlice.clear();
+}
+
+glm::ivec3 AvatarSpatialGrid::cellOf(const glm::vec3& position) const {
+    return glm::ivec3(glm::floor(position / _cellSize));
+}
+
+uint64_t AvatarSpatialGrid::keyOf(const glm::ivec3& cell) {
+    // 21 bits per axis is plenty: at the smallest sensible cell size it still covers the whole domain.
+    const int64_t BIAS = 1 << 20;
+    const uint64_t MASK = (1 << 21) - 1;
+    return ((uint64_t)(cell.x + BIAS) & MASK) |
+        (((uint64_t)(cell.y + BIAS) & MASK) << 21) |
+        (((uint64_t)(cell.z + BIAS) & MASK) << 42);
+}
+
+void AvatarSpatialGrid::build(ConstIter begin, ConstIter end, uint32_t frame) {
+    clear();
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        if (node->getType() != NodeType::Agent || !node->getLinkedData()) {
+            return;
+        }
+        auto nodeData = static_cast<const AvatarMixerClientData*>(node->getLinkedData());
+        const MixerAvatar* avatar = nodeData->getConstAvatarData();
+        glm::vec3 position = avatar->getClientGlobalPosition();
+        _entries.push_back({ node.data(), position, keyOf(cellOf(position)), avatar->getHasPriority() });
+    });
+
+    std::sort(_entries.begin(), _entries.end(), [](const Entry& a, const Entry& b) {
+        return a.cellKey < b.cellKey;
+    });
+
+    uint32_t numEntries = (uint32_t)_entries.size();
+    uint32_t cellBegin = 0;
+    for (uint32_t i = 0; i < numEntries; ++i) {
+        const Entry& entry = _entries[i];
+        if (i + 1 == numEntries || _entries[i + 1].cellKey != entry.cellKey) {
+            _cells[entry.cellKey] = { cellBegin, i + 1 };
+            cellBegin = i + 1;
+        }
+
+        if (entry.isHero) {
+            _heroes.push_back(i);
+        } else if ((entry.node->getLocalID() + frame) % (uint32_t)_farUpdateInterval == 0) {
+            _farSlice.push_back(i);
+        }
+    }
+}
+
+void AvatarSpatialGrid::query(const std::vector<glm::vec3>& positions, Candidates& candidates) const {
+    const float radiusSquared = _cellSize * _cellSize;
+
+    std::vector<uint32_t> nearIndices;
+    for (const auto& position : positions) {
+        glm::ivec3 center = cellOf(position);
+        for (int x = -1; x <= 1; ++x) {
+            for (int y = -1; y <= 1; ++y) {
+                for (int z = -1; z <= 1; ++z) {
+                    auto cell = _cells.find(keyOf(center + glm::ivec3(x, y, z)));
+                    if (cell == _cells.end()) {
+                        continue;
+                    }
+                    for (uint32_t i = cell->second.begin; i < cell->second.end; ++i) {
+                        if (glm::distance2(_entries[i].position, position) <= radiusSquared) {
+                            nearIndices.push_back(i);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // overlapping views can visit the same cell more than once
+    std::sort(nearIndices.begin(), nearIndices.end());
+    nearIndices.erase(std::unique(nearIndices.begin(), nearIndices.end()), nearIndices.end());
+
+    candidates.nodes.reserve(candidates.nodes.size() + nearIndices.size() + _heroes.size() + _farSlice.size());
+    for (uint32_t i : nearIndices) {
+        candidates.nodes.push_back(_entries[i].node);
+    }
+    candidates.numNear += (int)nearIndices.size();
+
+    for (uint32_t i : _heroes) {
+        if (!std::binary_search(nearIndices.begin(), nearIndices.end(), i)) {
+            candidates.nodes.push_back(_entries[i].node);
+            ++candidates.numHeroes;
+        }
+    }
+
+    for (uint32_t i : _farSlice) {
+        if (!std::binary_search(nearIndices.begin(), nearIndices.end(), i)) {
+            candidates.nodes.push_back(_entries[i].node);
+            ++candidates.numFar;
+        }
+    }
+}
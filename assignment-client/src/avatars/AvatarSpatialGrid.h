@@ -0,0 +1,82 @@
+//
+//  AvatarSpatialGrid.h
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarSpatialGrid_h
+#define hifi_AvatarSpatialGrid_h
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <NodeList.h>
+
+// Uniform grid of the avatars known to the mixer, rebuilt once per broadcast frame.
+//   Workers query it so that each listener only visits the avatars that are close to one of its views, plus
+//   priority (hero) avatars and a rotating slice of the distant ones, instead of scanning every node.
+//   The grid holds raw node pointers: it must only be built and queried while the node list is locked.
+class AvatarSpatialGrid {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    struct Candidates {
+        std::vector<Node*> nodes;
+        int numNear { 0 };
+        int numHeroes { 0 };
+        int numFar { 0 };
+    };
+
+    // A cell size of zero disables the grid; workers then fall back to scanning every node.
+    void setCellSize(float cellSize) { _cellSize = cellSize; }
+    float getCellSize() const { return _cellSize; }
+    bool isEnabled() const { return _cellSize > 0.0f; }
+
+    // Distant avatars are considered every farUpdateInterval frames, staggered by local ID.
+    void setFarUpdateInterval(int interval) { _farUpdateInterval = std::max(1, interval); }
+    int getFarUpdateInterval() const { return _farUpdateInterval; }
+
+    void build(ConstIter begin, ConstIter end, uint32_t frame);
+    void clear();
+
+    // Appends to candidates every avatar within the cell size of one of the given positions, all hero avatars and
+    // this frame's round-robin slice of the remaining ones. Each node appears at most once.
+    void query(const std::vector<glm::vec3>& positions, Candidates& candidates) const;
+
+    int getNumAvatars() const { return (int)_entries.size(); }
+    int getNumCells() const { return (int)_cells.size(); }
+
+private:
+    struct Entry {
+        Node* node;
+        glm::vec3 position;
+        uint64_t cellKey;
+        bool isHero;
+    };
+
+    struct CellRange {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    glm::ivec3 cellOf(const glm::vec3& position) const;
+    static uint64_t keyOf(const glm::ivec3& cell);
+
+    std::vector<Entry> _entries; // sorted by cell key
+    std::unordered_map<uint64_t, CellRange> _cells;
+    std::vector<uint32_t> _heroes;
+    std::vector<uint32_t> _farSlice; // this frame's round-robin share of the non-hero avatars
+
+    float _cellSize { 0.0f };
+    int _farUpdateInterval { 4 };
+};
+
+#endif // hifi_AvatarSpatialGrid_h
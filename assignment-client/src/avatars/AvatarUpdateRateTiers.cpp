@@ -0,0 +1,71 @@
+//
+//  AvatarUpdateRateTiers.cpp
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarUpdateRateTiers.h"
+
+#include <algorithm>
+
+#include <QtCore/QJsonObject>
+
+#include <AvatarLogging.h>
+#include <NumericalConstants.h>
+
+void AvatarUpdateRateTiers::parseSettings(const QJsonArray& rows, int framesPerSecond) {
+    static const QString MAX_DISTANCE = "max_distance";
+    static const QString RATE = "rate";
+    static const QString DETAIL = "detail";
+
+    _tiers.clear();
+    for (const auto& row : rows) {
+        QJsonObject rowObject = row.toObject();
+
+        bool distanceOK, rateOK;
+        float maxDistance = rowObject[MAX_DISTANCE].toVariant().toFloat(&distanceOK);
+        float rate = rowObject[RATE].toVariant().toFloat(&rateOK);
+        if (!distanceOK || !rateOK || maxDistance < 0.0f || rate <= 0.0f) {
+            qCWarning(avatars) << "Ignoring invalid avatar update rate tier" << rowObject;
+            continue;
+        }
+
+        Tier tier;
+        tier.maxDistance = maxDistance;
+        tier.rate = rate;
+        tier.detail = rowObject[DETAIL].toString() == detailToString(MinimalDetail) ? MinimalDetail : FullDetail;
+
+        // Avatars are only sent on mixer frames, so allow half a frame of slack to keep e.g. 15 Hz from aliasing
+        // down to every fourth frame.
+        float frameInterval = (float)USECS_PER_SECOND / (float)framesPerSecond;
+        float interval = (float)USECS_PER_SECOND / rate - 0.5f * frameInterval;
+        tier.minInterval = (uint64_t)std::max(0.0f, interval);
+
+        _tiers.push_back(tier);
+        if ((int)_tiers.size() == MAX_TIERS) {
+            qCWarning(avatars) << "Only the first" << MAX_TIERS << "avatar update rate tiers are used";
+            break;
+        }
+    }
+
+    std::stable_sort(_tiers.begin(), _tiers.end(), [](const Tier& a, const Tier& b) {
+        return a.maxDistance < b.maxDistance;
+    });
+}
+
+int AvatarUpdateRateTiers::findTier(float distance) const {
+    for (int i = 0; i < getFurthestTier(); ++i) {
+        if (distance <= _tiers[i].maxDistance) {
+            return i;
+        }
+    }
+    return getFurthestTier();
+}
+
+QString AvatarUpdateRateTiers::detailToString(Detail detail) {
+    return detail == MinimalDetail ? "minimal" : "full";
+}
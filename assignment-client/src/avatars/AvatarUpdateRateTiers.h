@@ -0,0 +1,61 @@
+//
+//  AvatarUpdateRateTiers.h
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarUpdateRateTiers_h
+#define hifi_AvatarUpdateRateTiers_h
+
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QString>
+
+// Level-of-detail tiers for the avatar data sent to each listener.
+//   Each tier covers the avatars up to a distance from the listener and limits how often, and with how much detail,
+//   they are sent. The furthest tier also covers everything beyond it, and the avatars the priority sort puts out of
+//   view. With no tiers every avatar is sent every frame, subject to the bandwidth budget.
+class AvatarUpdateRateTiers {
+public:
+    static const int MAX_TIERS = 8;
+
+    enum Detail {
+        FullDetail = 0, // joints, as sent without tiers
+        MinimalDetail   // position, orientation and scale only
+    };
+
+    struct Tier {
+        float maxDistance;
+        float rate; // Hz
+        Detail detail;
+        uint64_t minInterval; // usecs between sends
+    };
+
+    // Reads the "update_rate_tiers" table of the avatar mixer settings. Invalid rows are skipped.
+    void parseSettings(const QJsonArray& rows, int framesPerSecond);
+
+    bool isEnabled() const { return !_tiers.empty(); }
+    int getNumTiers() const { return (int)_tiers.size(); }
+    const Tier& getTier(int index) const { return _tiers[index]; }
+
+    int findTier(float distance) const;
+    int getFurthestTier() const { return (int)_tiers.size() - 1; }
+
+    // Whether an avatar last sent to a listener at lastEncodeTime is due again at now.
+    bool isDue(int tier, uint64_t lastEncodeTime, uint64_t now) const {
+        return now - lastEncodeTime >= _tiers[tier].minInterval;
+    }
+
+    static QString detailToString(Detail detail);
+
+private:
+    std::vector<Tier> _tiers; // sorted by distance
+};
+
+#endif // hifi_AvatarUpdateRateTiers_h
@@ -0,0 +1,138 @@
+//
+//  EncodedEntityCache.cpp
+//  assignment-client/src/entities
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EncodedEntityCache.h"
+
+#include <PortableHighResolutionClock.h>
+
+void EncodedEntityCache::setMaxSize(qint64 maxSize) {
+    _maxSize = std::max<qint64>(0, maxSize);
+    if (_maxSize == 0) {
+        clear();
+    }
+}
+
+EncodedEntityCache::Version EncodedEntityCache::getVersion(const EntityItem& entity) {
+    Version version;
+    version.lastEdited = entity.getLastEdited();
+    version.lastUpdated = entity.getLastUpdated();
+    version.lastSimulated = entity.getLastSimulated();
+    version.lastChangedOnServer = entity.getLastChangedOnServer();
+    return version;
+}
+
+OctreeElement::AppendState EncodedEntityCache::appendEntityData(const EntityItem& entity, OctreePacketData* packetData,
+                                                                EncodeBitstreamParams& params,
+                                                                EntityTreeElementExtraEncodeDataPointer extraEncodeData,
+                                                                bool destinationNodeCanGetAndSetPrivateUserData) {
+    const EntityItemID& entityID = entity.getEntityItemID();
+    if (!isEnabled() || (extraEncodeData && extraEncodeData->entities.contains(entityID))) {
+        // the rest of a partially sent entity
+        return entity.appendEntityData(packetData, params, extraEncodeData, destinationNodeCanGetAndSetPrivateUserData);
+    }
+
+    Version version = getVersion(entity);
+    int slot = destinationNodeCanGetAndSetPrivateUserData && !entity.getPrivateUserData().isEmpty() ? 1 : 0;
+    Shard& shard = getShard(entityID);
+
+    QByteArray encoded;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(entityID);
+        if (it != shard.entries.end() && it->version == version) {
+            encoded = it->encoded[slot];
+        }
+    }
+
+    if (!encoded.isEmpty()) {
+        if (packetData->appendRawData(encoded)) {
+            ++_hits;
+            params.trackSend(entity.getID(), version.lastEdited);
+            return OctreeElement::COMPLETED;
+        }
+        // it doesn't fit whole, encode what does fit
+        return entity.appendEntityData(packetData, params, extraEncodeData, destinationNodeCanGetAndSetPrivateUserData);
+    }
+
+    ++_misses;
+    auto encodeStart = p_high_resolution_clock::now();
+    int startOffset = packetData->getUncompressedByteOffset();
+    auto appendState = entity.appendEntityData(packetData, params, extraEncodeData, destinationNodeCanGetAndSetPrivateUserData);
+    int endOffset = packetData->getUncompressedByteOffset();
+    _encodeNsecs += std::chrono::duration_cast<std::chrono::nanoseconds>(p_high_resolution_clock::now() - encodeStart).count();
+    ++_numEncodes;
+
+    if (appendState != OctreeElement::COMPLETED || endOffset <= startOffset) {
+        return appendState;
+    }
+
+    encoded = QByteArray((const char*)packetData->getUncompressedData(startOffset), endOffset - startOffset);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(entityID);
+        if (it != shard.entries.end() && !(it->version == version)) {
+            _size -= getEntrySize(*it);
+            --_numEntries;
+            shard.entries.erase(it);
+            it = shard.entries.end();
+        }
+        qint64 replacedSize = it != shard.entries.end() ? it->encoded[slot].size() : 0;
+        if (_size + encoded.size() - replacedSize > _maxSize) {
+            // full, this entity keeps being encoded per viewer until space frees up
+            return appendState;
+        }
+        if (it == shard.entries.end()) {
+            it = shard.entries.insert(entityID, Entry { version, {} });
+            ++_numEntries;
+        }
+        _size += encoded.size() - replacedSize;
+        it->encoded[slot] = encoded;
+    }
+    return appendState;
+}
+
+void EncodedEntityCache::invalidate(const QUuid& entityID) {
+    Shard& shard = getShard(entityID);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(entityID);
+    if (it != shard.entries.end()) {
+        _size -= getEntrySize(*it);
+        --_numEntries;
+        shard.entries.erase(it);
+    }
+}
+
+void EncodedEntityCache::clear() {
+    for (auto& shard : _shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (const auto& entry : shard.entries) {
+            _size -= getEntrySize(entry);
+        }
+        _numEntries -= shard.entries.size();
+        shard.entries.clear();
+    }
+}
+
+EncodedEntityCache::Stats EncodedEntityCache::getStats() const {
+    const quint64 NSECS_PER_USEC = 1000;
+
+    Stats stats;
+    stats.hits = _hits;
+    stats.misses = _misses;
+    stats.encodeTime = _encodeNsecs / NSECS_PER_USEC;
+    quint64 numEncodes = _numEncodes;
+    if (numEncodes > 0) {
+        // each hit saved about one average encode
+        stats.encodeTimeSaved = (quint64)((double)_encodeNsecs / (double)numEncodes * (double)stats.hits) / NSECS_PER_USEC;
+    }
+    stats.size = _size;
+    stats.numEntries = _numEntries;
+    return stats;
+}
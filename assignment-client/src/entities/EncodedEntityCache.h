@@ -0,0 +1,102 @@
+//
+//  EncodedEntityCache.h
+//  assignment-client/src/entities
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EncodedEntityCache_h
+#define hifi_EncodedEntityCache_h
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QUuid>
+
+#include <EntityItem.h>
+
+// The entity bytes every send thread appends to its packets, shared between them so that an entity many viewers need
+// is encoded once per change rather than once per viewer. An encoding is reused while the entity's edit, update,
+// simulation and server change times are the ones it was made at, and is dropped as soon as the tree reports the
+// entity edited or deleted. Encodings that only partially fit a packet are never cached, those continue through
+// EntityTreeElementExtraEncodeData as before.
+//
+// Encodings are only made and used with the tree read locked and invalidated with it write locked, so an entry can't
+// go stale while a send thread is using it.
+class EncodedEntityCache {
+public:
+    static const int DEFAULT_MAX_SIZE_MB { 64 };
+
+    void setMaxSize(qint64 maxSize); // in bytes, 0 disables the cache
+    bool isEnabled() const { return _maxSize > 0; }
+
+    // Appends the entity to the packet, from the cache when possible, and otherwise like EntityItem::appendEntityData
+    OctreeElement::AppendState appendEntityData(const EntityItem& entity, OctreePacketData* packetData,
+                                                EncodeBitstreamParams& params,
+                                                EntityTreeElementExtraEncodeDataPointer extraEncodeData,
+                                                bool destinationNodeCanGetAndSetPrivateUserData);
+
+    void invalidate(const QUuid& entityID);
+    void clear();
+
+    struct Stats {
+        quint64 hits { 0 };
+        quint64 misses { 0 };
+        quint64 encodeTime { 0 }; // usecs spent encoding on misses
+        quint64 encodeTimeSaved { 0 }; // estimated, in usecs
+        qint64 size { 0 };
+        int numEntries { 0 };
+
+        float getHitRate() const { return hits + misses > 0 ? (float)hits / (float)(hits + misses) : 0.0f; }
+    };
+    Stats getStats() const;
+
+private:
+    // what the encoded bytes of an entity depend on, besides whether the viewer may see its private user data
+    struct Version {
+        quint64 lastEdited { 0 };
+        quint64 lastUpdated { 0 };
+        quint64 lastSimulated { 0 };
+        quint64 lastChangedOnServer { 0 };
+
+        bool operator==(const Version& other) const {
+            return lastEdited == other.lastEdited && lastUpdated == other.lastUpdated &&
+                lastSimulated == other.lastSimulated && lastChangedOnServer == other.lastChangedOnServer;
+        }
+    };
+
+    struct Entry {
+        Version version;
+        std::array<QByteArray, 2> encoded; // indexed by whether private user data is included, when the entity has any
+    };
+
+    // the entities are spread over shards so that send threads rarely wait on each other
+    struct Shard {
+        std::mutex mutex;
+        QHash<QUuid, Entry> entries;
+    };
+
+    static const int NUM_SHARDS { 16 };
+
+    Shard& getShard(const QUuid& entityID) { return _shards[qHash(entityID) % NUM_SHARDS]; }
+    static Version getVersion(const EntityItem& entity);
+    static qint64 getEntrySize(const Entry& entry) { return entry.encoded[0].size() + entry.encoded[1].size(); }
+
+    std::array<Shard, NUM_SHARDS> _shards;
+    std::atomic<qint64> _maxSize { (qint64)DEFAULT_MAX_SIZE_MB * 1024 * 1024 };
+    std::atomic<qint64> _size { 0 };
+    std::atomic<int> _numEntries { 0 };
+
+    std::atomic<quint64> _hits { 0 };
+    std::atomic<quint64> _misses { 0 };
+    std::atomic<quint64> _encodeNsecs { 0 };
+    std::atomic<quint64> _numEncodes { 0 };
+};
+
+#endif // hifi_EncodedEntityCache_h
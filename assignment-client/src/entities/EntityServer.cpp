@@ -105,6 +105,17 @@ OctreePointer EntityServer::createTree() {
         _entitySimulation = simpleSimulation;
     }
 
+    // emitted with the tree write locked, so no send thread is using the encodings being dropped
+    connect(tree.get(), &EntityTree::editingEntityPointer, this, [this](const EntityItemPointer& entity) {
+        _encodedEntityCache.invalidate(entity->getID());
+    }, Qt::DirectConnection);
+    connect(tree.get(), &EntityTree::deletingEntity, this, [this](const EntityItemID& entityID) {
+        _encodedEntityCache.invalidate(entityID);
+    }, Qt::DirectConnection);
+    connect(tree.get(), &EntityTree::clearingEntities, this, [this] {
+        _encodedEntityCache.clear();
+    }, Qt::DirectConnection);
+
     DependencyManager::registerInheritance<SpatialParentFinder, AssignmentParentFinder>();
     DependencyManager::set<AssignmentParentFinder>(tree);
     DependencyManager::set<EntityEditFilters>(std::static_pointer_cast<EntityTree>(tree));
@@ -112,6 +123,23 @@ OctreePointer EntityServer::createTree() {
     return tree;
 }
 
+void EntityServer::connectPersistJournal(const std::shared_ptr<OctreePersistJournal>& journal) {
+    EntityTreePointer tree = std::static_pointer_cast<EntityTree>(_tree);
+
+    // these are emitted with the tree locked, the journal only records the ID so the persist thread can fetch the
+    // entity's state on its next pass. The persist manager scopes the connections, and each holds on to the journal
+    // since the persist manager releases its own before they are disconnected.
+    connect(tree.get(), &EntityTree::addingEntity, _persistManager, [journal](const EntityItemID& entityID) {
+        journal->entityAdded(entityID);
+    }, Qt::DirectConnection);
+    connect(tree.get(), &EntityTree::editingEntityPointer, _persistManager, [journal](const EntityItemPointer& entity) {
+        journal->entityEdited(entity->getID());
+    }, Qt::DirectConnection);
+    connect(tree.get(), &EntityTree::deletingEntity, _persistManager, [journal](const EntityItemID& entityID) {
+        journal->entityDeleted(entityID);
+    }, Qt::DirectConnection);
+}
+
 OctreeServer::UniqueSendThread EntityServer::newSendThread(const SharedNodePointer& node) {
     return std::unique_ptr<EntityTreeSendThread>(new EntityTreeSendThread(this, node));
 }
@@ -328,6 +356,20 @@ void EntityServer::readAdditionalConfiguration(const QJsonObject& settingsSectio
     tree->setWantEditLogging(wantEditLogging);
     tree->setWantTerseEditLogging(wantTerseEditLogging);
 
+    int parallelFirstTraversalThreads;
+    if (readOptionInt("parallelFirstTraversalThreads", settingsSectionObject, parallelFirstTraversalThreads)) {
+        DiffTraversal::setNumParallelTraversalThreads(parallelFirstTraversalThreads);
+    } else {
+        DiffTraversal::setNumParallelTraversalThreads(0);
+    }
+
+    int encodedEntityCacheSize;
+    if (!readOptionInt("encodedEntityCacheSize", settingsSectionObject, encodedEntityCacheSize)) {
+        encodedEntityCacheSize = EncodedEntityCache::DEFAULT_MAX_SIZE_MB;
+    }
+    const qint64 BYTES_PER_MEGABYTE = 1024 * 1024;
+    _encodedEntityCache.setMaxSize((qint64)encodedEntityCacheSize * BYTES_PER_MEGABYTE);
+
     QString entityScriptSourceAllowlist;
     if (readOptionString("entityScriptSourceAllowlist", settingsSectionObject, entityScriptSourceAllowlist)) {
         tree->setEntityScriptSourceAllowlist(entityScriptSourceAllowlist);
@@ -405,6 +447,21 @@ QString EntityServer::serverSubclassStats() {
     statsString += QString("       EntityItem size... %1 bytes\r\n").arg(sizeof(EntityItem));
     statsString += "\r\n\r\n";
 
+    auto cacheStats = _encodedEntityCache.getStats();
+    statsString += "<b>Entity Server Encoded Entity Cache</b>\r\n";
+    if (_encodedEntityCache.isEnabled()) {
+        statsString += QString("   Hit rate:................. %1% (%2 hits, %3 misses)\r\n")
+            .arg((double)(cacheStats.getHitRate() * 100.0f), 0, 'f', 1)
+            .arg(cacheStats.hits).arg(cacheStats.misses);
+        statsString += QString("   Encode time:.............. %1 msecs\r\n").arg(cacheStats.encodeTime / USECS_PER_MSEC);
+        statsString += QString("   Encode time saved:........ %1 msecs (estimated)\r\n")
+            .arg(cacheStats.encodeTimeSaved / USECS_PER_MSEC);
+        statsString += QString("   Cached entities:.......... %1 (%2 bytes)\r\n").arg(cacheStats.numEntries).arg(cacheStats.size);
+    } else {
+        statsString += "    disabled... \r\n";
+    }
+    statsString += "\r\n\r\n";
+
     statsString += "<b>Entity Server Sending to Viewer Statistics</b>\r\n";
     statsString += "----- Viewer Node ID -----------------    ----- Entity ID ----------------------    "
                    "---------- Last Sent To ----------    ---------- Last Edited -----------\r\n";
@@ -22,6 +22,7 @@
 #include <EntityTree.h>
 #include <SimpleEntitySimulation.h>
 
+#include "EncodedEntityCache.h"
 #include "EntityServerConsts.h"
 
 /// Handles assignments of type EntityServer - sending entities to various clients.
@@ -58,9 +59,12 @@ public:
 
     virtual void trackSend(const QUuid& dataID, quint64 dataLastEdited, const QUuid& sessionID) override;
     virtual void trackViewerGone(const QUuid& sessionID) override;
+    virtual void connectPersistJournal(const std::shared_ptr<OctreePersistJournal>& journal) override;
 
     virtual void aboutToFinish() override;
 
+    EncodedEntityCache& getEncodedEntityCache() { return _encodedEntityCache; }
+
 public slots:
     virtual void nodeAdded(SharedNodePointer node) override;
     virtual void nodeKilled(SharedNodePointer node) override;
@@ -81,6 +85,8 @@ private:
 
     QReadWriteLock _viewerSendingStatsLock;
     QMap<QUuid, QMap<QUuid, ViewerSendingStats>> _viewerSendingStats;
+
+    EncodedEntityCache _encodedEntityCache;
 };
 
 #endif  // hifi_EntityServer_h
@@ -151,8 +151,19 @@ bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, O
         #else
         const uint64_t TIME_BUDGET = 200; // usec
         #endif
-        _traversal.traverse(TIME_BUDGET);
-        OctreeServer::trackTreeTraverseTime((float)(usecTimestampNow() - startTime));
+        if (_traversal.canTraverseInParallel()) {
+            // a new arrival: share the scan over the worker pool, still a time budget at a time
+            _traversal.traverseInParallel(_sendQueue, TIME_BUDGET);
+        } else {
+            _traversal.traverse(TIME_BUDGET);
+        }
+        quint64 endTime = usecTimestampNow();
+        OctreeServer::trackTreeTraverseTime((float)(endTime - startTime));
+
+        if (_firstTraversalStart > 0 && _traversal.finished()) {
+            OctreeServer::trackFirstTraversalTime((float)(endTime - _firstTraversalStart));
+            _firstTraversalStart = 0;
+        }
     }
 
     bool sendComplete = OctreeSendThread::traverseTreeAndSendContents(node, nodeData, viewFrustumChanged, isFullScene);
@@ -241,6 +252,7 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
         case DiffTraversal::First:
             // When we get to a First traversal, clear the _knownState
             _knownState.clear();
+            _firstTraversalStart = usecTimestampNow();
             _traversal.setScanCallback([this](DiffTraversal::VisibleElement& next) {
                 next.element->forEachEntity([&](EntityItemPointer entity) {
                     // Bail early if we've already checked this entity this frame
@@ -257,6 +269,7 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
             });
             break;
         case DiffTraversal::Repeat:
+            _firstTraversalStart = 0;
             _traversal.setScanCallback([this](DiffTraversal::VisibleElement& next) {
                 uint64_t startOfCompletedTraversal = _traversal.getStartOfCompletedTraversal();
                 if (next.element->getLastChangedContent() > startOfCompletedTraversal) {
@@ -288,6 +301,7 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
             break;
         case DiffTraversal::Differential:
             assert(view.usesViewFrustums());
+            _firstTraversalStart = 0;
             _traversal.setScanCallback([this] (DiffTraversal::VisibleElement& next) {
                 next.element->forEachEntity([&](EntityItemPointer entity) {
                     // Bail early if we've already checked this entity this frame
@@ -362,6 +376,7 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
     nodeData->stats.encodeStarted();
     auto entityNode = _node.toStrongRef();
     auto entityNodeData = static_cast<EntityNodeData*>(entityNode->getLinkedData());
+    auto& encodedEntityCache = static_cast<EntityServer*>(_myServer)->getEncodedEntityCache();
     EntityItemPointer lastEntity;
     while(!_sendQueue.empty()) {
         PrioritizedEntity queuedItem = _sendQueue.top();
@@ -379,7 +394,8 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
                     // Record explicitly filtered-in entity so that extra entities can be flagged.
                     entityNodeData->insertSentFilteredEntity(entityID);
                 }
-                OctreeElement::AppendState appendEntityState = entity->appendEntityData(&_packetData, params, _extraEncodeData, entityNode->getCanGetAndSetPrivateUserData());
+                OctreeElement::AppendState appendEntityState = encodedEntityCache.appendEntityData(*entity, &_packetData, params,
+                    _extraEncodeData, entityNode->getCanGetAndSetPrivateUserData());
 
                 if (appendEntityState != OctreeElement::COMPLETED) {
                     if (appendEntityState == OctreeElement::PARTIAL) {
@@ -0,0 +1,110 @@
+//
+//  MessagesFanOut.cpp
+//  assignment-client/src/messages
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MessagesFanOut.h"
+
+#include <algorithm>
+
+#include <NLPacketList.h>
+#include <NodeList.h>
+
+MessagesFanOutThread::MessagesFanOutThread(int index) {
+    setObjectName("Messages Fan-Out " + QString::number(index));
+}
+
+void MessagesFanOutThread::push(Job&& job) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back(std::move(job));
+    }
+    _condition.notify_one();
+}
+
+void MessagesFanOutThread::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _condition.notify_one();
+}
+
+void MessagesFanOutThread::run() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [&] { return _stop || !_jobs.empty(); });
+            if (_jobs.empty()) {
+                return; // stopping, with everything queued sent
+            }
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+        }
+
+        for (const auto& node : job.nodes) {
+            MessagesFanOut::sendTo(job.payload, *node);
+        }
+    }
+}
+
+void MessagesFanOut::setNumThreads(int numThreads) {
+    numThreads = std::max(0, numThreads);
+    if (numThreads == (int)_threads.size()) {
+        return;
+    }
+
+    // Stopped threads finish their queues first, so no message is lost or overtaken by one sent after it.
+    for (auto& thread : _threads) {
+        thread->stop();
+        thread->wait();
+    }
+    _threads.clear();
+
+    for (int i = 0; i < numThreads; ++i) {
+        _threads.emplace_back(new MessagesFanOutThread(i));
+        _threads.back()->start();
+    }
+}
+
+void MessagesFanOut::send(const QByteArray& payload, const std::vector<SharedNodePointer>& nodes) {
+    if (_threads.empty()) {
+        for (const auto& node : nodes) {
+            sendTo(payload, *node);
+        }
+        return;
+    }
+
+    std::vector<MessagesFanOutThread::Job> jobs(_threads.size());
+    for (const auto& node : nodes) {
+        auto& job = jobs[node->getLocalID() % _threads.size()];
+        if (job.nodes.empty()) {
+            job.payload = payload; // shared, not copied
+            job.nodes.reserve(nodes.size() / _threads.size() + 1);
+        }
+        job.nodes.push_back(node);
+    }
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        if (!jobs[i].nodes.empty()) {
+            _threads[i]->push(std::move(jobs[i]));
+        }
+    }
+}
+
+void MessagesFanOut::sendTo(const QByteArray& payload, const Node& node) {
+    if (!node.getActiveSocket()) {
+        return;
+    }
+
+    // reliable and ordered, so each node needs a packet list of its own
+    auto packetList = NLPacketList::create(PacketType::MessagesData, QByteArray(), true, true);
+    packetList->write(payload);
+    DependencyManager::get<NodeList>()->sendPacketList(std::move(packetList), node);
+}
@@ -0,0 +1,66 @@
+//
+//  MessagesFanOut.h
+//  assignment-client/src/messages
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MessagesFanOut_h
+#define hifi_MessagesFanOut_h
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QThread>
+
+#include <Node.h>
+
+class MessagesFanOutThread : public QThread {
+    Q_OBJECT
+public:
+    struct Job {
+        QByteArray payload;
+        std::vector<SharedNodePointer> nodes;
+    };
+
+    MessagesFanOutThread(int index);
+
+    void push(Job&& job);
+    void stop();
+
+protected:
+    void run() override;
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<Job> _jobs;
+    bool _stop { false };
+};
+
+// Sends already encoded MessagesData payloads to their subscribers.
+//   With zero threads (the default) the payloads are sent on the calling thread. Otherwise each node is always sent its
+//   messages from the same thread, so that it still receives them in the order they were sent.
+class MessagesFanOut {
+public:
+    ~MessagesFanOut() { setNumThreads(0); }
+
+    void setNumThreads(int numThreads);
+    int getNumThreads() const { return (int)_threads.size(); }
+
+    void send(const QByteArray& payload, const std::vector<SharedNodePointer>& nodes);
+
+    static void sendTo(const QByteArray& payload, const Node& node);
+
+private:
+    std::vector<std::unique_ptr<MessagesFanOutThread>> _threads;
+};
+
+#endif // hifi_MessagesFanOut_h
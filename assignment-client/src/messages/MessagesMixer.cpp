@@ -14,6 +14,9 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QJsonObject>
 #include <QBuffer>
+
+#include <algorithm>
+
 #include <LogHandler.h>
 #include <MessagesClient.h>
 #include <NodeList.h>
@@ -35,20 +38,19 @@ MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(mess
 }
 
 void MessagesMixer::nodeKilled(SharedNodePointer killedNode) {
-    for (auto& channel : _channelSubscribers) {
-        channel.remove(killedNode->getUUID());
+    for (auto channel = _channelSubscribers.begin(); channel != _channelSubscribers.end();) {
+        auto& subscribers = channel.value();
+        subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), killedNode), subscribers.end());
+        if (subscribers.empty()) {
+            channel = _channelSubscribers.erase(channel);
+        } else {
+            ++channel;
+        }
     }
 }
 
 void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
-    QString channel, message;
-    QByteArray data;
-    QUuid senderID;
-    bool isText;
     auto senderUUID = senderNode->getUUID();
-    MessagesClient::decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
-
-    auto nodeList = DependencyManager::get<NodeList>();
 
     auto itr = _allSubscribers.find(senderUUID);
     if (itr == _allSubscribers.end()) {
@@ -59,30 +61,51 @@ void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessa
         *itr += 1;
     }
 
-    nodeList->eachMatchingNode(
-        [&](const SharedNodePointer& node)->bool {
-        return node->getActiveSocket() && _channelSubscribers[channel].contains(node->getUUID());
-    },
-        [&](const SharedNodePointer& node) {
+    // Well-formed messages are forwarded exactly as received, which is also how they would be re-encoded.
+    QByteArray payload = receivedMessage->getMessage();
+    QByteArray channelUtf8;
+    if (!MessagesClient::peekMessagesPacketChannel(payload, channelUtf8)) {
+        QString channel, message;
+        QByteArray data;
+        QUuid senderID;
+        bool isText;
+        MessagesClient::decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
+
         auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
                                    MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
-        nodeList->sendPacketList(std::move(packetList), *node);
-    });
+        packetList->closeCurrentPacket();
+        payload = packetList->getMessage();
+        channelUtf8 = channel.toUtf8();
+        ++_numReencodedMessages;
+    }
+
+    ++_numMessages;
+
+    auto subscribers = _channelSubscribers.constFind(channelUtf8);
+    if (subscribers == _channelSubscribers.constEnd()) {
+        return;
+    }
+
+    _numRecipients += (int)subscribers->size();
+    _numBytesCopied += (qint64)subscribers->size() * payload.size();
+    _fanOut.send(payload, *subscribers);
 }
 
 void MessagesMixer::handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    auto senderUUID = senderNode->getUUID();
-    QString channel = QString::fromUtf8(message->getMessage());
-
-    _channelSubscribers[channel] << senderUUID;
+    auto& subscribers = _channelSubscribers[message->getMessage()];
+    if (std::find(subscribers.begin(), subscribers.end(), senderNode) == subscribers.end()) {
+        subscribers.push_back(senderNode);
+    }
 }
 
 void MessagesMixer::handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    auto senderUUID = senderNode->getUUID();
-    QString channel = QString::fromUtf8(message->getMessage());
-
-    if (_channelSubscribers.contains(channel)) {
-        _channelSubscribers[channel].remove(senderUUID);
+    auto channel = _channelSubscribers.find(message->getMessage());
+    if (channel != _channelSubscribers.end()) {
+        auto& subscribers = channel.value();
+        subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), senderNode), subscribers.end());
+        if (subscribers.empty()) {
+            _channelSubscribers.erase(channel);
+        }
     }
 }
 
@@ -99,6 +122,23 @@ void MessagesMixer::sendStatsPacket() {
     });
 
     statsObject["messages"] = messagesMixerObject;
+
+    auto now = usecTimestampNow();
+    float elapsedSeconds = (float)(now - _lastStatsTime) / (float)USECS_PER_SECOND;
+    QJsonObject fanOutObject;
+    fanOutObject["threads"] = _fanOut.getNumThreads();
+    fanOutObject["channels"] = _channelSubscribers.size();
+    fanOutObject["messages_per_second"] = elapsedSeconds > 0.0f ? (float)_numMessages / elapsedSeconds : 0.0f;
+    fanOutObject["reencoded_messages_per_second"] = elapsedSeconds > 0.0f ? (float)_numReencodedMessages / elapsedSeconds : 0.0f;
+    fanOutObject["average_fan_out"] = _numMessages > 0 ? (float)_numRecipients / (float)_numMessages : 0.0f;
+    fanOutObject["average_bytes_copied_per_message"] = _numMessages > 0 ? (double)_numBytesCopied / (double)_numMessages : 0.0;
+    statsObject["fan_out"] = fanOutObject;
+
+    _lastStatsTime = now;
+    _numMessages = 0;
+    _numReencodedMessages = 0;
+    _numRecipients = 0;
+    _numBytesCopied = 0;
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(statsObject);
 }
 
@@ -129,6 +169,10 @@ void MessagesMixer::parseDomainServerSettings(const QJsonObject& domainSettings)
     const QString NODE_MESSAGES_PER_SECOND_KEY = "max_node_messages_per_second";
     QJsonValue maxMessagesPerSecondValue = messagesMixerGroupObject.value(NODE_MESSAGES_PER_SECOND_KEY);
     _maxMessagesPerSecond = maxMessagesPerSecondValue.toInt(DEFAULT_NODE_MESSAGES_PER_SECOND);
+
+    const QString FAN_OUT_THREADS_KEY = "fan_out_threads";
+    int fanOutThreads = messagesMixerGroupObject.value(FAN_OUT_THREADS_KEY).toVariant().toInt();
+    _fanOut.setNumThreads(fanOutThreads);
 }
 
 void MessagesMixer::processMaxMessagesContainer() {
@@ -15,10 +15,15 @@
 #ifndef hifi_MessagesMixer_h
 #define hifi_MessagesMixer_h
 
+#include <vector>
+
 #include <QtCore/QSharedPointer>
 
+#include <SharedUtil.h>
 #include <ThreadedAssignment.h>
 
+#include "MessagesFanOut.h"
+
 /// Handles assignments of type MessagesMixer - distribution of avatar data to various clients
 class MessagesMixer : public ThreadedAssignment {
     Q_OBJECT
@@ -42,13 +47,23 @@ private slots:
     void processMaxMessagesContainer();
 
 private:
-    QHash<QString, QSet<QUuid>> _channelSubscribers;
+    // subscribers by UTF-8 channel name, so that messages can be routed without decoding them
+    QHash<QByteArray, std::vector<SharedNodePointer>> _channelSubscribers;
     QHash<QUuid, int> _allSubscribers;
 
+    MessagesFanOut _fanOut;
+
     const int DEFAULT_NODE_MESSAGES_PER_SECOND = 1000;
     int _maxMessagesPerSecond { 0 };
 
     QTimer* _maxMessagesTimer { nullptr };
+
+    // stats since the last stats packet
+    quint64 _lastStatsTime { usecTimestampNow() };
+    int _numMessages { 0 };
+    int _numReencodedMessages { 0 };
+    int _numRecipients { 0 };
+    qint64 _numBytesCopied { 0 };
 };
 
 #endif // hifi_MessagesMixer_h
@@ -15,6 +15,7 @@
 #include <QJsonObject>
 #include <QTimer>
 
+#include <algorithm>
 #include <time.h>
 
 #include <AccountManager.h>
@@ -65,6 +66,7 @@ int OctreeServer::_shortTreeWait = 0;
 int OctreeServer::_noTreeWait = 0;
 
 SimpleMovingAverage OctreeServer::_averageTreeTraverseTime(MOVING_AVERAGE_SAMPLE_COUNTS);
+SimpleMovingAverage OctreeServer::_averageFirstTraversalTime(MOVING_AVERAGE_SAMPLE_COUNTS);
 
 SimpleMovingAverage OctreeServer::_averageNodeWaitTime(MOVING_AVERAGE_SAMPLE_COUNTS);
 
@@ -116,6 +118,7 @@ void OctreeServer::resetSendingStats() {
     _noTreeWait = 0;
 
     _averageTreeTraverseTime.reset();
+    _averageFirstTraversalTime.reset();
 
     _averageNodeWaitTime.reset();
 
@@ -376,6 +379,27 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
                 statsString += QString("Persist file: %1\r\n").arg(_persistFilePath);
             }
 
+            if (isPersistEnabled()) {
+                auto persistStats = getPersistStats();
+                const float USECS_PER_MSEC = 1000.0f;
+                int numPersists = std::max(persistStats.numPersists, 1);
+                statsString += QString("Persist mode: %1\r\n")
+                    .arg(_persistManager->isJournalEnabled() ? "journal" : "snapshot");
+                statsString += QString("Last persist: %1 msecs, tree locked %2 msecs, %3 bytes\r\n")
+                    .arg(persistStats.lastPersistUsecs / USECS_PER_MSEC)
+                    .arg(persistStats.lastLockUsecs / USECS_PER_MSEC)
+                    .arg(persistStats.lastBytesWritten);
+                statsString += QString("Average persist: %1 msecs, tree locked %2 msecs over %3 persists\r\n")
+                    .arg(persistStats.totalPersistUsecs / numPersists / USECS_PER_MSEC)
+                    .arg(persistStats.totalLockUsecs / numPersists / USECS_PER_MSEC)
+                    .arg(persistStats.numPersists);
+                if (_persistManager->isJournalEnabled()) {
+                    statsString += QString("Journal compactions: %1, last took %2 msecs\r\n")
+                        .arg(persistStats.numCompactions)
+                        .arg(persistStats.lastCompactionUsecs / USECS_PER_MSEC);
+                }
+            }
+
         } else {
             statsString += "Octree file not yet loaded...\r\n";
         }
@@ -529,8 +553,11 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
 
         // traverse
         float averageTreeTraverseTime = getAverageTreeTraverseTime();
-        statsString += QString("          Average tree traverse time:    %1 usecs\r\n\r\n")
+        statsString += QString("          Average tree traverse time:    %1 usecs\r\n")
                                .arg((double)averageTreeTraverseTime, 9, 'f', 2);
+        float averageFirstTraversalTime = getAverageFirstTraversalTime();
+        statsString += QString("    Average first full traversal time:    %1 usecs\r\n\r\n")
+                               .arg((double)averageFirstTraversalTime, 9, 'f', 2);
 
         // encode
         float averageEncodeTime = getAverageEncodeTime();
@@ -1079,6 +1106,13 @@ void OctreeServer::readConfiguration() {
 
         _persistAsFileType = "json.gz";
 
+        bool persistBinarySnapshot = false;
+        readOptionBool(QString("persistBinarySnapshot"), settingsSectionObject, persistBinarySnapshot);
+        if (persistBinarySnapshot) {
+            _persistAsFileType = "bin";
+        }
+        qDebug() << "persistAsFileType=" << _persistAsFileType;
+
         _persistInterval = OctreePersistThread::DEFAULT_PERSIST_INTERVAL;
         int result { -1 };
         readOptionInt(QString("persistInterval"), settingsSectionObject, result);
@@ -1091,6 +1125,17 @@ void OctreeServer::readConfiguration() {
         readOptionBool(QString("persistFileDownload"), settingsSectionObject, _persistFileDownload);
         qDebug() << "persistFileDownload=" << _persistFileDownload;
 
+        readOptionBool(QString("persistJournal"), settingsSectionObject, _persistJournal);
+        qDebug() << "persistJournal=" << _persistJournal;
+
+        _persistCompactionInterval = OctreePersistThread::DEFAULT_COMPACTION_INTERVAL;
+        result = -1;
+        readOptionInt(QString("persistCompactionInterval"), settingsSectionObject, result);
+        if (result != -1) {
+            _persistCompactionInterval = std::chrono::milliseconds(result);
+        }
+        qDebug() << "persistCompactionInterval=" << _persistCompactionInterval.count();
+
     } else {
         qDebug("persistFilename= DISABLED");
     }
@@ -1219,6 +1264,12 @@ void OctreeServer::domainSettingsRequestComplete() {
         // now set up PersistThread
         _persistManager = new OctreePersistThread(_tree, _persistAbsoluteFilePath, _persistInterval, _debugTimestampNow,
                                                  _persistAsFileType);
+        if (_persistJournal) {
+            _persistManager->enableJournal(_persistCompactionInterval);
+            if (_persistManager->isJournalEnabled()) {
+                connectPersistJournal(_persistManager->getJournal());
+            }
+        }
         _persistManager->moveToThread(&_persistThread);
         connect(&_persistThread, &QThread::finished, _persistManager, &QObject::deleteLater);
         connect(&_persistThread, &QThread::started, _persistManager, [this] {
@@ -1467,6 +1518,24 @@ void OctreeServer::sendStatsPacket() {
     statsArray1["uptime_seconds"] = getUptimeSeconds();
     statsArray1["persistFileLoadTime_seconds"] = getFileLoadTimeSeconds();
 
+    if (isPersistEnabled()) {
+        auto persistStats = getPersistStats();
+        int numPersists = std::max(persistStats.numPersists, 1);
+        QJsonObject persistObject;
+        persistObject["1. journal"] = _persistManager->isJournalEnabled();
+        persistObject["2. persists"] = persistStats.numPersists;
+        persistObject["3. lastPersistUsecs"] = (double)persistStats.lastPersistUsecs;
+        persistObject["4. lastLockUsecs"] = (double)persistStats.lastLockUsecs;
+        persistObject["5. avgPersistUsecs"] = (double)(persistStats.totalPersistUsecs / numPersists);
+        persistObject["6. avgLockUsecs"] = (double)(persistStats.totalLockUsecs / numPersists);
+        persistObject["7. maxPersistUsecs"] = (double)persistStats.maxPersistUsecs;
+        persistObject["8. maxLockUsecs"] = (double)persistStats.maxLockUsecs;
+        persistObject["9. lastBytesWritten"] = (double)persistStats.lastBytesWritten;
+        persistObject["compactions"] = persistStats.numCompactions;
+        persistObject["lastCompactionUsecs"] = (double)persistStats.lastCompactionUsecs;
+        statsArray1["7. persist"] = persistObject;
+    }
+
     // Octree Stats
     QJsonObject octreeStats;
     octreeStats["1. elementCount"] = (double)OctreeElement::getNodeCount();
@@ -1490,6 +1559,7 @@ void OctreeServer::sendStatsPacket() {
     timingArray1["5. avgCompressAndWriteTime"] = getAverageCompressAndWriteTime();
     timingArray1["6. avgSendTime"] = getAveragePacketSendingTime();
     timingArray1["7. nodeWaitTime"] = getAverageNodeWaitTime();
+    timingArray1["8. avgFirstTraversalTime"] = getAverageFirstTraversalTime();
 
     QJsonObject statsObject2;
     statsObject2["data"] = dataObject1;
@@ -66,6 +66,9 @@ public:
     quint64 getLoadElapsedTime() const { return (_persistManager) ? _persistManager->getLoadElapsedTime() : 0; }
     QString getPersistFilename() const { return (_persistManager) ? _persistManager->getPersistFilename() : ""; }
     QString getPersistFileMimeType() const { return (_persistManager) ? _persistManager->getPersistFileMimeType() : "text/plain"; }
+    OctreePersistThread::PersistStats getPersistStats() const {
+        return (_persistManager) ? _persistManager->getPersistStats() : OctreePersistThread::PersistStats();
+    }
     QByteArray getPersistFileContents() const { return (_persistManager) ? _persistManager->getPersistFileContents() : QByteArray(); }
 
     // Subclasses must implement these methods
@@ -85,6 +88,7 @@ public:
     virtual QString serverSubclassStats() { return QString(); }
     virtual void trackSend(const QUuid& dataID, quint64 dataLastEdited, const QUuid& viewerNode) { }
     virtual void trackViewerGone(const QUuid& viewerNode) { }
+    virtual void connectPersistJournal(const std::shared_ptr<OctreePersistJournal>& journal) { }
 
     static float SKIP_TIME; // use this for trackXXXTime() calls for non-times
 
@@ -103,6 +107,10 @@ public:
     static void trackTreeTraverseTime(float time) { _averageTreeTraverseTime.updateAverage(time); }
     static float getAverageTreeTraverseTime() { return _averageTreeTraverseTime.getAverage(); }
 
+    // time from the start of a client's first traversal of the tree, when it connects or is reset, to its completion
+    static void trackFirstTraversalTime(float time) { _averageFirstTraversalTime.updateAverage(time); }
+    static float getAverageFirstTraversalTime() { return _averageFirstTraversalTime.getAverage(); }
+
     static void trackNodeWaitTime(float time) { _averageNodeWaitTime.updateAverage(time); }
     static float getAverageNodeWaitTime() { return _averageNodeWaitTime.getAverage(); }
 
@@ -198,6 +206,8 @@ protected:
 
     std::chrono::milliseconds _persistInterval;
     bool _persistFileDownload;
+    bool _persistJournal { false };
+    std::chrono::milliseconds _persistCompactionInterval { OctreePersistThread::DEFAULT_COMPACTION_INTERVAL };
     int _maxBackupVersions;
 
     time_t _started;
@@ -230,6 +240,7 @@ protected:
     static int _noTreeWait;
 
     static SimpleMovingAverage _averageTreeTraverseTime;
+    static SimpleMovingAverage _averageFirstTraversalTime;
 
     static SimpleMovingAverage _averageNodeWaitTime;
 
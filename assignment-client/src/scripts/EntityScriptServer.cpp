@@ -50,7 +50,10 @@ void messageHandler(QtMsgType type, const QMessageLogContext& context, const QSt
 
 int EntityScriptServer::_entitiesScriptEngineCount = 0;
 
-EntityScriptServer::EntityScriptServer(ReceivedMessage& message) : ThreadedAssignment(message) {
+EntityScriptServer::EntityScriptServer(ReceivedMessage& message) :
+    ThreadedAssignment(message),
+    _entityScriptShards(std::make_shared<EntityScriptShards>())
+{
     qInstallMessageHandler(messageHandler);
 
     DependencyManager::registerInheritance<EntityDynamicFactoryInterface, AssignmentDynamicFactory>();
@@ -141,8 +144,13 @@ void EntityScriptServer::handleEntityScriptGetStatusPacket(QSharedPointer<Receiv
             return;
         }
 
+        auto scriptManager = _entityScriptShards->find(entityID);
+        if (!scriptManager) {
+            return;
+        }
+
         EntityScriptDetails details;
-        if (_entitiesScriptManager->getEntityScriptDetails(entityID, entity->getServerScripts(), details)) {
+        if (scriptManager->getEntityScriptDetails(entityID, entity->getServerScripts(), details)) {
             replyPacketList->writePrimitive(true);
             replyPacketList->writePrimitive(details.status);
             replyPacketList->writeString(details.errorInfo);
@@ -182,6 +190,19 @@ void EntityScriptServer::handleSettings() {
         return;
     }
 
+    static const QString SCRIPT_SHARDS_OPTION = "script_shards";
+    int numScriptShards = std::max(1, std::min(EntityScriptShards::MAX_NUM_SHARDS,
+        entityScriptServerSettings[SCRIPT_SHARDS_OPTION].toInt(EntityScriptShards::DEFAULT_NUM_SHARDS)));
+    if (numScriptShards != _numScriptShards) {
+        qCInfo(entity_script_server) << "Running entity scripts in" << numScriptShards << "script engines";
+        _numScriptShards = numScriptShards;
+
+        // restart the scripts over the new number of engines
+        if (_entityScriptShards->getNumShards() > 0 && !_shuttingDown) {
+            clear();
+        }
+    }
+
     _maxEntityPPS = std::max(0, entityScriptServerSettings[MAX_ENTITY_PPS_OPTION].toInt());
     _entityPPSPerScript = std::max(0, entityScriptServerSettings[ENTITY_PPS_PER_SCRIPT].toInt());
 
@@ -190,7 +211,7 @@ void EntityScriptServer::handleSettings() {
 }
 
 void EntityScriptServer::updateEntityPPS() {
-    int numRunningScripts = _entitiesScriptManager->getNumRunningEntityScripts();
+    int numRunningScripts = _entityScriptShards->getNumRunningEntityScripts();
     int pps;
     if (std::numeric_limits<int>::max() / _entityPPSPerScript < numRunningScripts) {
         qWarning() << QString("Integer multiplication would overflow, clamping to maxint: %1 * %2").arg(numRunningScripts).arg(_entityPPSPerScript);
@@ -262,7 +283,7 @@ void EntityScriptServer::addLogEntry(const QString& message, const QString& file
 
 void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
 
-    if (_entitiesScriptManager && _entityViewer.getTree() && !_shuttingDown) {
+    if (_entityScriptShards->getNumShards() > 0 && _entityViewer.getTree() && !_shuttingDown) {
         auto entityID = QUuid::fromRfc4122(receivedMessage->read(NUM_BYTES_RFC4122_UUID));
 
         auto method = receivedMessage->readString();
@@ -276,7 +297,7 @@ void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<Recei
             params << paramString;
         }
 
-        _entitiesScriptManager->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
+        _entityScriptShards->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
     }
 }
 
@@ -472,7 +493,29 @@ void EntityScriptServer::selectAudioFormat(const QString& selectedCodecName) {
 }
 
 void EntityScriptServer::resetEntitiesScriptEngine() {
-    auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
+    for (const auto& manager : _entityScriptShards->getManagers()) {
+        disconnect(manager.get(), &ScriptManager::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
+    }
+
+    ++_entitiesScriptEngineCount;
+    std::vector<ScriptManagerPointer> managers;
+    for (int i = 0; i < _numScriptShards; ++i) {
+        managers.push_back(createEntitiesScriptManager(i));
+    }
+    _entityScriptShards->reset(managers);
+
+    // On the entity script server, these are the same
+    DependencyManager::get<EntityScriptingInterface>()->setPersistentEntitiesScriptEngine(_entityScriptShards);
+    DependencyManager::get<EntityScriptingInterface>()->setNonPersistentEntitiesScriptEngine(_entityScriptShards);
+
+    for (const auto& manager : managers) {
+        connect(manager.get(), &ScriptManager::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
+    }
+}
+
+ScriptManagerPointer EntityScriptServer::createEntitiesScriptManager(int shardIndex) {
+    auto engineName = _numScriptShards > 1 ? QString("about:Entities %1.%2").arg(_entitiesScriptEngineCount).arg(shardIndex)
+                                           : QString("about:Entities %1").arg(_entitiesScriptEngineCount);
     auto newManager = scriptManagerFactory(ScriptManager::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
     auto newEngine = newManager->engine();
 
@@ -516,38 +559,32 @@ void EntityScriptServer::resetEntitiesScriptEngine() {
                     addLogEntry(message, fileName, lineNumber, entityID, ScriptMessage::Severity::SEVERITY_WARNING);
                 });
 
-        connect(newManager.get(), &ScriptManager::update, this, [this] {
-            _entityViewer.queryOctree();
-            _entityViewer.getTree()->preUpdate();
-            _entityViewer.getTree()->update();
-        });
+        // the first shard's run loop drives the entity tree for all of them
+        if (shardIndex == 0) {
+            connect(newManager.get(), &ScriptManager::update, this, [this] {
+                _entityViewer.queryOctree();
+                _entityViewer.getTree()->preUpdate();
+                _entityViewer.getTree()->update();
+            });
+        }
 
         scriptEngines->runScriptInitializers(newManager);
     }
     newManager->runInThread();
-    std::shared_ptr<EntitiesScriptEngineProvider> newEngineSP = newManager;
-    // On the entity script server, these are the same
-    DependencyManager::get<EntityScriptingInterface>()->setPersistentEntitiesScriptEngine(newEngineSP);
-    DependencyManager::get<EntityScriptingInterface>()->setNonPersistentEntitiesScriptEngine(newEngineSP);
-
-    if (_entitiesScriptManager) {
-        disconnect(_entitiesScriptManager.get(), &ScriptManager::entityScriptDetailsUpdated,
-                   this, &EntityScriptServer::updateEntityPPS);
-    }
-
-    _entitiesScriptManager.swap(newManager);
-    connect(_entitiesScriptManager.get(), &ScriptManager::entityScriptDetailsUpdated,
-            this, &EntityScriptServer::updateEntityPPS);
+    return newManager;
 }
 
 
 void EntityScriptServer::clear() {
-    // unload and stop the engine
-    if (_entitiesScriptManager) {
+    // unload and stop the engines
+    auto managers = _entityScriptShards->getManagers();
+    for (const auto& manager : managers) {
         // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
-        _entitiesScriptManager->unloadAllEntityScripts();
-        _entitiesScriptManager->stop();
-        _entitiesScriptManager->waitTillDoneRunning();
+        manager->unloadAllEntityScripts();
+        manager->stop();
+    }
+    for (const auto& manager : managers) {
+        manager->waitTillDoneRunning();
     }
 
     _entityViewer.clear();
@@ -559,8 +596,8 @@ void EntityScriptServer::clear() {
 }
 
 void EntityScriptServer::shutdownScriptEngine() {
-    if (_entitiesScriptManager) {
-        _entitiesScriptManager->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+    for (const auto& manager : _entityScriptShards->getManagers()) {
+        manager->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
     }
     _shuttingDown = true;
 
@@ -569,7 +606,7 @@ void EntityScriptServer::shutdownScriptEngine() {
     auto scriptEngines = DependencyManager::get<ScriptEngines>();
     scriptEngines->shutdownScripting();
 
-    _entitiesScriptManager.reset();
+    _entityScriptShards->reset({});
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     // our entity tree is going to go away so tell that to the EntityScriptingInterface
@@ -590,9 +627,11 @@ void EntityScriptServer::addingEntity(const EntityItemID& entityID) {
 }
 
 void EntityScriptServer::deletingEntity(const EntityItemID& entityID) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptManager) {
-        // TODO: Check if this is running on script engine thread, otherwise lambda capturing script engine pointer is needed
-        _entitiesScriptManager->unloadAllEntityScriptsForEntity(entityID, true);
+    if (_entityViewer.getTree() && !_shuttingDown && _entityScriptShards->getNumShards() > 0) {
+        _entityScriptShards->invoke(entityID, [entityID](const ScriptManagerPointer& manager) {
+            manager->unloadAllEntityScriptsForEntity(entityID, true);
+        });
+        _entityScriptShards->unassign(entityID);
     }
 }
 
@@ -603,7 +642,7 @@ void EntityScriptServer::entityServerScriptChanging(const EntityItemID& entityID
 }
 
 void EntityScriptServer::checkAndCallPreload(const EntityItemID& entityID, const QString& oldScriptURL, const QString& newScriptURL) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptManager) {
+    if (_entityViewer.getTree() && !_shuttingDown && _entityScriptShards->getNumShards() > 0) {
 
         EntityItemPointer entity = _entityViewer.getTree()->findEntityByEntityItemID(entityID);
         if (!entity) {
@@ -611,20 +650,24 @@ void EntityScriptServer::checkAndCallPreload(const EntityItemID& entityID, const
         }
 
         EntityScriptDetails details;
-        bool isRunning = _entitiesScriptManager->getEntityScriptDetails(entityID, oldScriptURL, details);
+        bool isRunning = _entityScriptShards->find(entityID)->getEntityScriptDetails(entityID, oldScriptURL, details);
         bool reload = oldScriptURL == newScriptURL;
 
-        // TODO: Check if this is running on script engine thread, otherwise lambda capturing script engine pointer is needed
         if (isRunning) {
-            _entitiesScriptManager->unloadEntityScript(entityID, oldScriptURL, true);
+            _entityScriptShards->invoke(entityID, [entityID, oldScriptURL](const ScriptManagerPointer& manager) {
+                manager->unloadEntityScript(entityID, oldScriptURL, true);
+            });
         }
 
         if (!newScriptURL.isEmpty()) {
-            _entitiesScriptManager->loadEntityScript(
-                entityID,
-                DependencyManager::get<ResourceManager>()->normalizeURL(newScriptURL),
-                reload
-            );
+            // the user data may have moved the entity to another shard since its last script was loaded
+            _entityScriptShards->assign(entityID, entity->getUserData());
+            auto scriptURL = DependencyManager::get<ResourceManager>()->normalizeURL(newScriptURL);
+            _entityScriptShards->invoke(entityID, [entityID, scriptURL, reload](const ScriptManagerPointer& manager) {
+                manager->loadEntityScript(entityID, scriptURL, reload);
+            });
+        } else {
+            _entityScriptShards->unassign(entityID);
         }
     }
 }
@@ -639,12 +682,8 @@ void EntityScriptServer::sendStatsPacket() {
     statsObject["octree_stats"] = octreeStats;
 
     QJsonObject scriptEngineStats;
-    int numberRunningScripts = 0;
-    const auto scriptManager = _entitiesScriptManager;
-    if (scriptManager) {
-        numberRunningScripts = scriptManager->getNumRunningEntityScripts();
-    }
-    scriptEngineStats["number_running_scripts"] = numberRunningScripts;
+    scriptEngineStats["number_running_scripts"] = _entityScriptShards->getNumRunningEntityScripts();
+    scriptEngineStats["shards"] = _entityScriptShards->getStats();
     statsObject["script_engine_stats"] = scriptEngineStats;
 
 
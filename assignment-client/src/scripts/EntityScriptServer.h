@@ -31,6 +31,7 @@
 #include <QJsonArray>
 
 #include "../entities/EntityTreeHeadlessViewer.h"
+#include "EntityScriptShards.h"
 
 class EntityScriptServer : public ThreadedAssignment {
     Q_OBJECT
@@ -91,6 +92,7 @@ private:
     void selectAudioFormat(const QString& selectedCodecName);
 
     void resetEntitiesScriptEngine();
+    ScriptManagerPointer createEntitiesScriptManager(int shardIndex);
     void clear();
     void shutdownScriptEngine();
 
@@ -104,7 +106,8 @@ private:
     bool _shuttingDown { false };
 
     static int _entitiesScriptEngineCount;
-    ScriptManagerPointer _entitiesScriptManager;
+    std::shared_ptr<EntityScriptShards> _entityScriptShards;
+    int _numScriptShards { EntityScriptShards::DEFAULT_NUM_SHARDS };
     SimpleEntitySimulationPointer _entitySimulation;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
@@ -0,0 +1,192 @@
+//
+//  EntityScriptShards.cpp
+//  assignment-client/src/scripts
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "EntityScriptShards.h"
+
+#include <algorithm>
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMetaObject>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+const int EntityScriptShards::DEFAULT_NUM_SHARDS = 1;
+const int EntityScriptShards::MAX_NUM_SHARDS = 64;
+
+static const QString SCRIPT_AFFINITY_KEY = "scriptAffinity";
+
+template <typename T>
+static void updateMax(std::atomic<T>& max, T value) {
+    T current = max;
+    while (value > current && !max.compare_exchange_weak(current, value)) {
+    }
+}
+
+void EntityScriptShards::reset(std::vector<ScriptManagerPointer> managers) {
+    std::vector<Shard> shards;
+    for (auto& manager : managers) {
+        auto stats = std::make_shared<Stats>();
+
+        // update is emitted once per frame of the manager's run loop, on its thread
+        QObject::connect(manager.get(), &ScriptManager::update, manager.get(), [stats] {
+            quint64 now = usecTimestampNow();
+            quint64 lastTick = stats->lastTick.exchange(now);
+            if (lastTick > 0 && now > lastTick) {
+                quint64 interval = now - lastTick;
+                ++stats->numTicks;
+                stats->totalTickInterval += interval;
+                updateMax(stats->maxTickInterval, interval);
+            }
+        }, Qt::DirectConnection);
+
+        shards.push_back({ std::move(manager), stats });
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shards.swap(shards);
+    _assignments.clear();
+}
+
+int EntityScriptShards::getNumShards() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (int)_shards.size();
+}
+
+std::vector<ScriptManagerPointer> EntityScriptShards::getManagers() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<ScriptManagerPointer> managers;
+    for (const auto& shard : _shards) {
+        managers.push_back(shard.manager);
+    }
+    return managers;
+}
+
+QString EntityScriptShards::getAffinity(const QString& userData) {
+    if (!userData.contains(SCRIPT_AFFINITY_KEY)) {
+        return QString();
+    }
+    auto userDataObject = QJsonDocument::fromJson(userData.toUtf8()).object();
+    return userDataObject[SCRIPT_AFFINITY_KEY].toString();
+}
+
+int EntityScriptShards::getShardIndex(const EntityItemID& entityID) const {
+    auto it = _assignments.find(entityID);
+    if (it != _assignments.end()) {
+        return *it;
+    }
+    return (int)(qHash(entityID) % (uint)_shards.size());
+}
+
+ScriptManagerPointer EntityScriptShards::assign(const EntityItemID& entityID, const QString& userData) {
+    QString affinity = getAffinity(userData);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_shards.empty()) {
+        return nullptr;
+    }
+    int index = affinity.isEmpty() ? (int)(qHash(entityID) % (uint)_shards.size())
+                                   : (int)(qHash(affinity) % (uint)_shards.size());
+    _assignments[entityID] = index;
+    return _shards[index].manager;
+}
+
+void EntityScriptShards::unassign(const EntityItemID& entityID) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _assignments.remove(entityID);
+}
+
+ScriptManagerPointer EntityScriptShards::find(const EntityItemID& entityID) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_shards.empty()) {
+        return nullptr;
+    }
+    return _shards[getShardIndex(entityID)].manager;
+}
+
+void EntityScriptShards::invoke(const EntityItemID& entityID, std::function<void(const ScriptManagerPointer&)> function) {
+    Shard shard;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_shards.empty()) {
+            return;
+        }
+        shard = _shards[getShardIndex(entityID)];
+    }
+
+    updateMax(shard.stats->maxQueueDepth, ++shard.stats->queueDepth);
+    std::weak_ptr<ScriptManager> weakManager = shard.manager;
+    auto stats = shard.stats;
+    QMetaObject::invokeMethod(shard.manager.get(), [weakManager, stats, function] {
+        --stats->queueDepth;
+        if (auto manager = weakManager.lock()) {
+            function(manager);
+        }
+    }, Qt::QueuedConnection);
+}
+
+int EntityScriptShards::getNumRunningEntityScripts() const {
+    int numRunningScripts = 0;
+    for (const auto& manager : getManagers()) {
+        numRunningScripts += manager->getNumRunningEntityScripts();
+    }
+    return numRunningScripts;
+}
+
+QJsonObject EntityScriptShards::getStats() {
+    std::vector<Shard> shards;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        shards = _shards;
+    }
+
+    QJsonObject stats;
+    for (size_t i = 0; i < shards.size(); ++i) {
+        auto& shardStats = *shards[i].stats;
+        quint64 numTicks = shardStats.numTicks.exchange(0);
+        quint64 totalTickInterval = shardStats.totalTickInterval.exchange(0);
+        quint64 maxTickInterval = shardStats.maxTickInterval.exchange(0);
+        int maxQueueDepth = shardStats.maxQueueDepth.exchange(shardStats.queueDepth);
+
+        QJsonObject shardObject;
+        shardObject["number_running_scripts"] = shards[i].manager->getNumRunningEntityScripts();
+        shardObject["queue_depth"] = (int)shardStats.queueDepth;
+        shardObject["max_queue_depth"] = maxQueueDepth;
+        shardObject["ticks"] = (double)numTicks;
+        shardObject["avg_tick_ms"] = numTicks > 0 ? (float)totalTickInterval / (float)numTicks / USECS_PER_MSEC : 0.0f;
+        shardObject["max_tick_ms"] = (float)maxTickInterval / USECS_PER_MSEC;
+        stats[QString("shard_%1").arg(i)] = shardObject;
+    }
+    return stats;
+}
+
+void EntityScriptShards::callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                                const QStringList& params, const QUuid& remoteCallerID) {
+    invoke(entityID, [=](const ScriptManagerPointer& manager) {
+        manager->callEntityScriptMethod(entityID, methodName, params, remoteCallerID);
+    });
+}
+
+void EntityScriptShards::callEntityScriptMethodForScript(const EntityItemID& entityID, const QString& scriptURL,
+                                                         const QString& methodName, const QStringList& params,
+                                                         const QUuid& remoteCallerID) {
+    invoke(entityID, [=](const ScriptManagerPointer& manager) {
+        manager->callEntityScriptMethodForScript(entityID, scriptURL, methodName, params, remoteCallerID);
+    });
+}
+
+QFuture<QVariant> EntityScriptShards::getLocalEntityScriptDetails(const EntityItemID& entityID, const QString& scriptURL) {
+    auto manager = find(entityID);
+    if (!manager) {
+        return QFuture<QVariant>();
+    }
+    return manager->getLocalEntityScriptDetails(entityID, scriptURL);
+}
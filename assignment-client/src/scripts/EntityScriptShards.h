@@ -0,0 +1,87 @@
+//
+//  EntityScriptShards.h
+//  assignment-client/src/scripts
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_EntityScriptShards_h
+#define hifi_EntityScriptShards_h
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+
+#include <EntitiesScriptEngineProvider.h>
+#include <EntityItemID.h>
+#include <ScriptManager.h>
+
+// Spreads the entity scripts of the entity script server over several ScriptManagers, each with its own script engine
+// and thread, so that one heavy script only stalls the scripts that share its shard.
+//   An entity is assigned to a shard when its script is loaded, by the hash of its ID or, when its user data has a
+//   "scriptAffinity" string, by the hash of that string, so that scripts that expect to share an engine can. Calls into
+//   entity scripts, from the network or from other scripts through the Entities API, are routed to the owning shard.
+class EntityScriptShards : public EntitiesScriptEngineProvider {
+public:
+    static const int DEFAULT_NUM_SHARDS;
+    static const int MAX_NUM_SHARDS;
+
+    // the shards to route to, the entity assignments are cleared
+    void reset(std::vector<ScriptManagerPointer> managers);
+
+    int getNumShards() const;
+    std::vector<ScriptManagerPointer> getManagers() const;
+
+    // Assigns the entity to a shard for the script it is about to load, returns that shard's manager
+    ScriptManagerPointer assign(const EntityItemID& entityID, const QString& userData);
+    void unassign(const EntityItemID& entityID);
+
+    // The shard the entity is assigned to, or would be by default
+    ScriptManagerPointer find(const EntityItemID& entityID) const;
+
+    // Runs the function on the thread of the shard that owns the entity, after the work already queued for it
+    void invoke(const EntityItemID& entityID, std::function<void(const ScriptManagerPointer&)> function);
+
+    int getNumRunningEntityScripts() const;
+    QJsonObject getStats(); // resets the per period stats
+
+    void callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                const QStringList& params = QStringList(), const QUuid& remoteCallerID = QUuid()) override;
+    void callEntityScriptMethodForScript(const EntityItemID& entityID, const QString& scriptURL, const QString& methodName,
+                                         const QStringList& params = QStringList(), const QUuid& remoteCallerID = QUuid()) override;
+    QFuture<QVariant> getLocalEntityScriptDetails(const EntityItemID& entityID, const QString& scriptURL) override;
+
+    static QString getAffinity(const QString& userData);
+
+private:
+    struct Stats {
+        std::atomic<int> queueDepth { 0 };
+        std::atomic<int> maxQueueDepth { 0 };
+        std::atomic<quint64> lastTick { 0 };
+        std::atomic<quint64> numTicks { 0 };
+        std::atomic<quint64> totalTickInterval { 0 };
+        std::atomic<quint64> maxTickInterval { 0 };
+    };
+
+    struct Shard {
+        ScriptManagerPointer manager;
+        std::shared_ptr<Stats> stats;
+    };
+
+    int getShardIndex(const EntityItemID& entityID) const; // expects _mutex to be locked
+
+    mutable std::mutex _mutex;
+    std::vector<Shard> _shards;
+    QHash<EntityItemID, int> _assignments;
+};
+
+#endif // hifi_EntityScriptShards_h
@@ -13,6 +13,7 @@
 
 #include "DomainServer.h"
 
+#include <algorithm>
 #include <memory>
 #include <random>
 #include <iostream>
@@ -1291,6 +1292,11 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
     // client-side send time of last connect/domain list request
     nodeData->setLastDomainCheckinTimestamp(nodeRequestData.lastPingTimestamp);
 
+    // the last node list the node received whole
+    quint64 seenDomainListVersion = 0;
+    packetStream >> seenDomainListVersion;
+    nodeData->setSeenDomainListVersion(seenDomainListVersion);
+
     sendDomainListToNode(sendingNode, message->getFirstPacketReceiveTime(), message->getSenderSockAddr(), false);
 }
 
@@ -1377,12 +1383,48 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     const int NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES = NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID +
         NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID + 4;
 
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
+
+    // work out which nodes to send: everything that changed since the last list the node received whole, when we still
+    // have that, otherwise the whole list
+    auto& nodeInterestSet = nodeData->getNodeInterestSet();
+    quint64 version = 0;
+    quint64 baseVersion = 0;
+    DomainListJournal::Changes changes;
+
+    // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
+    if (nodeInterestSet.size() > 0 && nodeData->isAuthenticated()) {
+        updateDomainListJournal();
+        version = _domainListJournal.getVersion();
+
+        quint64 seenVersion = nodeData->getSeenDomainListVersion();
+        if (!newConnection && nodeData->getDomainListInterestSet() == nodeInterestSet &&
+                _domainListJournal.getChangesSince(seenVersion, changes)) {
+            baseVersion = seenVersion;
+        } else {
+            changes.changed = _domainListJournal.getNodes().keys().toVector();
+        }
+        nodeData->setDomainListInterestSet(nodeInterestSet);
+
+        // if this authenticated node has any interest types, send back those nodes as well
+        auto isOfInterest = [&](const QUuid& otherNodeID, NodeType_t otherNodeType) {
+            return otherNodeID != node->getUUID() && nodeInterestSet.contains(otherNodeType);
+        };
+        const auto& journaledNodes = _domainListJournal.getNodes();
+        changes.changed.erase(std::remove_if(changes.changed.begin(), changes.changed.end(), [&](const QUuid& otherNodeID) {
+            return !isOfInterest(otherNodeID, journaledNodes.value(otherNodeID).type);
+        }), changes.changed.end());
+        changes.removed.erase(std::remove_if(changes.removed.begin(), changes.removed.end(), [&](const QPair<QUuid, NodeType_t>& removed) {
+            return !isOfInterest(removed.first, removed.second);
+        }), changes.removed.end());
+    }
+    quint32 numRecords = (quint32)(changes.changed.size() + changes.removed.size());
+
     // setup the extended header for the domain list packets
     // this data is at the beginning of each of the domain list packets
     QByteArray extendedHeader(NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES, 0);
     QDataStream extendedHeaderStream(&extendedHeader, QIODevice::WriteOnly);
-    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
-    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
 
     extendedHeaderStream << limitedNodeList->getSessionUUID();
     extendedHeaderStream << limitedNodeList->getSessionLocalID();
@@ -1394,44 +1436,80 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     extendedHeaderStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
     extendedHeaderStream << quint64(duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count()) - requestPacketReceiveTime;
     extendedHeaderStream << newConnection;
+    extendedHeaderStream << version << baseVersion << numRecords;
     auto domainListPackets = NLPacketList::create(PacketType::DomainList, extendedHeader);
 
     // always send the node their own UUID back
     QDataStream domainListStream(domainListPackets.get());
 
-    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
-    auto& nodeInterestSet = nodeData->getNodeInterestSet();
-
-    if (nodeInterestSet.size() > 0) {
+    quint32 index = 0;
+    for (const auto& otherNodeID : changes.changed) {
+        // the connection secret needs the node itself, which may have gone since the journal was updated
+        auto otherNode = limitedNodeList->nodeWithUUID(otherNodeID);
 
-        // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
-        if (nodeData->isAuthenticated()) {
-            // if this authenticated node has any interest types, send back those nodes as well
-            limitedNodeList->eachNode([this, node, &domainListPackets, &domainListStream](const SharedNodePointer& otherNode) {
-                if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
-                    // since we're about to add a node to the packet we start a segment
-                    domainListPackets->startSegment();
+        // since we're about to add a node to the packet we start a segment
+        domainListPackets->startSegment();
 
-                    // don't send avatar nodes to other avatars, that will come from avatar mixer
-                    domainListStream << *otherNode.data();
+        domainListStream << index++;
+        if (otherNode) {
+            // don't send avatar nodes to other avatars, that will come from avatar mixer
+            domainListStream << DomainListRecord::Node;
+            domainListPackets->write(_domainListJournal.getNodes().value(otherNodeID).data);
 
-                    // pack the secret that these two nodes will use to communicate with each other
-                    domainListStream << connectionSecretForNodes(node, otherNode);
-
-                    // we've added the node we wanted so end the segment now
-                    domainListPackets->endSegment();
-                }
-            });
+            // pack the secret that these two nodes will use to communicate with each other
+            domainListStream << connectionSecretForNodes(node, otherNode);
+        } else {
+            domainListStream << DomainListRecord::RemovedNode << otherNodeID;
         }
+
+        // we've added the node we wanted so end the segment now
+        domainListPackets->endSegment();
+    }
+    for (const auto& removed : changes.removed) {
+        domainListPackets->startSegment();
+        domainListStream << index++ << DomainListRecord::RemovedNode << removed.first;
+        domainListPackets->endSegment();
     }
 
     // send an empty list to the node, in case there were no other nodes
     domainListPackets->closeCurrentPacket(true);
 
+    ++_numDomainListsSent;
+    if (baseVersion != 0) {
+        ++_numDeltaDomainListsSent;
+    }
+    _domainListBytesSent += domainListPackets->getDataSize();
+
     // write the PacketList to this node
     limitedNodeList->sendPacketList(std::move(domainListPackets), *node);
 }
 
+void DomainServer::updateDomainListJournal() {
+    // check-ins come in from every node every second, the journal catches up with the node list a few times a second
+    const quint64 DOMAIN_LIST_JOURNAL_UPDATE_INTERVAL_USECS = 100 * USECS_PER_MSEC;
+
+    quint64 now = usecTimestampNow();
+    if (now - _lastDomainListJournalUpdate < DOMAIN_LIST_JOURNAL_UPDATE_INTERVAL_USECS) {
+        return;
+    }
+    _lastDomainListJournalUpdate = now;
+
+    std::vector<SharedNodePointer> nodes;
+    DependencyManager::get<LimitedNodeList>()->eachNode([&nodes](const SharedNodePointer& node) {
+        nodes.push_back(node);
+    });
+    _domainListJournal.update(nodes);
+}
+
+QJsonObject DomainServer::getDomainListStats() const {
+    QJsonObject statsJSON;
+    statsJSON["version"] = (qint64)_domainListJournal.getVersion();
+    statsJSON["lists_sent"] = (qint64)_numDomainListsSent;
+    statsJSON["delta_lists_sent"] = (qint64)_numDeltaDomainListsSent;
+    statsJSON["bytes_per_check_in"] = _numDomainListsSent > 0 ? (double)_domainListBytesSent / (double)_numDomainListsSent : 0.0;
+    return statsJSON;
+}
+
 QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
     DomainServerNodeData* nodeAData = static_cast<DomainServerNodeData*>(nodeA->getLinkedData());
     DomainServerNodeData* nodeBData = static_cast<DomainServerNodeData*>(nodeB->getLinkedData());
@@ -2254,6 +2332,7 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             });
 
             rootJSON["nodes"] = nodesJSONArray;
+            rootJSON["domain_list"] = getDomainListStats();
 
             // print out the created JSON
             QJsonDocument nodesDocument(rootJSON);
@@ -25,6 +25,7 @@
 #include <QAbstractNativeEventFilter>
 
 #include <Assignment.h>
+#include <DomainListJournal.h>
 #include <HTTPSConnection.h>
 #include <LimitedNodeList.h>
 #include <shared/WebRTC.h>
@@ -190,6 +191,8 @@ private:
     void broadcastNodeDisconnect(const SharedNodePointer& disconnnectedNode);
 
     void sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const SockAddr& senderSockAddr, bool newConnection);
+    void updateDomainListJournal();
+    QJsonObject getDomainListStats() const;
 
     bool isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
 
@@ -298,6 +301,12 @@ private:
 
     DomainType _type { DomainType::NonMetaverse };
 
+    DomainListJournal _domainListJournal;
+    quint64 _lastDomainListJournalUpdate { 0 };
+    quint64 _numDomainListsSent { 0 };
+    quint64 _numDeltaDomainListsSent { 0 };
+    quint64 _domainListBytesSent { 0 };
+
     friend class DomainGatekeeper;
     friend class DomainMetadata;
 
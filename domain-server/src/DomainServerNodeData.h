@@ -49,6 +49,12 @@ public:
 
     const NodeSet& getNodeInterestSet() const { return _nodeInterestSet; }
     void setNodeInterestSet(const NodeSet& nodeInterestSet) { _nodeInterestSet = nodeInterestSet; }
+
+    // the last node list version the node received whole, and the interest set the lists sent to it were made for
+    quint64 getSeenDomainListVersion() const { return _seenDomainListVersion; }
+    void setSeenDomainListVersion(quint64 seenDomainListVersion) { _seenDomainListVersion = seenDomainListVersion; }
+    const NodeSet& getDomainListInterestSet() const { return _domainListInterestSet; }
+    void setDomainListInterestSet(const NodeSet& domainListInterestSet) { _domainListInterestSet = domainListInterestSet; }
     
     void setNodeVersion(const QString& nodeVersion) { _nodeVersion = nodeVersion; }
     const QString& getNodeVersion() { return _nodeVersion; }
@@ -90,6 +96,8 @@ private:
     SockAddr _sendingSockAddr;
     bool _isAuthenticated = true;
     NodeSet _nodeInterestSet;
+    quint64 _seenDomainListVersion { 0 };
+    NodeSet _domainListInterestSet;
     QString _nodeVersion;
     QString _hardwareAddress;
     QUuid   _machineFingerprint;
@@ -46,9 +46,11 @@
 #include <udt/PacketHeaders.h>
 #include <PathUtils.h>
 #include <PerfStat.h>
+#include <ScriptBindings.h>
 #include <ScriptEngine.h>
 #include <ScriptEngineCast.h>
 #include <ScriptEngineLogging.h>
+#include <ScriptManager.h>
 #include <SharedUtil.h>
 #include <SoundCache.h>
 #include <ModelEntityItem.h>
@@ -80,6 +82,16 @@
 
 using namespace std;
 
+// the MyAvatar methods scripts call every frame
+STATIC_SCRIPT_TYPES_INITIALIZER((+[](ScriptManager* manager) {
+    SCRIPT_BINDING(MyAvatar, getHeadPosition);
+    SCRIPT_BINDING(MyAvatar, getEyePosition);
+    SCRIPT_BINDING(MyAvatar, getTargetAvatarPosition);
+    SCRIPT_BINDING(MyAvatar, getLeftHandPosition);
+    SCRIPT_BINDING(MyAvatar, getRightHandPosition);
+    SCRIPT_BINDING(AvatarData, getJointIndex);
+}));
+
 const float DEFAULT_REAL_WORLD_FIELD_OF_VIEW_DEGREES = 30.0f;
 
 const float YAW_SPEED_DEFAULT = 100.0f;   // degrees/sec
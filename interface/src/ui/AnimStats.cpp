@@ -109,6 +109,16 @@ void AnimStats::updateStats(bool force) {
     _networkGraphText = QString("Network Graph: %1").arg(networkGraphActive ? "enabled" : "disabled");
     emit networkGraphTextChanged();
 
+    // print the hit rates of the clip pose cache, which all avatars share
+    auto clipPoseStats = myAvatar->getSkeletonModel()->getRig().getClipPoseStats();
+    auto hitPercent = [](uint64_t hits, uint64_t misses) {
+        return QString::number(hits + misses > 0 ? (100.0 * hits) / (hits + misses) : 0.0, 'f', 1);
+    };
+    _clipCacheText = QString("Clip Cache: retarget %1% hits, samples %2% hits").
+        arg(hitPercent(clipPoseStats.numRetargetHits, clipPoseStats.numRetargetMisses)).
+        arg(hitPercent(clipPoseStats.numSampleHits, clipPoseStats.numSampleMisses));
+    emit clipCacheTextChanged();
+
     // update animation debug alpha values
     QStringList newAnimAlphaValues;
     qint64 now = usecTimestampNow();
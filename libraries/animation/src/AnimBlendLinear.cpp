@@ -87,19 +87,22 @@ void AnimBlendLinear::evaluateAndBlendChildren(const AnimVariantMap& animVars, c
         _poses = _children[prevPoseIndex]->evaluate(animVars, context, dt, triggersOut);
     } else {
         // need to eval and blend between two children.
-        auto prevPoses = _children[prevPoseIndex]->evaluate(animVars, context, dt, triggersOut);
-        auto nextPoses = _children[nextPoseIndex]->evaluate(animVars, context, dt, triggersOut);
+        const AnimPoseVec& prevPoses = _children[prevPoseIndex]->evaluate(animVars, context, dt, triggersOut);
+        const AnimPoseVec& nextPoses = _children[nextPoseIndex]->evaluate(animVars, context, dt, triggersOut);
 
         if (prevPoses.size() > 0 && prevPoses.size() == nextPoses.size()) {
-            _poses.resize(prevPoses.size());
+            _prevPoses.load(prevPoses);
 
             if (_blendType == AnimBlendType_Normal) {
-                ::blend(_poses.size(), &prevPoses[0], &nextPoses[0], alpha, &_poses[0]);
+                _nextPoses.load(nextPoses);
+                _blendedPoses.blend(_prevPoses, _nextPoses, alpha);
             } else if (_blendType == AnimBlendType_AddRelative) {
-                ::blendAdd(_poses.size(), &prevPoses[0], &nextPoses[0], alpha, &_poses[0]);
+                _nextPoses.load(nextPoses);
+                _blendedPoses.blendAdd(_prevPoses, _nextPoses, alpha);
             } else if (_blendType == AnimBlendType_AddAbsolute) {
                 // convert prev from relative to absolute
-                AnimPoseVec absPrev = prevPoses;
+                AnimPoseBuffer& absPrev = _blendedPoses;
+                absPrev = _prevPoses;
                 _skeleton->convertRelativePosesToAbsolute(absPrev);
 
                 // rotate the offset rotations from next into the parent relative frame of each joint.
@@ -112,14 +115,17 @@ void AnimBlendLinear::evaluateAndBlendChildren(const AnimVariantMap& animVars, c
 
                     // convert from a rotation that happens in the absolute space of the joint
                     // into a rotation that happens in the relative space of the joint.
-                    pose.rot() = glm::inverse(absPrev[i].rot()) * pose.rot() * absPrev[i].rot();
+                    glm::quat absPrevRot = absPrev.getPose(i).rot();
+                    pose.rot() = glm::inverse(absPrevRot) * pose.rot() * absPrevRot;
 
                     relOffsetPoses.push_back(pose);
                 }
+                _nextPoses.load(relOffsetPoses);
 
                 // then blend
-                ::blendAdd(_poses.size(), &prevPoses[0], &relOffsetPoses[0], alpha, &_poses[0]);
+                _blendedPoses.blendAdd(_prevPoses, _nextPoses, alpha);
             }
+            _blendedPoses.store(_poses);
         }
     }
 }
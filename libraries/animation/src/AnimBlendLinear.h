@@ -12,6 +12,7 @@
 #define hifi_AnimBlendLinear_h
 
 #include "AnimNode.h"
+#include "AnimPoseBuffer.h"
 
 // Linear blend between two AnimNodes.
 // the amount of blending is determined by the alpha parameter.
@@ -43,6 +44,11 @@ protected:
 
     AnimPoseVec _poses;
 
+    // scratch space for blending the children
+    AnimPoseBuffer _prevPoses;
+    AnimPoseBuffer _nextPoses;
+    AnimPoseBuffer _blendedPoses;
+
     float _alpha;
     AnimBlendType _blendType;
 
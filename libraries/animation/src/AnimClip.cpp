@@ -263,51 +263,52 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
     // poll network anim to see if it's finished loading yet.
     if (_blendType == AnimBlendType_Normal) {
         if (_networkAnim && _networkAnim->isLoaded() && _skeleton) {
-            // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
+            // loading is complete, copy & retarget animation, unless a clip on an identical skeleton already did.
+            auto networkAnim = _networkAnim;
+            auto skeleton = _skeleton;
+            auto animCache = DependencyManager::get<AnimationCache>();
+            _clipPoses = animCache->getClipPoses(getClipPosesKey(), *_skeleton, [networkAnim, skeleton] {
+                return copyAndRetargetFromNetworkAnim(networkAnim, skeleton);
+            });
 
             // we no longer need the actual animation resource anymore.
             _networkAnim.reset();
 
-            // mirrorAnim will be re-built on demand, if needed.
-            _mirrorAnim.clear();
-
             _poses.resize(_skeleton->getNumJoints());
         }
     } else {
         // an additive blend type
         if (_networkAnim && _networkAnim->isLoaded() && _baseNetworkAnim && _baseNetworkAnim->isLoaded() && _skeleton) {
-            // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
+            auto networkAnim = _networkAnim;
+            auto baseNetworkAnim = _baseNetworkAnim;
+            auto skeleton = _skeleton;
+            auto blendType = _blendType;
+            int baseFrame = (int)_baseFrame;
+            auto animCache = DependencyManager::get<AnimationCache>();
+            _clipPoses = animCache->getClipPoses(getClipPosesKey(), *_skeleton, [=] {
+                // copy & retarget animation and baseAnim!
+                auto anim = copyAndRetargetFromNetworkAnim(networkAnim, skeleton);
+                auto baseAnim = copyAndRetargetFromNetworkAnim(baseNetworkAnim, skeleton);
+
+                if (blendType == AnimBlendType_AddAbsolute) {
+                    bakeAbsoluteDeltaAnim(anim, baseAnim[baseFrame], skeleton);
+                } else {
+                    // AnimBlendType_AddRelative
+                    bakeRelativeDeltaAnim(anim, baseAnim[baseFrame]);
+                }
+                return anim;
+            });
 
             // we no longer need the actual animation resource anymore.
             _networkAnim.reset();
 
-            // mirrorAnim will be re-built on demand, if needed.
             // TODO: handle mirrored relative animations.
-            _mirrorAnim.clear();
 
             _poses.resize(_skeleton->getNumJoints());
-
-            // copy & retarget baseAnim!
-            auto baseAnim = copyAndRetargetFromNetworkAnim(_baseNetworkAnim, _skeleton);
-
-            if (_blendType == AnimBlendType_AddAbsolute) {
-                bakeAbsoluteDeltaAnim(_anim, baseAnim[(int)_baseFrame], _skeleton);
-            } else {
-                // AnimBlendType_AddRelative
-                bakeRelativeDeltaAnim(_anim, baseAnim[(int)_baseFrame]);
-            }
         }
     }
 
-    if (_anim.size()) {
-
-        // lazy creation of mirrored animation frames.
-        if (_mirrorFlag && _anim.size() != _mirrorAnim.size()) {
-            buildMirrorAnim();
-        }
-
+    if (_clipPoses && _clipPoses->getNumFrames() > 0) {
         int prevIndex = (int)glm::floor(_frame);
         int nextIndex;
         if (_loopFlag && _frame >= _endFrame) {
@@ -318,15 +319,14 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
 
         // It can be quite possible for the user to set _startFrame and _endFrame to
         // values before or past valid ranges.  We clamp the frames here.
-        int frameCount = (int)_anim.size();
+        int frameCount = (int)_clipPoses->getNumFrames();
         prevIndex = std::min(std::max(0, prevIndex), frameCount - 1);
         nextIndex = std::min(std::max(0, nextIndex), frameCount - 1);
 
-        const AnimPoseVec& prevFrame = _mirrorFlag ? _mirrorAnim[prevIndex] : _anim[prevIndex];
-        const AnimPoseVec& nextFrame = _mirrorFlag ? _mirrorAnim[nextIndex] : _anim[nextIndex];
-        float alpha = glm::fract(_frame);
-
-        ::blend(_poses.size(), &prevFrame[0], &nextFrame[0], alpha, &_poses[0]);
+        // mirrored frames are built on demand by the shared clip poses. A clip playing frames no other clip shares, such as
+        // those of an avatar of its own, samples them exactly rather than at the quantized frame the others would reuse.
+        bool isShared = _clipPoses.use_count() > 1;
+        _clipPoses->sample(prevIndex, nextIndex, glm::fract(_frame), _mirrorFlag, *_skeleton, _poses, isShared);
     }
 
     processOutputJoints(triggersOut);
@@ -341,15 +341,8 @@ void AnimClip::setCurrentFrameInternal(float frame) {
     _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame + _startFrame, dt, _loopFlag, _id, triggers);
 }
 
-void AnimClip::buildMirrorAnim() {
-    assert(_skeleton);
-
-    _mirrorAnim.clear();
-    _mirrorAnim.reserve(_anim.size());
-    for (auto& relPoses : _anim) {
-        _mirrorAnim.push_back(relPoses);
-        _skeleton->mirrorRelativePoses(_mirrorAnim.back());
-    }
+QString AnimClip::getClipPosesKey() const {
+    return _url + "|" + QString::number((int)_blendType) + "|" + _baseURL + "|" + QString::number((int)_baseFrame);
 }
 
 const AnimPoseVec& AnimClip::getPosesInternal() const {
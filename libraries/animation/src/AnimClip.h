@@ -61,7 +61,7 @@ protected:
 
     virtual void setCurrentFrameInternal(float frame) override;
 
-    void buildMirrorAnim();
+    QString getClipPosesKey() const;
 
     // for AnimDebugDraw rendering
     virtual const AnimPoseVec& getPosesInternal() const override;
@@ -71,9 +71,8 @@ protected:
 
     AnimPoseVec _poses;
 
-    // _anim[frame][joint]
-    std::vector<AnimPoseVec> _anim;
-    std::vector<AnimPoseVec> _mirrorAnim;
+    // the retargeted frames, shared with the clips playing the same animation on identical skeletons
+    AnimClipPosesPointer _clipPoses;
 
     QString _url;
     float _startFrame;
@@ -0,0 +1,422 @@
+//
+//  AnimPoseBuffer.cpp
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimPoseBuffer.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+#include <cstring>
+
+#include <GLMHelpers.h>
+
+// The kernels are written once as templates over a lane type, which is either a float or four floats in an SSE
+// register. Loops over whole buffers run on the wide type only, because the padding holds identity poses.
+
+namespace {
+
+using Pose = AnimPoseBuffer;
+
+inline float invSqrt(float value) {
+    return 1.0f / sqrtf(value);
+}
+
+inline float negateIfNegative(float value, float sign) {
+    return sign < 0.0f ? -value : value;
+}
+
+template <typename T>
+T loadLanes(const float* src);
+
+template <>
+inline float loadLanes<float>(const float* src) {
+    return *src;
+}
+
+inline void storeLanes(float* dst, float value) {
+    *dst = value;
+}
+
+template <typename T>
+T gatherLanes(const float* src, const int* indices);
+
+template <>
+inline float gatherLanes<float>(const float* src, const int* indices) {
+    return src[indices[0]];
+}
+
+inline void scatterLanes(float* dst, const int* indices, float value) {
+    dst[indices[0]] = value;
+}
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+struct Float4 {
+    Float4() {}
+    Float4(__m128 value) : v(value) {}
+    Float4(float value) : v(_mm_set1_ps(value)) {}
+    __m128 v;
+};
+
+inline Float4 operator+(Float4 a, Float4 b) { return _mm_add_ps(a.v, b.v); }
+inline Float4 operator-(Float4 a, Float4 b) { return _mm_sub_ps(a.v, b.v); }
+inline Float4 operator*(Float4 a, Float4 b) { return _mm_mul_ps(a.v, b.v); }
+inline Float4 operator/(Float4 a, Float4 b) { return _mm_div_ps(a.v, b.v); }
+inline Float4 operator-(Float4 a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+
+inline Float4 invSqrt(Float4 value) {
+    // not _mm_rsqrt_ps, its 12 bits of precision are visible once the poses are chained down a skeleton
+    return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(value.v));
+}
+
+inline Float4 negateIfNegative(Float4 value, Float4 sign) {
+    return _mm_xor_ps(value.v, _mm_and_ps(sign.v, _mm_set1_ps(-0.0f)));
+}
+
+template <>
+inline Float4 loadLanes<Float4>(const float* src) {
+    return _mm_loadu_ps(src);
+}
+
+inline void storeLanes(float* dst, Float4 value) {
+    _mm_storeu_ps(dst, value.v);
+}
+
+template <>
+inline Float4 gatherLanes<Float4>(const float* src, const int* indices) {
+    return _mm_setr_ps(src[indices[0]], src[indices[1]], src[indices[2]], src[indices[3]]);
+}
+
+inline void scatterLanes(float* dst, const int* indices, Float4 value) {
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, value.v);
+    dst[indices[0]] = lanes[0];
+    dst[indices[1]] = lanes[1];
+    dst[indices[2]] = lanes[2];
+    dst[indices[3]] = lanes[3];
+}
+
+using Lane = Float4;
+const size_t NUM_LANES = 4;
+
+#else
+
+using Lane = float;
+const size_t NUM_LANES = 1;
+
+#endif
+
+template <typename T>
+inline void normalizeRotation(T* pose) {
+    T invLength = invSqrt(pose[Pose::ROT_X] * pose[Pose::ROT_X] + pose[Pose::ROT_Y] * pose[Pose::ROT_Y] +
+                          pose[Pose::ROT_Z] * pose[Pose::ROT_Z] + pose[Pose::ROT_W] * pose[Pose::ROT_W]);
+    for (int i = Pose::ROT_X; i <= Pose::ROT_W; ++i) {
+        pose[i] = pose[i] * invLength;
+    }
+}
+
+// result = a * b, for quaternions stored as x, y, z, w
+template <typename T>
+inline void multiplyRotations(const T* a, const T* b, T* result) {
+    const T& ax = a[0]; const T& ay = a[1]; const T& az = a[2]; const T& aw = a[3];
+    const T& bx = b[0]; const T& by = b[1]; const T& bz = b[2]; const T& bw = b[3];
+    result[0] = aw * bx + ax * bw + ay * bz - az * by;
+    result[1] = aw * by - ax * bz + ay * bw + az * bx;
+    result[2] = aw * bz + ax * by - ay * bx + az * bw;
+    result[3] = aw * bw - ax * bx - ay * by - az * bz;
+}
+
+// result = q * v
+template <typename T>
+inline void rotateVector(const T* q, const T* v, T* result) {
+    // t = 2 * cross(q.xyz, v), result = v + q.w * t + cross(q.xyz, t)
+    T tx = T(2.0f) * (q[1] * v[2] - q[2] * v[1]);
+    T ty = T(2.0f) * (q[2] * v[0] - q[0] * v[2]);
+    T tz = T(2.0f) * (q[0] * v[1] - q[1] * v[0]);
+    result[0] = v[0] + q[3] * tx + (q[1] * tz - q[2] * ty);
+    result[1] = v[1] + q[3] * ty + (q[2] * tx - q[0] * tz);
+    result[2] = v[2] + q[3] * tz + (q[0] * ty - q[1] * tx);
+}
+
+template <typename T>
+inline void blendPoses(const T* a, const T* b, T alpha, T* result) {
+    for (int i = Pose::SCALE_X; i <= Pose::SCALE_Z; ++i) {
+        result[i] = a[i] + (b[i] - a[i]) * alpha;
+    }
+    for (int i = Pose::TRANS_X; i <= Pose::TRANS_Z; ++i) {
+        result[i] = a[i] + (b[i] - a[i]) * alpha;
+    }
+
+    // same as safeLerp()
+    T dot = a[Pose::ROT_X] * b[Pose::ROT_X] + a[Pose::ROT_Y] * b[Pose::ROT_Y] +
+            a[Pose::ROT_Z] * b[Pose::ROT_Z] + a[Pose::ROT_W] * b[Pose::ROT_W];
+    for (int i = Pose::ROT_X; i <= Pose::ROT_W; ++i) {
+        result[i] = a[i] + (negateIfNegative(b[i], dot) - a[i]) * alpha;
+    }
+    normalizeRotation(result);
+}
+
+template <typename T>
+inline void blendAddPoses(const T* a, const T* b, T alpha, T* result) {
+    const T ONE(1.0f);
+    for (int i = Pose::SCALE_X; i <= Pose::SCALE_Z; ++i) {
+        result[i] = a[i] * (ONE + (b[i] - ONE) * alpha);
+    }
+    for (int i = Pose::TRANS_X; i <= Pose::TRANS_Z; ++i) {
+        result[i] = a[i] + alpha * b[i];
+    }
+
+    // give the delta the same polarity as the identity quat, then lerp it from identity
+    T w = b[Pose::ROT_W];
+    T delta[4] = {
+        alpha * negateIfNegative(b[Pose::ROT_X], w),
+        alpha * negateIfNegative(b[Pose::ROT_Y], w),
+        alpha * negateIfNegative(b[Pose::ROT_Z], w),
+        ONE + (negateIfNegative(w, w) - ONE) * alpha
+    };
+    multiplyRotations(&a[Pose::ROT_X], delta, &result[Pose::ROT_X]);
+    normalizeRotation(result);
+}
+
+// child = parent * child
+template <typename T>
+inline void multiplyPoses(const T* parent, T* child) {
+    T rot[4];
+    multiplyRotations(&parent[Pose::ROT_X], &child[Pose::ROT_X], rot);
+
+    T scaledTrans[3] = {
+        parent[Pose::SCALE_X] * child[Pose::TRANS_X],
+        parent[Pose::SCALE_Y] * child[Pose::TRANS_Y],
+        parent[Pose::SCALE_Z] * child[Pose::TRANS_Z]
+    };
+    T trans[3];
+    rotateVector(&parent[Pose::ROT_X], scaledTrans, trans);
+
+    for (int i = 0; i < 3; ++i) {
+        child[Pose::SCALE_X + i] = parent[Pose::SCALE_X + i] * child[Pose::SCALE_X + i];
+        child[Pose::TRANS_X + i] = parent[Pose::TRANS_X + i] + trans[i];
+    }
+    for (int i = 0; i < 4; ++i) {
+        child[Pose::ROT_X + i] = rot[i];
+    }
+}
+
+// child = parent.inverse() * child
+template <typename T>
+inline void multiplyPosesByInverse(const T* parent, T* child) {
+    T invRot[4] = { -parent[Pose::ROT_X], -parent[Pose::ROT_Y], -parent[Pose::ROT_Z], parent[Pose::ROT_W] };
+    T rot[4];
+    multiplyRotations(invRot, &child[Pose::ROT_X], rot);
+
+    T offset[3] = {
+        child[Pose::TRANS_X] - parent[Pose::TRANS_X],
+        child[Pose::TRANS_Y] - parent[Pose::TRANS_Y],
+        child[Pose::TRANS_Z] - parent[Pose::TRANS_Z]
+    };
+    T trans[3];
+    rotateVector(invRot, offset, trans);
+
+    for (int i = 0; i < 3; ++i) {
+        child[Pose::SCALE_X + i] = child[Pose::SCALE_X + i] / parent[Pose::SCALE_X + i];
+        child[Pose::TRANS_X + i] = trans[i] / parent[Pose::SCALE_X + i];
+    }
+    for (int i = 0; i < 4; ++i) {
+        child[Pose::ROT_X + i] = rot[i];
+    }
+}
+
+template <typename T>
+inline void loadPose(const AnimPoseBuffer& buffer, size_t index, T* pose) {
+    for (int i = 0; i < Pose::NUM_COMPONENTS; ++i) {
+        pose[i] = loadLanes<T>(buffer.getComponent((Pose::Component)i) + index);
+    }
+}
+
+template <typename T>
+inline void storePose(AnimPoseBuffer& buffer, size_t index, const T* pose) {
+    for (int i = 0; i < Pose::NUM_COMPONENTS; ++i) {
+        storeLanes(buffer.getComponent((Pose::Component)i) + index, pose[i]);
+    }
+}
+
+template <typename T>
+inline void gatherPose(const AnimPoseBuffer& buffer, const int* indices, T* pose) {
+    for (int i = 0; i < Pose::NUM_COMPONENTS; ++i) {
+        pose[i] = gatherLanes<T>(buffer.getComponent((Pose::Component)i), indices);
+    }
+}
+
+template <typename T>
+inline void scatterPose(AnimPoseBuffer& buffer, const int* indices, const T* pose) {
+    for (int i = 0; i < Pose::NUM_COMPONENTS; ++i) {
+        scatterLanes(buffer.getComponent((Pose::Component)i), indices, pose[i]);
+    }
+}
+
+template <typename T, typename F>
+inline void multiplyGathered(AnimPoseBuffer& buffer, const int* parents, const int* children, F multiply) {
+    T parent[Pose::NUM_COMPONENTS];
+    T child[Pose::NUM_COMPONENTS];
+    gatherPose(buffer, parents, parent);
+    gatherPose(buffer, children, child);
+    multiply(parent, child);
+    scatterPose(buffer, children, child);
+}
+
+}
+
+void AnimPoseBuffer::resize(size_t numPoses) {
+    size_t stride = ((numPoses + LANE_WIDTH - 1) / LANE_WIDTH) * LANE_WIDTH;
+    if (stride != _stride) {
+        std::vector<float> data(NUM_COMPONENTS * stride);
+        for (int i = 0; i < NUM_COMPONENTS; ++i) {
+            float identity = (i <= SCALE_Z || i == ROT_W) ? 1.0f : 0.0f;
+            float* dst = data.data() + i * stride;
+            size_t numKept = std::min(_size, numPoses);
+            if (numKept > 0) {
+                memcpy(dst, _data.data() + i * _stride, numKept * sizeof(float));
+            }
+            std::fill(dst + numKept, dst + stride, identity);
+        }
+        _data.swap(data);
+        _stride = stride;
+    } else {
+        // keep the padding identity when shrinking, and start new poses at identity when growing
+        for (size_t j = std::min(_size, numPoses); j < std::max(_size, numPoses); ++j) {
+            setPose(j, AnimPose::identity);
+        }
+    }
+    _size = numPoses;
+}
+
+void AnimPoseBuffer::load(const AnimPoseVec& poses) {
+    resize(poses.size());
+    float* scaleX = getComponent(SCALE_X);
+    float* scaleY = getComponent(SCALE_Y);
+    float* scaleZ = getComponent(SCALE_Z);
+    float* rotX = getComponent(ROT_X);
+    float* rotY = getComponent(ROT_Y);
+    float* rotZ = getComponent(ROT_Z);
+    float* rotW = getComponent(ROT_W);
+    float* transX = getComponent(TRANS_X);
+    float* transY = getComponent(TRANS_Y);
+    float* transZ = getComponent(TRANS_Z);
+    for (size_t i = 0; i < _size; ++i) {
+        const AnimPose& pose = poses[i];
+        scaleX[i] = pose.scale().x;
+        scaleY[i] = pose.scale().y;
+        scaleZ[i] = pose.scale().z;
+        rotX[i] = pose.rot().x;
+        rotY[i] = pose.rot().y;
+        rotZ[i] = pose.rot().z;
+        rotW[i] = pose.rot().w;
+        transX[i] = pose.trans().x;
+        transY[i] = pose.trans().y;
+        transZ[i] = pose.trans().z;
+    }
+}
+
+void AnimPoseBuffer::store(AnimPoseVec& poses) const {
+    poses.resize(_size);
+    const float* scaleX = getComponent(SCALE_X);
+    const float* scaleY = getComponent(SCALE_Y);
+    const float* scaleZ = getComponent(SCALE_Z);
+    const float* rotX = getComponent(ROT_X);
+    const float* rotY = getComponent(ROT_Y);
+    const float* rotZ = getComponent(ROT_Z);
+    const float* rotW = getComponent(ROT_W);
+    const float* transX = getComponent(TRANS_X);
+    const float* transY = getComponent(TRANS_Y);
+    const float* transZ = getComponent(TRANS_Z);
+    for (size_t i = 0; i < _size; ++i) {
+        AnimPose& pose = poses[i];
+        pose.scale() = glm::vec3(scaleX[i], scaleY[i], scaleZ[i]);
+        pose.rot() = glm::quat(rotW[i], rotX[i], rotY[i], rotZ[i]);
+        pose.trans() = glm::vec3(transX[i], transY[i], transZ[i]);
+    }
+}
+
+AnimPose AnimPoseBuffer::getPose(size_t index) const {
+    assert(index < _size);
+    return AnimPose(glm::vec3(getComponent(SCALE_X)[index], getComponent(SCALE_Y)[index], getComponent(SCALE_Z)[index]),
+                    glm::quat(getComponent(ROT_W)[index], getComponent(ROT_X)[index],
+                              getComponent(ROT_Y)[index], getComponent(ROT_Z)[index]),
+                    glm::vec3(getComponent(TRANS_X)[index], getComponent(TRANS_Y)[index], getComponent(TRANS_Z)[index]));
+}
+
+void AnimPoseBuffer::setPose(size_t index, const AnimPose& pose) {
+    assert(index < _stride);
+    getComponent(SCALE_X)[index] = pose.scale().x;
+    getComponent(SCALE_Y)[index] = pose.scale().y;
+    getComponent(SCALE_Z)[index] = pose.scale().z;
+    getComponent(ROT_X)[index] = pose.rot().x;
+    getComponent(ROT_Y)[index] = pose.rot().y;
+    getComponent(ROT_Z)[index] = pose.rot().z;
+    getComponent(ROT_W)[index] = pose.rot().w;
+    getComponent(TRANS_X)[index] = pose.trans().x;
+    getComponent(TRANS_Y)[index] = pose.trans().y;
+    getComponent(TRANS_Z)[index] = pose.trans().z;
+}
+
+void AnimPoseBuffer::blend(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha) {
+    assert(a.size() == b.size());
+    resize(a.size());
+    Lane alphaLanes(alpha);
+    Lane aPose[NUM_COMPONENTS], bPose[NUM_COMPONENTS], result[NUM_COMPONENTS];
+    for (size_t i = 0; i < _stride; i += NUM_LANES) {
+        loadPose(a, i, aPose);
+        loadPose(b, i, bPose);
+        blendPoses(aPose, bPose, alphaLanes, result);
+        storePose(*this, i, result);
+    }
+}
+
+void AnimPoseBuffer::blendAdd(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha) {
+    assert(a.size() == b.size());
+    resize(a.size());
+    Lane alphaLanes(alpha);
+    Lane aPose[NUM_COMPONENTS], bPose[NUM_COMPONENTS], result[NUM_COMPONENTS];
+    for (size_t i = 0; i < _stride; i += NUM_LANES) {
+        loadPose(a, i, aPose);
+        loadPose(b, i, bPose);
+        blendAddPoses(aPose, bPose, alphaLanes, result);
+        storePose(*this, i, result);
+    }
+}
+
+void AnimPoseBuffer::mirror() {
+    // mirror about the x-axis without applying negative scale
+    const Component NEGATED[] = { ROT_Y, ROT_Z, TRANS_X };
+    for (Component component : NEGATED) {
+        float* values = getComponent(component);
+        for (size_t i = 0; i < _stride; i += NUM_LANES) {
+            storeLanes(values + i, -loadLanes<Lane>(values + i));
+        }
+    }
+}
+
+void AnimPoseBuffer::multiplyByParents(const int* parents, const int* children, size_t count) {
+    size_t i = 0;
+    for (; i + NUM_LANES <= count; i += NUM_LANES) {
+        multiplyGathered<Lane>(*this, parents + i, children + i, multiplyPoses<Lane>);
+    }
+    for (; i < count; ++i) {
+        multiplyGathered<float>(*this, parents + i, children + i, multiplyPoses<float>);
+    }
+}
+
+void AnimPoseBuffer::multiplyByInverseParents(const int* parents, const int* children, size_t count) {
+    size_t i = 0;
+    for (; i + NUM_LANES <= count; i += NUM_LANES) {
+        multiplyGathered<Lane>(*this, parents + i, children + i, multiplyPosesByInverse<Lane>);
+    }
+    for (; i < count; ++i) {
+        multiplyGathered<float>(*this, parents + i, children + i, multiplyPosesByInverse<float>);
+    }
+}
@@ -0,0 +1,75 @@
+//
+//  AnimPoseBuffer.h
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimPoseBuffer
+#define hifi_AnimPoseBuffer
+
+#include <vector>
+
+#include "AnimPose.h"
+
+// Structure-of-arrays storage for the poses of a skeleton. Each of the ten pose components has its own float array,
+// padded with identity poses to a multiple of four joints, so that the kernels below work on four joints at a time.
+//
+// Unlike AnimPose::operator*, which goes through matrices, the kernels compose scale, rotation and translation
+// directly. The results are the same for the uniformly scaled joints of avatar skeletons.
+class AnimPoseBuffer {
+public:
+    enum Component {
+        SCALE_X = 0,
+        SCALE_Y,
+        SCALE_Z,
+        ROT_X,
+        ROT_Y,
+        ROT_Z,
+        ROT_W,
+        TRANS_X,
+        TRANS_Y,
+        TRANS_Z,
+        NUM_COMPONENTS
+    };
+
+    static const size_t LANE_WIDTH = 4;
+
+    AnimPoseBuffer() {}
+    explicit AnimPoseBuffer(const AnimPoseVec& poses) { load(poses); }
+
+    size_t size() const { return _size; }
+    void resize(size_t numPoses); // new poses are set to identity
+
+    void load(const AnimPoseVec& poses);
+    void store(AnimPoseVec& poses) const;
+
+    AnimPose getPose(size_t index) const;
+    void setPose(size_t index, const AnimPose& pose);
+
+    const float* getComponent(Component component) const { return _data.data() + component * _stride; }
+    float* getComponent(Component component) { return _data.data() + component * _stride; }
+
+    // same as ::blend() and ::blendAdd() in AnimUtil, a and b must have the same size.
+    void blend(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha);
+    void blendAdd(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha);
+
+    // same as AnimPose::mirror() on every pose, without swapping left and right joints.
+    void mirror();
+
+    // poses[children[i]] = poses[parents[i]] * poses[children[i]], for count joints.
+    // None of the children may appear among the parents, as is the case for the joints at one depth of a skeleton.
+    void multiplyByParents(const int* parents, const int* children, size_t count);
+
+    // poses[children[i]] = poses[parents[i]].inverse() * poses[children[i]], with the same restriction.
+    void multiplyByInverseParents(const int* parents, const int* children, size_t count);
+
+private:
+    size_t _size { 0 };
+    size_t _stride { 0 };
+    std::vector<float> _data;
+};
+
+#endif
@@ -10,6 +10,10 @@
 
 #include "AnimSkeleton.h"
 
+#include <assert.h>
+
+#include <QCryptographicHash>
+
 #include <glm/gtx/transform.hpp>
 
 #include <GLMHelpers.h>
@@ -27,6 +31,7 @@ AnimSkeleton::AnimSkeleton(const HFMModel& hfmModel) {
         joints.push_back(joint);
     }
     buildSkeletonFromJoints(joints, hfmModel.jointRotationOffsets);
+    buildFingerprint();
 
     // we make a copy of the inverseBindMatrices in order to prevent mutating the model bind pose
     // when we are dealing with a joint offset in the model
@@ -59,6 +64,7 @@ AnimSkeleton::AnimSkeleton(const HFMModel& hfmModel) {
 
 AnimSkeleton::AnimSkeleton(const std::vector<HFMJoint>& joints, const QMap<int, glm::quat> jointOffsets) {
     buildSkeletonFromJoints(joints, jointOffsets);
+    buildFingerprint();
 }
 
 int AnimSkeleton::nameToJointIndex(const QString& jointName) const {
@@ -203,6 +209,54 @@ void AnimSkeleton::mirrorAbsolutePoses(AnimPoseVec& poses) const {
     }
 }
 
+void AnimSkeleton::convertRelativePosesToAbsolute(AnimPoseBuffer& poses) const {
+    assert((int)poses.size() == _jointsSize);
+    // every joint at a given depth only depends on joints above it, which are already absolute
+    for (size_t d = 0; d + 1 < _depthOffsets.size(); ++d) {
+        size_t offset = _depthOffsets[d];
+        poses.multiplyByParents(&_parentsByDepth[offset], &_jointsByDepth[offset], _depthOffsets[d + 1] - offset);
+    }
+}
+
+void AnimSkeleton::convertAbsolutePosesToRelative(AnimPoseBuffer& poses) const {
+    assert((int)poses.size() == _jointsSize);
+    // deepest joints first, so that the parents are still absolute when their children are converted
+    for (size_t d = _depthOffsets.size() - 1; d > 0; --d) {
+        size_t offset = _depthOffsets[d - 1];
+        poses.multiplyByInverseParents(&_parentsByDepth[offset], &_jointsByDepth[offset], _depthOffsets[d] - offset);
+    }
+}
+
+void AnimSkeleton::mirrorRelativePoses(AnimPoseBuffer& poses) const {
+    AnimPoseVec nonMirroredPoses;
+    nonMirroredPoses.reserve(_nonMirroredIndices.size());
+    for (int index : _nonMirroredIndices) {
+        nonMirroredPoses.push_back(poses.getPose(index));
+    }
+
+    convertRelativePosesToAbsolute(poses);
+    mirrorAbsolutePoses(poses);
+    convertAbsolutePosesToRelative(poses);
+
+    for (size_t i = 0; i < _nonMirroredIndices.size(); ++i) {
+        poses.setPose(_nonMirroredIndices[i], nonMirroredPoses[i]);
+    }
+}
+
+void AnimSkeleton::mirrorAbsolutePoses(AnimPoseBuffer& poses) const {
+    poses.mirror();
+
+    // swap left and right
+    std::vector<float> temp(poses.size());
+    for (int c = 0; c < AnimPoseBuffer::NUM_COMPONENTS; ++c) {
+        float* values = poses.getComponent((AnimPoseBuffer::Component)c);
+        std::copy(values, values + poses.size(), temp.begin());
+        for (size_t i = 0; i < poses.size(); ++i) {
+            values[_mirrorMap[i]] = temp[i];
+        }
+    }
+}
+
 void AnimSkeleton::buildSkeletonFromJoints(const std::vector<HFMJoint>& joints, const QMap<int, glm::quat> jointOffsets) {
 
     _joints = joints;
@@ -215,6 +269,32 @@ void AnimSkeleton::buildSkeletonFromJoints(const std::vector<HFMJoint>& joints,
     }
 
     _jointsSize = (int)joints.size();
+
+    // group the joints by depth for the structure-of-arrays conversions
+    std::vector<int> depths(_jointsSize, 0);
+    int maxDepth = 0;
+    for (int i = 0; i < _jointsSize; i++) {
+        int parentIndex = _parentIndices[i];
+        // parents come before their children, as convertRelativePosesToAbsolute() already relies on
+        if (parentIndex != INVALID_JOINT_INDEX) {
+            depths[i] = depths[parentIndex] + 1;
+            maxDepth = std::max(maxDepth, depths[i]);
+        }
+    }
+    _jointsByDepth.clear();
+    _parentsByDepth.clear();
+    _depthOffsets.clear();
+    for (int depth = 1; depth <= maxDepth; depth++) {
+        _depthOffsets.push_back(_jointsByDepth.size());
+        for (int i = 0; i < _jointsSize; i++) {
+            if (depths[i] == depth) {
+                _jointsByDepth.push_back(i);
+                _parentsByDepth.push_back(_parentIndices[i]);
+            }
+        }
+    }
+    _depthOffsets.push_back(_jointsByDepth.size());
+
     // build a cache of bind poses
 
     // build a chache of default poses
@@ -296,6 +376,20 @@ void AnimSkeleton::buildSkeletonFromJoints(const std::vector<HFMJoint>& joints,
     }
 }
 
+void AnimSkeleton::buildFingerprint() {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    for (int i = 0; i < _jointsSize; i++) {
+        hash.addData(_joints[i].name.toUtf8());
+        hash.addData((const char*)&_parentIndices[i], sizeof(int));
+        const AnimPose& pose = _relativeDefaultPoses[i];
+        hash.addData((const char*)&pose.scale(), sizeof(glm::vec3));
+        hash.addData((const char*)&pose.rot(), sizeof(glm::quat));
+        hash.addData((const char*)&pose.trans(), sizeof(glm::vec3));
+    }
+    hash.addData((const char*)&_geometryOffset, sizeof(glm::mat4));
+    _fingerprint = hash.result();
+}
+
 void AnimSkeleton::dump(bool verbose) const {
     qCDebug(animation) << "[";
     for (int i = 0; i < getNumJoints(); i++) {
@@ -17,6 +17,7 @@
 
 #include <FBXSerializer.h>
 #include "AnimPose.h"
+#include "AnimPoseBuffer.h"
 
 class AnimSkeleton {
 public:
@@ -40,6 +41,9 @@ public:
     const AnimPoseVec& getAbsoluteDefaultPoses() const { return _absoluteDefaultPoses; }
     const glm::mat4& getGeometryOffset() const { return _geometryOffset; }
 
+    // identical for skeletons with the same joints, default poses and geometry offset, which retarget clips alike
+    const QByteArray& getFingerprint() const { return _fingerprint; }
+
     // get pre transform which should include FBX pre potations
     const AnimPose& getPreRotationPose(int jointIndex) const;
 
@@ -66,6 +70,13 @@ public:
     void mirrorRelativePoses(AnimPoseVec& poses) const;
     void mirrorAbsolutePoses(AnimPoseVec& poses) const;
 
+    // structure-of-arrays versions, which convert all the joints at one depth of the hierarchy together.
+    // poses must hold one pose per joint.
+    void convertRelativePosesToAbsolute(AnimPoseBuffer& poses) const;
+    void convertAbsolutePosesToRelative(AnimPoseBuffer& poses) const;
+    void mirrorRelativePoses(AnimPoseBuffer& poses) const;
+    void mirrorAbsolutePoses(AnimPoseBuffer& poses) const;
+
     void dump(bool verbose) const;
     void dump(const AnimPoseVec& poses) const;
 
@@ -74,10 +85,18 @@ public:
 
 protected:
     void buildSkeletonFromJoints(const std::vector<HFMJoint>& joints, const QMap<int, glm::quat> jointOffsets);
+    void buildFingerprint();
 
     std::vector<HFMJoint> _joints;
     std::vector<int> _parentIndices;
     int _jointsSize { 0 };
+
+    // the joints that have a parent, ordered by depth in the hierarchy, along with their parents.
+    // _depthOffsets[d] is where the joints at depth d + 1 start.
+    std::vector<int> _jointsByDepth;
+    std::vector<int> _parentsByDepth;
+    std::vector<size_t> _depthOffsets;
+
     AnimPoseVec _relativeDefaultPoses;
     AnimPoseVec _absoluteDefaultPoses;
     AnimPoseVec _relativePreRotationPoses;
@@ -88,6 +107,7 @@ protected:
     QHash<QString, int> _jointIndicesByName;
     std::vector<std::vector<HFMCluster>> _clusterBindMatrixOriginalValues;
     glm::mat4 _geometryOffset;
+    QByteArray _fingerprint;
 
     // no copies
     AnimSkeleton(const AnimSkeleton&) = delete;
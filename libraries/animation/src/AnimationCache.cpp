@@ -11,6 +11,8 @@
 
 #include "AnimationCache.h"
 
+#include <algorithm>
+
 #include <QRunnable>
 #include <QThreadPool>
 
@@ -20,6 +22,7 @@
 #include <Profile.h>
 
 #include "AnimationLogging.h"
+#include "AnimSkeleton.h"
 #include <FBXSerializer.h>
 
 int animationPointerMetaTypeId = qRegisterMetaType<AnimationPointer>();
@@ -44,6 +47,111 @@ QSharedPointer<Resource> AnimationCache::createResourceCopy(const QSharedPointer
     return QSharedPointer<Animation>(new Animation(*resource.staticCast<Animation>()), &Resource::deleter);
 }
 
+AnimClipPosesPointer AnimationCache::getClipPoses(const QString& clipKey, const AnimSkeleton& skeleton,
+                                                  const std::function<std::vector<AnimPoseVec>()>& retarget) {
+    QByteArray key = clipKey.toUtf8() + '\0' + skeleton.getFingerprint();
+    {
+        std::lock_guard<std::mutex> lock(_clipPosesMutex);
+        auto clipPoses = _clipPoses.value(key).lock();
+        if (clipPoses) {
+            ++_clipPoseCounters->numRetargetHits;
+            return clipPoses;
+        }
+    }
+
+    // retarget without holding the lock, it can take a while for long clips
+    ++_clipPoseCounters->numRetargetMisses;
+    std::vector<AnimPoseVec> frames = retarget();
+    auto clipPoses = std::make_shared<AnimClipPoses>(std::vector<AnimPoseBuffer>(frames.begin(), frames.end()), _clipPoseCounters);
+
+    std::lock_guard<std::mutex> lock(_clipPosesMutex);
+    auto existing = _clipPoses.value(key).lock();
+    if (existing) {
+        // another clip retargeted the same frames in the meantime
+        return existing;
+    }
+    for (auto iter = _clipPoses.begin(); iter != _clipPoses.end();) {
+        if (iter.value().expired()) {
+            iter = _clipPoses.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    _clipPoses.insert(key, clipPoses);
+    return clipPoses;
+}
+
+AnimationCache::ClipPoseStats AnimationCache::getClipPoseStats() const {
+    ClipPoseStats stats;
+    stats.numRetargetHits = _clipPoseCounters->numRetargetHits;
+    stats.numRetargetMisses = _clipPoseCounters->numRetargetMisses;
+    stats.numSampleHits = _clipPoseCounters->numSampleHits;
+    stats.numSampleMisses = _clipPoseCounters->numSampleMisses;
+    return stats;
+}
+
+AnimClipPoses::AnimClipPoses(std::vector<AnimPoseBuffer> frames, std::shared_ptr<AnimClipPoseCounters> counters) :
+    _frames(std::move(frames)),
+    _counters(counters)
+{
+    _samples.reserve(MAX_SAMPLES);
+}
+
+void AnimClipPoses::sample(int prevIndex, int nextIndex, float alpha, bool mirror, const AnimSkeleton& skeleton, AnimPoseVec& poses,
+                           bool isShared) {
+    int alphaStep = (int)glm::round(alpha * SAMPLES_PER_FRAME);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (mirror && _mirrorFrames.size() != _frames.size()) {
+        _mirrorFrames = _frames;
+        for (auto& frame : _mirrorFrames) {
+            skeleton.mirrorRelativePoses(frame);
+        }
+    }
+    const std::vector<AnimPoseBuffer>& frames = mirror ? _mirrorFrames : _frames;
+
+    if (!isShared) {
+        _blendedPoses.blend(frames[prevIndex], frames[nextIndex], alpha);
+        _blendedPoses.store(poses);
+        return;
+    }
+
+    ++_useCount;
+    for (auto& sample : _samples) {
+        if (sample.prevIndex == prevIndex && sample.nextIndex == nextIndex && sample.alphaStep == alphaStep && sample.mirror == mirror) {
+            sample.lastUsed = _useCount;
+            poses = sample.poses;
+            if (_counters) {
+                ++_counters->numSampleHits;
+            }
+            return;
+        }
+    }
+    if (_counters) {
+        ++_counters->numSampleMisses;
+    }
+
+    _blendedPoses.blend(frames[prevIndex], frames[nextIndex], (float)alphaStep / SAMPLES_PER_FRAME);
+    _blendedPoses.store(poses);
+
+    // keep the result, replacing the least recently used sample once full
+    Sample* slot;
+    if (_samples.size() < MAX_SAMPLES) {
+        _samples.emplace_back();
+        slot = &_samples.back();
+    } else {
+        slot = &*std::min_element(_samples.begin(), _samples.end(), [](const Sample& a, const Sample& b) {
+            return a.lastUsed < b.lastUsed;
+        });
+    }
+    slot->prevIndex = prevIndex;
+    slot->nextIndex = nextIndex;
+    slot->alphaStep = alphaStep;
+    slot->mirror = mirror;
+    slot->lastUsed = _useCount;
+    slot->poses = poses;
+}
+
 AnimationReader::AnimationReader(const QUrl& url, const QByteArray& data) :
     _url(url),
     _data(data) {
@@ -14,6 +14,12 @@
 #ifndef hifi_AnimationCache_h
 #define hifi_AnimationCache_h
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <QtCore/QRunnable>
 #include <QtCore/QSharedPointer>
 
@@ -21,10 +27,59 @@
 #include <hfm/HFM.h>
 #include <ResourceCache.h>
 
+#include "AnimPoseBuffer.h"
+
 class Animation;
+class AnimSkeleton;
 
 using AnimationPointer = QSharedPointer<Animation>;
 
+struct AnimClipPoseCounters {
+    std::atomic<uint64_t> numRetargetHits { 0 };
+    std::atomic<uint64_t> numRetargetMisses { 0 };
+    std::atomic<uint64_t> numSampleHits { 0 };
+    std::atomic<uint64_t> numSampleMisses { 0 };
+};
+
+// The frames of one clip retargeted to one skeleton, shared by every AnimClip that plays the clip on an identical
+// skeleton, along with the poses most recently sampled from them. While the frames are shared, clips playing the same
+// frame, quantized to 1 / SAMPLES_PER_FRAME, copy the poses sampled by the first of them.
+class AnimClipPoses {
+public:
+    static const int SAMPLES_PER_FRAME = 4;
+    static const size_t MAX_SAMPLES = 32;
+
+    AnimClipPoses(std::vector<AnimPoseBuffer> frames, std::shared_ptr<AnimClipPoseCounters> counters = nullptr);
+
+    size_t getNumFrames() const { return _frames.size(); }
+
+    // blends frames prevIndex and nextIndex into poses, unless another clip already did. Unless isShared, the frames are
+    // blended at alpha exactly, as there is no other clip to share the result with.
+    void sample(int prevIndex, int nextIndex, float alpha, bool mirror, const AnimSkeleton& skeleton, AnimPoseVec& poses,
+                bool isShared = true);
+
+private:
+    struct Sample {
+        int prevIndex;
+        int nextIndex;
+        int alphaStep;
+        bool mirror;
+        uint64_t lastUsed;
+        AnimPoseVec poses;
+    };
+
+    const std::vector<AnimPoseBuffer> _frames;
+    std::shared_ptr<AnimClipPoseCounters> _counters;
+
+    std::mutex _mutex;
+    std::vector<AnimPoseBuffer> _mirrorFrames; // built on first use
+    std::vector<Sample> _samples;
+    uint64_t _useCount { 0 };
+    AnimPoseBuffer _blendedPoses;
+};
+
+using AnimClipPosesPointer = std::shared_ptr<AnimClipPoses>;
+
 class AnimationCache : public ResourceCache, public Dependency  {
     Q_OBJECT
     SINGLETON_DEPENDENCY
@@ -34,6 +89,19 @@ public:
     Q_INVOKABLE AnimationPointer getAnimation(const QString& url) { return getAnimation(QUrl(url)); }
     Q_INVOKABLE AnimationPointer getAnimation(const QUrl& url);
 
+    // Returns the frames of the clip identified by clipKey retargeted to skeleton, shared with every other clip
+    // playing it on an identical skeleton. retarget is only called when no such clip exists.
+    AnimClipPosesPointer getClipPoses(const QString& clipKey, const AnimSkeleton& skeleton,
+                                      const std::function<std::vector<AnimPoseVec>()>& retarget);
+
+    struct ClipPoseStats {
+        uint64_t numRetargetHits { 0 };
+        uint64_t numRetargetMisses { 0 };
+        uint64_t numSampleHits { 0 };
+        uint64_t numSampleMisses { 0 };
+    };
+    ClipPoseStats getClipPoseStats() const;
+
 protected:
     virtual QSharedPointer<Resource> createResource(const QUrl& url) override;
     QSharedPointer<Resource> createResourceCopy(const QSharedPointer<Resource>& resource) override;
@@ -42,6 +110,10 @@ private:
     explicit AnimationCache(QObject* parent = NULL);
     virtual ~AnimationCache() { }
 
+    std::mutex _clipPosesMutex;
+    QHash<QByteArray, std::weak_ptr<AnimClipPoses>> _clipPoses;
+    std::shared_ptr<AnimClipPoseCounters> _clipPoseCounters { std::make_shared<AnimClipPoseCounters>() };
+
 };
 
 Q_DECLARE_METATYPE(AnimationPointer)
@@ -2772,6 +2772,10 @@ void Rig::computeAvatarBoundingCapsule(
     localOffsetOut = capsuleCenter - hipsPosition;
 }
 
+AnimationCache::ClipPoseStats Rig::getClipPoseStats() const {
+    return DependencyManager::get<AnimationCache>()->getClipPoseStats();
+}
+
 void Rig::initFlow(bool isActive) {
     _internalFlow.setActive(isActive);
     if (isActive) {
@@ -23,6 +23,7 @@
 #include <QReadWriteLock>
 #include <ScriptValue.h>
 
+#include "AnimationCache.h"
 #include "AnimNode.h"
 #include "AnimNodeLoader.h"
 #include "SimpleMovingAverage.h"
@@ -249,6 +250,7 @@ public:
     const AnimContext::DebugAlphaMap& getDebugAlphaMap() const { return _lastContext.getDebugAlphaMap(); }
     const AnimVariantMap& getAnimVars() const { return _lastAnimVars; }
     const AnimContext::DebugStateMachineMap& getStateMachineMap() const { return _lastContext.getStateMachineMap(); }
+    AnimationCache::ClipPoseStats getClipPoseStats() const; // shared by all rigs
     void initFlow(bool isActive);
     Flow& getFlow() { return _internalFlow; }
 
@@ -355,6 +355,160 @@ static void crossfade_4x2_SSE(float* src, float* dst, const float* win, int numF
     }
 }
 
+// process 2 cascaded biquads on 4 channels (interleaved), for 2 independent sources
+// the two recursions are interleaved to hide the latency of each
+static void biquad2_4x4x2_SSE(float* src0, float* src1, float coef0[5][8], float coef1[5][8],
+                              float state0[3][8], float state1[3][8], int numFrames) {
+
+    // enable flush-to-zero mode to prevent denormals
+    unsigned int ftz = _MM_GET_FLUSH_ZERO_MODE();
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+
+    // restore state
+    __m128 y00 = _mm_loadu_ps(&state0[0][0]);
+    __m128 w10 = _mm_loadu_ps(&state0[1][0]);
+    __m128 w20 = _mm_loadu_ps(&state0[2][0]);
+    __m128 y01;
+    __m128 w11 = _mm_loadu_ps(&state0[1][4]);
+    __m128 w21 = _mm_loadu_ps(&state0[2][4]);
+
+    __m128 z00 = _mm_loadu_ps(&state1[0][0]);
+    __m128 v10 = _mm_loadu_ps(&state1[1][0]);
+    __m128 v20 = _mm_loadu_ps(&state1[2][0]);
+    __m128 z01;
+    __m128 v11 = _mm_loadu_ps(&state1[1][4]);
+    __m128 v21 = _mm_loadu_ps(&state1[2][4]);
+
+    // first biquad coefs
+    __m128 b00 = _mm_loadu_ps(&coef0[0][0]);
+    __m128 b10 = _mm_loadu_ps(&coef0[1][0]);
+    __m128 b20 = _mm_loadu_ps(&coef0[2][0]);
+    __m128 a10 = _mm_loadu_ps(&coef0[3][0]);
+    __m128 a20 = _mm_loadu_ps(&coef0[4][0]);
+
+    __m128 d00 = _mm_loadu_ps(&coef1[0][0]);
+    __m128 d10 = _mm_loadu_ps(&coef1[1][0]);
+    __m128 d20 = _mm_loadu_ps(&coef1[2][0]);
+    __m128 c10 = _mm_loadu_ps(&coef1[3][0]);
+    __m128 c20 = _mm_loadu_ps(&coef1[4][0]);
+
+    // second biquad coefs
+    __m128 b01 = _mm_loadu_ps(&coef0[0][4]);
+    __m128 b11 = _mm_loadu_ps(&coef0[1][4]);
+    __m128 b21 = _mm_loadu_ps(&coef0[2][4]);
+    __m128 a11 = _mm_loadu_ps(&coef0[3][4]);
+    __m128 a21 = _mm_loadu_ps(&coef0[4][4]);
+
+    __m128 d01 = _mm_loadu_ps(&coef1[0][4]);
+    __m128 d11 = _mm_loadu_ps(&coef1[1][4]);
+    __m128 d21 = _mm_loadu_ps(&coef1[2][4]);
+    __m128 c11 = _mm_loadu_ps(&coef1[3][4]);
+    __m128 c21 = _mm_loadu_ps(&coef1[4][4]);
+
+    for (int i = 0; i < numFrames; i++) {
+
+        __m128 x00 = _mm_loadu_ps(&src0[4*i]);
+        __m128 x01 = y00;   // first biquad output
+        __m128 u00 = _mm_loadu_ps(&src1[4*i]);
+        __m128 u01 = z00;
+
+        // transposed Direct Form II
+        y00 = _mm_add_ps(w10, _mm_mul_ps(x00, b00));
+        y01 = _mm_add_ps(w11, _mm_mul_ps(x01, b01));
+        z00 = _mm_add_ps(v10, _mm_mul_ps(u00, d00));
+        z01 = _mm_add_ps(v11, _mm_mul_ps(u01, d01));
+
+        w10 = _mm_add_ps(w20, _mm_mul_ps(x00, b10));
+        w11 = _mm_add_ps(w21, _mm_mul_ps(x01, b11));
+        v10 = _mm_add_ps(v20, _mm_mul_ps(u00, d10));
+        v11 = _mm_add_ps(v21, _mm_mul_ps(u01, d11));
+
+        w20 = _mm_mul_ps(x00, b20);
+        w21 = _mm_mul_ps(x01, b21);
+        v20 = _mm_mul_ps(u00, d20);
+        v21 = _mm_mul_ps(u01, d21);
+
+        w10 = _mm_sub_ps(w10, _mm_mul_ps(y00, a10));
+        w11 = _mm_sub_ps(w11, _mm_mul_ps(y01, a11));
+        v10 = _mm_sub_ps(v10, _mm_mul_ps(z00, c10));
+        v11 = _mm_sub_ps(v11, _mm_mul_ps(z01, c11));
+
+        w20 = _mm_sub_ps(w20, _mm_mul_ps(y00, a20));
+        w21 = _mm_sub_ps(w21, _mm_mul_ps(y01, a21));
+        v20 = _mm_sub_ps(v20, _mm_mul_ps(z00, c20));
+        v21 = _mm_sub_ps(v21, _mm_mul_ps(z01, c21));
+
+        _mm_storeu_ps(&src0[4*i], y01);  // second biquad output (in-place)
+        _mm_storeu_ps(&src1[4*i], z01);
+    }
+
+    // save state
+    _mm_storeu_ps(&state0[0][0], y00);
+    _mm_storeu_ps(&state0[1][0], w10);
+    _mm_storeu_ps(&state0[2][0], w20);
+    _mm_storeu_ps(&state0[1][4], w11);
+    _mm_storeu_ps(&state0[2][4], w21);
+
+    _mm_storeu_ps(&state1[0][0], z00);
+    _mm_storeu_ps(&state1[1][0], v10);
+    _mm_storeu_ps(&state1[2][0], v20);
+    _mm_storeu_ps(&state1[1][4], v11);
+    _mm_storeu_ps(&state1[2][4], v21);
+
+    _MM_SET_FLUSH_ZERO_MODE(ftz);
+}
+
+// crossfade 4 inputs into 2 outputs, for 2 sources, with a single accumulation (interleaved)
+static void crossfade_4x2x2_SSE(float* src0, float* src1, float* dst, const float* win, int numFrames) {
+
+    assert(numFrames % 4 == 0);
+
+    for (int i = 0; i < numFrames; i += 4) {
+
+        __m128 f0 = _mm_loadu_ps(&win[i]);
+
+        __m128 y0 = _mm_loadu_ps(&dst[2*i+0]);
+        __m128 y1 = _mm_loadu_ps(&dst[2*i+4]);
+
+        float* src[2] = { src0, src1 };
+        for (int j = 0; j < 2; j++) {
+
+            __m128 x0 = _mm_loadu_ps(&src[j][4*i+0]);
+            __m128 x1 = _mm_loadu_ps(&src[j][4*i+4]);
+            __m128 x2 = _mm_loadu_ps(&src[j][4*i+8]);
+            __m128 x3 = _mm_loadu_ps(&src[j][4*i+12]);
+
+            // deinterleave (4x4 matrix transpose)
+            __m128 t0 = _mm_unpacklo_ps(x0, x1);
+            __m128 t2 = _mm_unpacklo_ps(x2, x3);
+            __m128 t1 = _mm_unpackhi_ps(x0, x1);
+            __m128 t3 = _mm_unpackhi_ps(x2, x3);
+
+            x0 = _mm_movelh_ps(t0, t2);
+            x1 = _mm_movehl_ps(t2, t0);
+            x2 = _mm_movelh_ps(t1, t3);
+            x3 = _mm_movehl_ps(t3, t1);
+
+            // crossfade
+            x0 = _mm_sub_ps(x0, x2);
+            x1 = _mm_sub_ps(x1, x3);
+            x2 = _mm_add_ps(x2, _mm_mul_ps(f0, x0));
+            x3 = _mm_add_ps(x3, _mm_mul_ps(f0, x1));
+
+            // interleave
+            x0 = _mm_unpacklo_ps(x2, x3);
+            x1 = _mm_unpackhi_ps(x2, x3);
+
+            // accumulate, in source order
+            y0 = _mm_add_ps(y0, x0);
+            y1 = _mm_add_ps(y1, x1);
+        }
+
+        _mm_storeu_ps(&dst[2*i+0], y0);
+        _mm_storeu_ps(&dst[2*i+4], y1);
+    }
+}
+
 // linear interpolation with gain
 static void interpolate_SSE(const float* src0, const float* src1, float* dst, float frac, float gain) {
 
@@ -385,6 +539,9 @@ void FIR_1x4_AVX512(float* src, float* dst0, float* dst1, float* dst2, float* ds
 void interleave_4x4_AVX2(float* src0, float* src1, float* src2, float* src3, float* dst, int numFrames);
 void biquad2_4x4_AVX2(float* src, float* dst, float coef[5][8], float state[3][8], int numFrames);
 void crossfade_4x2_AVX2(float* src, float* dst, const float* win, int numFrames);
+void biquad2_4x4x2_AVX2(float* src0, float* src1, float coef0[5][8], float coef1[5][8],
+                        float state0[3][8], float state1[3][8], int numFrames);
+void crossfade_4x2x2_AVX2(float* src0, float* src1, float* dst, const float* win, int numFrames);
 void interpolate_AVX2(const float* src0, const float* src1, float* dst, float frac, float gain);
 
 static void FIR_1x4(float* src, float* dst0, float* dst1, float* dst2, float* dst3, float coef[4][HRTF_TAPS], int numFrames) {
@@ -412,6 +569,17 @@ static void crossfade_4x2(float* src, float* dst, const float* win, int numFrame
     (*f)(src, dst, win, numFrames); // dispatch
 }
 
+static void biquad2_4x4x2(float* src0, float* src1, float coef0[5][8], float coef1[5][8],
+                          float state0[3][8], float state1[3][8], int numFrames) {
+    static auto f = cpuSupportsAVX2() ? biquad2_4x4x2_AVX2 : biquad2_4x4x2_SSE;
+    (*f)(src0, src1, coef0, coef1, state0, state1, numFrames); // dispatch
+}
+
+static void crossfade_4x2x2(float* src0, float* src1, float* dst, const float* win, int numFrames) {
+    static auto f = cpuSupportsAVX2() ? crossfade_4x2x2_AVX2 : crossfade_4x2x2_SSE;
+    (*f)(src0, src1, dst, win, numFrames); // dispatch
+}
+
 static void interpolate(const float* src0, const float* src1, float* dst, float frac, float gain) {
     static auto f = cpuSupportsAVX2() ? interpolate_AVX2 : interpolate_SSE;
     (*f)(src0, src1, dst, frac, gain); // dispatch
@@ -678,6 +846,31 @@ static void crossfade_4x2(float* src, float* dst, const float* win, int numFrame
     }
 }
 
+// process 2 cascaded biquads on 4 channels (interleaved), for 2 independent sources
+static void biquad2_4x4x2(float* src0, float* src1, float coef0[5][8], float coef1[5][8],
+                          float state0[3][8], float state1[3][8], int numFrames) {
+
+    biquad2_4x4(src0, src0, coef0, state0, numFrames);
+    biquad2_4x4(src1, src1, coef1, state1, numFrames);
+}
+
+// crossfade 4 inputs into 2 outputs, for 2 sources, with a single accumulation (interleaved)
+static void crossfade_4x2x2(float* src0, float* src1, float* dst, const float* win, int numFrames) {
+
+    for (int i = 0; i < numFrames; i++) {
+
+        float frac = win[i];
+
+        float x0 = src0[4*i+2] + frac * (src0[4*i+0] - src0[4*i+2]);
+        float x1 = src0[4*i+3] + frac * (src0[4*i+1] - src0[4*i+3]);
+        float x2 = src1[4*i+2] + frac * (src1[4*i+0] - src1[4*i+2]);
+        float x3 = src1[4*i+3] + frac * (src1[4*i+1] - src1[4*i+3]);
+
+        dst[2*i+0] = (dst[2*i+0] + x0) + x2;
+        dst[2*i+1] = (dst[2*i+1] + x1) + x3;
+    }
+}
+
 // linear interpolation with gain
 static void interpolate(const float* src0, const float* src1, float* dst, float frac, float gain) {
 
@@ -692,7 +885,7 @@ static void interpolate(const float* src0, const float* src1, float* dst, float
 #endif
 
 // apply gain crossfade with accumulation (interleaved)
-static void gainfade_1x2(int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+static void gainfade_1x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
 
     gain0 *= (1/32768.0f);  // int16_t to float
     gain1 *= (1/32768.0f);
@@ -710,7 +903,7 @@ static void gainfade_1x2(int16_t* src, float* dst, const float* win, float gain0
 }
 
 // apply gain crossfade with accumulation (interleaved)
-static void gainfade_2x2(int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+static void gainfade_2x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
 
     gain0 *= (1/32768.0f);  // int16_t to float
     gain1 *= (1/32768.0f);
@@ -1060,18 +1253,12 @@ static void setFilters(float firCoef[4][HRTF_TAPS], float bqCoef[5][8], int dela
     }
 }
 
-void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
-                       float lpfDistance) {
-
-    assert(index >= 0);
-    assert(index < HRTF_TABLES);
-    assert(numFrames == HRTF_BLOCK);
+void AudioHRTF::renderFilters(const int16_t* input, int index, float azimuth, float distance, float gain, float lpfDistance,
+                               float bqCoef[5][8], float* bqBuffer) {
 
     ALIGN32 float in[HRTF_TAPS + HRTF_BLOCK];               // mono
     ALIGN32 float firCoef[4][HRTF_TAPS];                    // 4-channel
     ALIGN32 float firBuffer[4][HRTF_DELAY + HRTF_BLOCK];    // 4-channel
-    ALIGN32 float bqCoef[5][8];                             // 4-channel (interleaved)
-    ALIGN32 float bqBuffer[4 * HRTF_BLOCK];                 // 4-channel (interleaved)
     int delay[4];                                           // 4-channel (interleaved)
 
     // apply global and local gain adjustment
@@ -1135,9 +1322,9 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
                    &firBuffer[L1][HRTF_DELAY] - delay[L1],
                    &firBuffer[R1][HRTF_DELAY] - delay[R1],
                    bqBuffer, HRTF_BLOCK);
+}
 
-    // process old/new biquads
-    biquad2_4x4(bqBuffer, bqBuffer, bqCoef, _bqState, HRTF_BLOCK);
+void AudioHRTF::updateBiquadState() {
 
     // new state becomes old
     _bqState[0][L0] = _bqState[0][L1];
@@ -1156,13 +1343,72 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     _bqState[1][R2] = _bqState[1][R3];
     _bqState[2][R2] = _bqState[2][R3];
 
+    _resetState = false;
+}
+
+void AudioHRTF::render(const int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
+                       float lpfDistance) {
+
+    assert(index >= 0);
+    assert(index < HRTF_TABLES);
+    assert(numFrames == HRTF_BLOCK);
+
+    ALIGN32 float bqCoef[5][8];                             // 4-channel (interleaved)
+    ALIGN32 float bqBuffer[4 * HRTF_BLOCK];                 // 4-channel (interleaved)
+
+    // compute old/new filters, process FIR and integer delay
+    renderFilters(input, index, azimuth, distance, gain, lpfDistance, bqCoef, bqBuffer);
+
+    // process old/new biquads
+    biquad2_4x4(bqBuffer, bqBuffer, bqCoef, _bqState, HRTF_BLOCK);
+
+    updateBiquadState();
+
     // crossfade old/new output and accumulate
     crossfade_4x2(bqBuffer, output, crossfadeTable, HRTF_BLOCK);
+}
 
-    _resetState = false;
+void AudioHRTF::renderBatch(const BatchSource* sources, int numSources, float* output, int index, int numFrames) {
+
+    assert(index >= 0);
+    assert(index < HRTF_TABLES);
+    assert(numFrames == HRTF_BLOCK);
+
+    ALIGN32 float bqCoef[2][5][8];                          // 2 x 4-channel (interleaved)
+    ALIGN32 float bqBuffer[2][4 * HRTF_BLOCK];              // 2 x 4-channel (interleaved)
+
+    int i = 0;
+    for (; i + 1 < numSources; i += 2) {
+
+        const BatchSource& source0 = sources[i+0];
+        const BatchSource& source1 = sources[i+1];
+        assert(source0.hrtf != source1.hrtf);
+
+        // compute old/new filters, process FIR and integer delay
+        source0.hrtf->renderFilters(source0.input, index, source0.azimuth, source0.distance, source0.gain,
+                                    source0.lpfDistance, bqCoef[0], bqBuffer[0]);
+        source1.hrtf->renderFilters(source1.input, index, source1.azimuth, source1.distance, source1.gain,
+                                    source1.lpfDistance, bqCoef[1], bqBuffer[1]);
+
+        // process old/new biquads of both sources in one pass
+        biquad2_4x4x2(bqBuffer[0], bqBuffer[1], bqCoef[0], bqCoef[1],
+                      source0.hrtf->_bqState, source1.hrtf->_bqState, HRTF_BLOCK);
+
+        source0.hrtf->updateBiquadState();
+        source1.hrtf->updateBiquadState();
+
+        // crossfade old/new output of both sources and accumulate once
+        crossfade_4x2x2(bqBuffer[0], bqBuffer[1], output, crossfadeTable, HRTF_BLOCK);
+    }
+
+    if (i < numSources) {
+        const BatchSource& source = sources[i];
+        source.hrtf->render(source.input, output, index, source.azimuth, source.distance, source.gain, numFrames,
+                            source.lpfDistance);
+    }
 }
 
-void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames) {
+void AudioHRTF::mixMono(const int16_t* input, float* output, float gain, int numFrames) {
 
     assert(numFrames == HRTF_BLOCK);
 
@@ -1183,7 +1429,7 @@ void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames
     _resetState = false;
 }
 
-void AudioHRTF::mixStereo(int16_t* input, float* output, float gain, int numFrames) {
+void AudioHRTF::mixStereo(const int16_t* input, float* output, float gain, int numFrames) {
 
     assert(numFrames == HRTF_BLOCK);
 
@@ -45,6 +45,18 @@ class AudioHRTF {
 public:
     AudioHRTF() {};
 
+    //
+    // One source of a batched render, with the same parameters as render()
+    //
+    struct BatchSource {
+        AudioHRTF* hrtf;
+        const int16_t* input;
+        float azimuth;
+        float distance;
+        float gain;
+        float lpfDistance = LPF_DISTANCE_REF;
+    };
+
     //
     // input: mono source
     // output: interleaved stereo mix buffer (accumulates into existing output)
@@ -55,14 +67,22 @@ public:
     // numFrames: must be HRTF_BLOCK in this version
     // lpfDistance: distance filter adjustment (distance to 1kHz lowpass in meters)
     //
-    void render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
+    void render(const int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
                 float lpfDistance = LPF_DISTANCE_REF);
 
+    //
+    // Batched render of several mono sources into one output, with the same result as calling render() for each.
+    // Sources are processed in pairs: the recursive filters of both run interleaved in one pass,
+    // and each pair is accumulated into the output once.
+    // Each source must have its own AudioHRTF instance.
+    //
+    static void renderBatch(const BatchSource* sources, int numSources, float* output, int index, int numFrames);
+
     //
     // Non-spatialized direct mix (accumulates into existing output)
     //
-    void mixMono(int16_t* input, float* output, float gain, int numFrames);
-    void mixStereo(int16_t* input, float* output, float gain, int numFrames);
+    void mixMono(const int16_t* input, float* output, float gain, int numFrames);
+    void mixStereo(const int16_t* input, float* output, float gain, int numFrames);
 
     //
     // Fast path when input is known to be silent and state as been flushed
@@ -111,6 +131,11 @@ private:
     AudioHRTF(const AudioHRTF&) = delete;
     AudioHRTF& operator=(const AudioHRTF&) = delete;
 
+    // render stages shared by render() and renderBatch()
+    void renderFilters(const int16_t* input, int index, float azimuth, float distance, float gain, float lpfDistance,
+                       float bqCoef[5][8], float* bqBuffer);
+    void updateBiquadState();
+
     // SIMD channel assignmentS
     enum Channel {
         L0, R0,
@@ -226,6 +226,135 @@ void crossfade_4x2_AVX2(float* src, float* dst, const float* win, int numFrames)
     _mm256_zeroupper();
 }
 
+// process 2 cascaded biquads on 4 channels (interleaved), for 2 independent sources
+// the two recursions are interleaved to hide the latency of each
+void biquad2_4x4x2_AVX2(float* src0, float* src1, float coef0[5][8], float coef1[5][8],
+                        float state0[3][8], float state1[3][8], int numFrames) {
+
+    // enable flush-to-zero mode to prevent denormals
+    unsigned int ftz = _MM_GET_FLUSH_ZERO_MODE();
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+
+    // restore state
+    __m256 x0 = _mm256_setzero_ps();
+    __m256 y0 = _mm256_loadu_ps(state0[0]);
+    __m256 w1 = _mm256_loadu_ps(state0[1]);
+    __m256 w2 = _mm256_loadu_ps(state0[2]);
+
+    __m256 u0 = _mm256_setzero_ps();
+    __m256 z0 = _mm256_loadu_ps(state1[0]);
+    __m256 v1 = _mm256_loadu_ps(state1[1]);
+    __m256 v2 = _mm256_loadu_ps(state1[2]);
+
+    //  biquad coefs
+    __m256 b0 = _mm256_loadu_ps(coef0[0]);
+    __m256 b1 = _mm256_loadu_ps(coef0[1]);
+    __m256 b2 = _mm256_loadu_ps(coef0[2]);
+    __m256 a1 = _mm256_loadu_ps(coef0[3]);
+    __m256 a2 = _mm256_loadu_ps(coef0[4]);
+
+    __m256 d0 = _mm256_loadu_ps(coef1[0]);
+    __m256 d1 = _mm256_loadu_ps(coef1[1]);
+    __m256 d2 = _mm256_loadu_ps(coef1[2]);
+    __m256 c1 = _mm256_loadu_ps(coef1[3]);
+    __m256 c2 = _mm256_loadu_ps(coef1[4]);
+
+    for (int i = 0; i < numFrames; i++) {
+
+        // x0 = (first biquad output << 128) | input
+        x0 = _mm256_insertf128_ps(_mm256_permute2f128_ps(y0, y0, 0x01), _mm_loadu_ps(&src0[4*i]), 0);
+        u0 = _mm256_insertf128_ps(_mm256_permute2f128_ps(z0, z0, 0x01), _mm_loadu_ps(&src1[4*i]), 0);
+
+        // transposed Direct Form II
+        y0 = _mm256_fmadd_ps(x0, b0, w1);
+        z0 = _mm256_fmadd_ps(u0, d0, v1);
+        w1 = _mm256_fmadd_ps(x0, b1, w2);
+        v1 = _mm256_fmadd_ps(u0, d1, v2);
+        w2 = _mm256_mul_ps(x0, b2);
+        v2 = _mm256_mul_ps(u0, d2);
+        w1 = _mm256_fnmadd_ps(y0, a1, w1);
+        v1 = _mm256_fnmadd_ps(z0, c1, v1);
+        w2 = _mm256_fnmadd_ps(y0, a2, w2);
+        v2 = _mm256_fnmadd_ps(z0, c2, v2);
+
+        _mm_storeu_ps(&src0[4*i], _mm256_extractf128_ps(y0, 1)); // second biquad output (in-place)
+        _mm_storeu_ps(&src1[4*i], _mm256_extractf128_ps(z0, 1));
+    }
+
+    // save state
+    _mm256_storeu_ps(state0[0], y0);
+    _mm256_storeu_ps(state0[1], w1);
+    _mm256_storeu_ps(state0[2], w2);
+
+    _mm256_storeu_ps(state1[0], z0);
+    _mm256_storeu_ps(state1[1], v1);
+    _mm256_storeu_ps(state1[2], v2);
+
+    _MM_SET_FLUSH_ZERO_MODE(ftz);
+    _mm256_zeroupper();
+}
+
+// crossfade 4 inputs into 2 outputs, for 2 sources, with a single accumulation (interleaved)
+void crossfade_4x2x2_AVX2(float* src0, float* src1, float* dst, const float* win, int numFrames) {
+
+    assert(numFrames % 8 == 0);
+
+    for (int i = 0; i < numFrames; i += 8) {
+
+        __m256 f0 = _mm256_loadu_ps(&win[i]);
+
+        __m256 y0 = _mm256_loadu_ps(&dst[2*i+0]);
+        __m256 y1 = _mm256_loadu_ps(&dst[2*i+8]);
+
+        float* src[2] = { src0, src1 };
+        for (int j = 0; j < 2; j++) {
+
+            __m256 x0 = _mm256_castps128_ps256(_mm_loadu_ps(&src[j][4*i+0]));
+            __m256 x1 = _mm256_castps128_ps256(_mm_loadu_ps(&src[j][4*i+4]));
+            __m256 x2 = _mm256_castps128_ps256(_mm_loadu_ps(&src[j][4*i+8]));
+            __m256 x3 = _mm256_castps128_ps256(_mm_loadu_ps(&src[j][4*i+12]));
+
+            x0 = _mm256_insertf128_ps(x0, _mm_loadu_ps(&src[j][4*i+16]), 1);
+            x1 = _mm256_insertf128_ps(x1, _mm_loadu_ps(&src[j][4*i+20]), 1);
+            x2 = _mm256_insertf128_ps(x2, _mm_loadu_ps(&src[j][4*i+24]), 1);
+            x3 = _mm256_insertf128_ps(x3, _mm_loadu_ps(&src[j][4*i+28]), 1);
+
+            // deinterleave (4x4 matrix transpose)
+            __m256 t0 = _mm256_unpacklo_ps(x0, x1);
+            __m256 t1 = _mm256_unpackhi_ps(x0, x1);
+            __m256 t2 = _mm256_unpacklo_ps(x2, x3);
+            __m256 t3 = _mm256_unpackhi_ps(x2, x3);
+
+            x0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1,0,1,0));
+            x1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3,2,3,2));
+            x2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1,0,1,0));
+            x3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3,2,3,2));
+
+            // crossfade
+            x0 = _mm256_sub_ps(x0, x2);
+            x1 = _mm256_sub_ps(x1, x3);
+            x2 = _mm256_fmadd_ps(f0, x0, x2);
+            x3 = _mm256_fmadd_ps(f0, x1, x3);
+
+            // interleave
+            t0 = _mm256_unpacklo_ps(x2, x3);
+            t1 = _mm256_unpackhi_ps(x2, x3);
+
+            x0 = _mm256_permute2f128_ps(t0, t1, 0x20);
+            x1 = _mm256_permute2f128_ps(t0, t1, 0x31);
+
+            // accumulate, in source order
+            y0 = _mm256_add_ps(y0, x0);
+            y1 = _mm256_add_ps(y1, x1);
+        }
+
+        _mm256_storeu_ps(&dst[2*i+0], y0);
+        _mm256_storeu_ps(&dst[2*i+8], y1);
+    }
+
+    _mm256_zeroupper();
+}
+
 // linear interpolation with gain
 void interpolate_AVX2(const float* src0, const float* src1, float* dst, float frac, float gain) {
 
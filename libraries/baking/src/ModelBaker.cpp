@@ -241,6 +241,7 @@ void ModelBaker::bakeSourceCopy() {
         }
 
         baker::Baker baker(loadedModel, serializerMapping, _mappingURL);
+        baker.setNumThreads(baker::BakeContext::AUTOMATIC_THREADS);
         auto config = baker.getConfiguration();
         // Enable compressed draco mesh generation
         config->getJobConfig("BuildDracoMesh")->setEnabled(true);
@@ -11,10 +11,19 @@
 
 #include "DiffTraversal.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+#include <QtCore/QThreadPool>
+
 #include <OctreeUtils.h>
 
+#include "EntitiesLogging.h"
 #include "EntityPriorityQueue.h"
 
+std::atomic<int> DiffTraversal::_numParallelTraversalThreads { 0 };
+
 DiffTraversal::Waypoint::Waypoint(EntityTreeElementPointer& element) : _nextIndex(0) {
     assert(element);
     _weakElement = element;
@@ -235,11 +244,14 @@ DiffTraversal::Type DiffTraversal::prepareNewTraversal(const DiffTraversal::View
     }
 
     _path.clear();
+    _pendingSubtrees.clear();
+    _isTraversingInParallel = false;
     _path.push_back(DiffTraversal::Waypoint(root));
     // set root fork's index such that root element returned at getNextElement()
     _path.back().initRootNextIndex();
 
     _currentView.startTime = usecTimestampNow();
+    _type = type;
 
     return type;
 }
@@ -297,3 +309,204 @@ void DiffTraversal::traverse(uint64_t timeBudget) {
         getNextVisibleElement(next);
     }
 }
+
+void DiffTraversal::setNumParallelTraversalThreads(int numThreads) {
+    numThreads = std::max(0, numThreads);
+    if (numThreads != _numParallelTraversalThreads) {
+        qCDebug(entities) << "DiffTraversal using" << numThreads << "threads for parallel first traversals";
+        _numParallelTraversalThreads = numThreads;
+        if (numThreads > 0) {
+            getParallelTraversalPool().setMaxThreadCount(numThreads);
+        }
+    }
+}
+
+QThreadPool& DiffTraversal::getParallelTraversalPool() {
+    static QThreadPool pool;
+    return pool;
+}
+
+bool DiffTraversal::canTraverseInParallel() const {
+    if (_isTraversingInParallel) {
+        // carry on with it even if the pool was since disabled, the calling thread can finish it alone
+        return true;
+    }
+    return _numParallelTraversalThreads > 0 && _type == Type::First &&
+        _path.size() == 1 && _path.back().getNextIndex() == -1;
+}
+
+void DiffTraversal::scanElement(const EntityTreeElementPointer& element, const View& view, Candidates& candidates) {
+    if (!element->hasContent()) {
+        return;
+    }
+    element->forEachEntity([&](const EntityItemPointer& entity) {
+        float priority = view.computePriority(entity);
+        if (priority != PrioritizedEntity::DO_NOT_SEND) {
+            candidates.emplace_back(entity, priority);
+        }
+    });
+}
+
+void DiffTraversal::traverseInParallel(EntityPriorityQueue& sendQueue, uint64_t timeBudget) {
+    assert(canTraverseInParallel());
+    auto comparePriorities = [](const PrioritizedEntity& a, const PrioritizedEntity& b) {
+        return a.getPriority() > b.getPriority();
+    };
+
+    // the work of this call is shared with the pool through this state, which outlives the call for helpers that
+    // only start after it has finished
+    struct State {
+        View view;
+        uint64_t expiry;
+        std::vector<EntityTreeElementWeakPointer> subtrees;
+        std::vector<Candidates> candidates;
+        std::mutex mutex;
+        std::condition_variable condition;
+        int numActive { 0 };
+        bool closed { false };
+
+        // scans subtrees depth first until there are none left or the time is up, in which case the part of the
+        // subtree not yet scanned goes back to the others. At least one element is scanned, so that every call
+        // makes progress however small its budget
+        void scanSubtrees(Candidates& list) {
+            std::vector<EntityTreeElementPointer> stack;
+            bool hasScanned = false;
+            while (true) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (subtrees.empty() || (hasScanned && usecTimestampNow() > expiry)) {
+                        return;
+                    }
+                    EntityTreeElementPointer subtree = subtrees.back().lock();
+                    subtrees.pop_back();
+                    if (!subtree) {
+                        continue; // removed from the tree since an earlier call
+                    }
+                    stack.push_back(subtree);
+                }
+                while (!stack.empty()) {
+                    EntityTreeElementPointer element = std::move(stack.back());
+                    stack.pop_back();
+                    scanElement(element, view, list);
+                    hasScanned = true;
+                    for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+                        EntityTreeElementPointer child = element->getChildAtIndex(i);
+                        if (child && view.shouldTraverseElement(*child)) {
+                            stack.push_back(child);
+                        }
+                    }
+                    if (!stack.empty() && usecTimestampNow() > expiry) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        for (const auto& remaining : stack) {
+                            subtrees.push_back(remaining);
+                        }
+                        return;
+                    }
+                }
+            }
+        }
+    };
+    auto state = std::make_shared<State>();
+    state->view = _currentView;
+    state->expiry = usecTimestampNow() + timeBudget;
+
+    Candidates candidates;
+    if (!_isTraversingInParallel) {
+        EntityTreeElementPointer root = _path.back().getElement();
+        if (!root) {
+            _path.clear();
+            _completedView = _currentView;
+            return;
+        }
+        _isTraversingInParallel = true;
+
+        // the root and its children are scanned here, and the subtrees of its grandchildren are shared out
+        scanElement(root, state->view, candidates);
+        for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+            EntityTreeElementPointer child = root->getChildAtIndex(i);
+            if (child && state->view.shouldTraverseElement(*child)) {
+                scanElement(child, state->view, candidates);
+                for (int j = 0; j < NUMBER_OF_CHILDREN; ++j) {
+                    EntityTreeElementPointer grandchild = child->getChildAtIndex(j);
+                    if (grandchild && state->view.shouldTraverseElement(*grandchild)) {
+                        _pendingSubtrees.push_back(grandchild);
+                    }
+                }
+            }
+        }
+    }
+    state->subtrees.swap(_pendingSubtrees);
+
+    // this thread works through the subtrees too, so it never waits on a busy pool for more than the subtrees the
+    // helpers already took, and no helper starts scanning once this thread is done
+    int numHelpers = std::min(_numParallelTraversalThreads.load(), (int)state->subtrees.size() - 1);
+    for (int i = 0; i < numHelpers; ++i) {
+        getParallelTraversalPool().start([state, comparePriorities] {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->closed) {
+                    return;
+                }
+                ++state->numActive;
+            }
+            Candidates list;
+            state->scanSubtrees(list);
+            std::sort(list.begin(), list.end(), comparePriorities);
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->candidates.push_back(std::move(list));
+            if (--state->numActive == 0) {
+                state->condition.notify_all();
+            }
+        });
+    }
+    state->scanSubtrees(candidates);
+    std::sort(candidates.begin(), candidates.end(), comparePriorities);
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->closed = true;
+        state->condition.wait(lock, [&] { return state->numActive == 0; });
+    }
+
+    // merge the sorted lists highest priority first, so that no push into the send queue's heap has to sift up
+    std::vector<const Candidates*> lists { &candidates };
+    for (const auto& list : state->candidates) {
+        if (!list.empty()) {
+            lists.push_back(&list);
+        }
+    }
+    using Head = std::pair<size_t, size_t>; // list, position in list
+    auto compareHeads = [&](const Head& a, const Head& b) {
+        return (*lists[a.first])[a.second].getPriority() < (*lists[b.first])[b.second].getPriority();
+    };
+    std::vector<Head> heads;
+    for (size_t i = 0; i < lists.size(); ++i) {
+        if (!lists[i]->empty()) {
+            heads.emplace_back(i, 0);
+        }
+    }
+    std::make_heap(heads.begin(), heads.end(), compareHeads);
+    while (!heads.empty()) {
+        std::pop_heap(heads.begin(), heads.end(), compareHeads);
+        Head& head = heads.back();
+        const PrioritizedEntity& candidate = (*lists[head.first])[head.second];
+        EntityItemPointer entity = candidate.getEntity();
+        if (entity && !sendQueue.contains(entity.get())) {
+            sendQueue.emplace(entity, candidate.getPriority());
+        }
+        if (++head.second < lists[head.first]->size()) {
+            std::push_heap(heads.begin(), heads.end(), compareHeads);
+        } else {
+            heads.pop_back();
+        }
+    }
+
+    // the subtrees left over wait for the next call
+    _pendingSubtrees.swap(state->subtrees);
+    if (_pendingSubtrees.empty()) {
+        // the whole tree was traversed
+        _isTraversingInParallel = false;
+        _path.clear();
+        _completedView = _currentView;
+    }
+}
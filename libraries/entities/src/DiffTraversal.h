@@ -12,10 +12,16 @@
 #ifndef hifi_DiffTraversal_h
 #define hifi_DiffTraversal_h
 
+#include <atomic>
+#include <vector>
+
 #include <shared/ConicalViewFrustum.h>
 
+#include "EntityPriorityQueue.h"
 #include "EntityTreeElement.h"
 
+class QThreadPool;
+
 // DiffTraversal traverses the tree and applies _scanElementCallback on elements it finds
 class DiffTraversal {
 public:
@@ -50,6 +56,7 @@ public:
         void getNextVisibleElementDifferential(VisibleElement& next, const View& view, const View& lastView);
 
         int8_t getNextIndex() const { return _nextIndex; }
+        EntityTreeElementPointer getElement() const { return _weakElement.lock(); }
         void initRootNextIndex() { _nextIndex = -1; }
 
     protected:
@@ -71,14 +78,41 @@ public:
     void setScanCallback(std::function<void (VisibleElement&)> cb);
     void traverse(uint64_t timeBudget);
 
-    void reset() { _path.clear(); _completedView.startTime = 0; } // resets our state to force a new "First" traversal
+    // A "First" traversal that hasn't started yet can instead be run by traverseInParallel, which splits the tree
+    // below the root's children across a worker pool shared by every traversal. Like traverse, each call stops once
+    // timeBudget has passed, and the subtrees left unscanned are picked up by the next call. The entities in view that
+    // a call finds are sorted by priority and merged into sendQueue on the calling thread. Entities already in sendQueue
+    // are left as they are. The caller must hold the tree's read lock for each call.
+    bool canTraverseInParallel() const;
+    void traverseInParallel(EntityPriorityQueue& sendQueue, uint64_t timeBudget);
+
+    // Zero (the default) disables parallel traversals.
+    static void setNumParallelTraversalThreads(int numThreads);
+    static int getNumParallelTraversalThreads() { return _numParallelTraversalThreads; }
+
+    // resets our state to force a new "First" traversal
+    void reset() {
+        _path.clear();
+        _pendingSubtrees.clear();
+        _isTraversingInParallel = false;
+        _completedView.startTime = 0;
+    }
 
 private:
+    using Candidates = std::vector<PrioritizedEntity>;
+
     void getNextVisibleElement(VisibleElement& next);
+    static void scanElement(const EntityTreeElementPointer& element, const View& view, Candidates& candidates);
+
+    static QThreadPool& getParallelTraversalPool();
+    static std::atomic<int> _numParallelTraversalThreads;
 
+    Type _type { First };
     View _currentView;
     View _completedView;
     std::vector<Waypoint> _path;
+    std::vector<EntityTreeElementWeakPointer> _pendingSubtrees; // left for the next call to traverseInParallel
+    bool _isTraversingInParallel { false };
     std::function<void (VisibleElement&)> _getNextVisibleElementCallback { nullptr };
     std::function<void (VisibleElement&)> _scanElementCallback { [](VisibleElement& e){} };
 };
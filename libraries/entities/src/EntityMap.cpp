@@ -0,0 +1,113 @@
+//
+//  EntityMap.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityMap.h"
+
+#include <mutex>
+
+EntityItemPointer LockedEntityMap::value(const EntityItemID& id) const {
+    QReadLocker locker(&_lock);
+    return _entities.value(id);
+}
+
+bool LockedEntityMap::insert(const EntityItemID& id, const EntityItemPointer& entity) {
+    QWriteLocker locker(&_lock);
+    if (_entities.contains(id)) {
+        return false;
+    }
+    _entities.insert(id, entity);
+    return true;
+}
+
+void LockedEntityMap::remove(const EntityItemID& id) {
+    QWriteLocker locker(&_lock);
+    _entities.remove(id);
+}
+
+int LockedEntityMap::size() const {
+    QReadLocker locker(&_lock);
+    return _entities.size();
+}
+
+void LockedEntityMap::forEach(const EntityMapForEachFunction& function) const {
+    QReadLocker locker(&_lock);
+    for (const auto& entity : _entities) {
+        function(entity);
+    }
+}
+
+QHash<EntityItemID, EntityItemPointer> LockedEntityMap::take() {
+    QHash<EntityItemID, EntityItemPointer> entities;
+    QWriteLocker locker(&_lock);
+    entities.swap(_entities);
+    return entities;
+}
+
+void LockedEntityMap::reset(const QHash<EntityItemID, EntityItemPointer>& entities) {
+    QWriteLocker locker(&_lock);
+    _entities = entities;
+}
+
+EntityItemPointer ShardedEntityMap::value(const EntityItemID& id) const {
+    const Shard& shard = getShard(id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.entities.value(id);
+}
+
+bool ShardedEntityMap::insert(const EntityItemID& id, const EntityItemPointer& entity) {
+    Shard& shard = getShard(id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    if (shard.entities.contains(id)) {
+        return false;
+    }
+    shard.entities.insert(id, entity);
+    ++_size;
+    return true;
+}
+
+void ShardedEntityMap::remove(const EntityItemID& id) {
+    Shard& shard = getShard(id);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    _size -= shard.entities.remove(id);
+}
+
+void ShardedEntityMap::forEach(const EntityMapForEachFunction& function) const {
+    for (const auto& shard : _shards) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        for (const auto& entity : shard.entities) {
+            function(entity);
+        }
+    }
+}
+
+QHash<EntityItemID, EntityItemPointer> ShardedEntityMap::take() {
+    QHash<EntityItemID, EntityItemPointer> entities;
+    entities.reserve(_size);
+    for (auto& shard : _shards) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        for (auto it = shard.entities.cbegin(); it != shard.entities.cend(); ++it) {
+            entities.insert(it.key(), it.value());
+        }
+        _size -= shard.entities.size();
+        shard.entities.clear();
+    }
+    return entities;
+}
+
+void ShardedEntityMap::reset(const QHash<EntityItemID, EntityItemPointer>& entities) {
+    for (auto& shard : _shards) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        _size -= shard.entities.size();
+        shard.entities.clear();
+    }
+    for (auto it = entities.cbegin(); it != entities.cend(); ++it) {
+        insert(it.key(), it.value());
+    }
+}
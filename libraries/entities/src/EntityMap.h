@@ -0,0 +1,91 @@
+//
+//  EntityMap.h
+//  libraries/entities/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityMap_h
+#define hifi_EntityMap_h
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <shared_mutex>
+
+#include <QtCore/QHash>
+#include <QtCore/QReadWriteLock>
+
+#include <EntityItemID.h>
+
+#include "EntityTypes.h"
+
+// The index of every entity in an EntityTree by ID. There are two implementations with the same API, picked at build
+// time with OVERTE_USE_SHARDED_ENTITY_MAP: a single QHash behind one lock, and a sharded one for entity servers, where
+// the inbound packet processor, every send thread, the simulation and scripts all look entities up at once.
+//
+// forEach holds the map locked while it runs, so the callback must not add or remove entries. Like the tree, the
+// map must be locked after the tree and never the other way around.
+using EntityMapForEachFunction = std::function<void(const EntityItemPointer& entity)>;
+
+class LockedEntityMap {
+public:
+    EntityItemPointer value(const EntityItemID& id) const;
+    bool insert(const EntityItemID& id, const EntityItemPointer& entity); // false if the ID is already taken
+    void remove(const EntityItemID& id);
+
+    int size() const;
+    void forEach(const EntityMapForEachFunction& function) const;
+
+    QHash<EntityItemID, EntityItemPointer> take(); // empties the map, returning what it held
+    void reset(const QHash<EntityItemID, EntityItemPointer>& entities);
+
+private:
+    mutable QReadWriteLock _lock;
+    QHash<EntityItemID, EntityItemPointer> _entities;
+};
+
+// Spreads the entities over shards with a lock each, so that readers only contend when they look up entities in the
+// same shard, and writers only block the readers of one shard. forEach visits the shards one after the other, so it
+// sees a consistent map only while the tree is write locked, as it is wherever the tree iterates over its entities.
+class ShardedEntityMap {
+public:
+    EntityItemPointer value(const EntityItemID& id) const;
+    bool insert(const EntityItemID& id, const EntityItemPointer& entity);
+    void remove(const EntityItemID& id);
+
+    int size() const { return _size; }
+    void forEach(const EntityMapForEachFunction& function) const;
+
+    QHash<EntityItemID, EntityItemPointer> take();
+    void reset(const QHash<EntityItemID, EntityItemPointer>& entities);
+
+private:
+    static const int NUM_SHARDS_BITS { 6 };
+    static const int NUM_SHARDS { 1 << NUM_SHARDS_BITS };
+
+    // each on its own cache line, so that shards used by different threads don't share one
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        QHash<EntityItemID, EntityItemPointer> entities;
+    };
+
+    // the top bits of a multiplicative hash, so that the shard doesn't correlate with the QHash bucket within it
+    static int getShardIndex(const EntityItemID& id) { return (int)((uint32_t)(qHash(id) * 2654435769u) >> (32 - NUM_SHARDS_BITS)); }
+    Shard& getShard(const EntityItemID& id) { return _shards[getShardIndex(id)]; }
+    const Shard& getShard(const EntityItemID& id) const { return _shards[getShardIndex(id)]; }
+
+    std::array<Shard, NUM_SHARDS> _shards;
+    std::atomic<int> _size { 0 };
+};
+
+#ifdef OVERTE_USE_SHARDED_ENTITY_MAP
+using EntityMap = ShardedEntityMap;
+#else
+using EntityMap = LockedEntityMap;
+#endif
+
+#endif // hifi_EntityMap_h
@@ -46,8 +46,10 @@
 #include <Profile.h>
 #include "GrabPropertyGroup.h"
 #include <ScriptContext.h>
+#include <ScriptBindings.h>
 #include <ScriptEngineCast.h>
 #include <ScriptValue.h>
+#include <ScriptValueUtils.h>
 
 const QString GRABBABLE_USER_DATA = "{\"grabbableKey\":{\"grabbable\":true}}";
 const QString NOT_GRABBABLE_USER_DATA = "{\"grabbableKey\":{\"grabbable\":false}}";
@@ -62,6 +64,17 @@ void staticEntityScriptTypesInitializer(ScriptManager* manager) {
     scriptRegisterMetaType<EntityPropertyInfo, EntityPropertyInfoToScriptValue, EntityPropertyInfoFromScriptValue>(scriptEngine);
     scriptRegisterMetaType<EntityItemID, EntityItemIDtoScriptValue, EntityItemIDfromScriptValue>(scriptEngine);
     scriptRegisterMetaType<RayToEntityIntersectionResult, RayToEntityIntersectionResultToScriptValue, RayToEntityIntersectionResultFromScriptValue>(scriptEngine);
+
+    SCRIPT_BINDING_OVERLOAD(EntityScriptingInterface, getEntityProperties,
+                            EntityItemProperties (EntityScriptingInterface::*)(const QUuid&));
+    SCRIPT_BINDING_OVERLOAD(EntityScriptingInterface, getEntityProperties,
+                            ScriptValue (EntityScriptingInterface::*)(const QUuid&, const ScriptValue&));
+    SCRIPT_BINDING(EntityScriptingInterface, editEntity);
+    SCRIPT_BINDING(EntityScriptingInterface, getEntityType);
+    SCRIPT_BINDING(EntityScriptingInterface, isLoaded);
+    SCRIPT_BINDING(EntityScriptingInterface, canAdjustLocks);
+    SCRIPT_BINDING(EntityScriptingInterface, getEntityTransform);
+    SCRIPT_BINDING(EntityScriptingInterface, getEntityLocalTransform);
 }
 STATIC_SCRIPT_TYPES_INITIALIZER(staticEntityScriptTypesInitializer);
 
@@ -76,6 +89,7 @@ void staticEntityScriptInitializer(ScriptManager* manager) {
 
     scriptEngine->registerGlobalObject(sgp, "Entities", entityScriptingInterface.data());
     scriptEngine->registerFunction(sgp, "Entities", "getMultipleEntityProperties", EntityScriptingInterface::getMultipleEntityProperties);
+    scriptEngine->registerFunction(sgp, "Entities", "queryEntityProperties", EntityScriptingInterface::queryEntityProperties);
 
     // "The return value of QObject::sender() is not valid when the slot is called via a Qt::DirectConnection from a thread
     // different from this object's thread. Do not use this function in this type of scenario."
@@ -1007,6 +1021,262 @@ ScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(Script
     return finalResult;
 }
 
+// The properties queryEntityProperties can return, one column each
+enum QueryColumn : uint32_t {
+    QUERY_POSITION = 1 << 0,
+    QUERY_ROTATION = 1 << 1,
+    QUERY_LOCAL_POSITION = 1 << 2,
+    QUERY_LOCAL_ROTATION = 1 << 3,
+    QUERY_VELOCITY = 1 << 4,
+    QUERY_ANGULAR_VELOCITY = 1 << 5,
+    QUERY_DIMENSIONS = 1 << 6,
+    QUERY_REGISTRATION_POINT = 1 << 7,
+    QUERY_NAME = 1 << 8,
+    QUERY_TYPE = 1 << 9,
+    QUERY_PARENT_ID = 1 << 10,
+    QUERY_PARENT_JOINT_INDEX = 1 << 11,
+    QUERY_VISIBLE = 1 << 12,
+    QUERY_LOCKED = 1 << 13,
+    QUERY_USER_DATA = 1 << 14
+};
+const uint32_t QUERY_WORLD_TRANSFORM = QUERY_POSITION | QUERY_ROTATION | QUERY_VELOCITY | QUERY_ANGULAR_VELOCITY |
+    QUERY_DIMENSIONS;
+
+static uint32_t queryColumnFromName(const QString& name) {
+    static const QHash<QString, uint32_t> QUERY_COLUMNS {
+        { "position", QUERY_POSITION },
+        { "rotation", QUERY_ROTATION },
+        { "localPosition", QUERY_LOCAL_POSITION },
+        { "localRotation", QUERY_LOCAL_ROTATION },
+        { "velocity", QUERY_VELOCITY },
+        { "angularVelocity", QUERY_ANGULAR_VELOCITY },
+        { "dimensions", QUERY_DIMENSIONS },
+        { "registrationPoint", QUERY_REGISTRATION_POINT },
+        { "name", QUERY_NAME },
+        { "type", QUERY_TYPE },
+        { "parentID", QUERY_PARENT_ID },
+        { "parentJointIndex", QUERY_PARENT_JOINT_INDEX },
+        { "visible", QUERY_VISIBLE },
+        { "locked", QUERY_LOCKED },
+        { "userData", QUERY_USER_DATA }
+    };
+    return QUERY_COLUMNS.value(name, 0);
+}
+
+// What queryEntityProperties reads of one entity while the tree is locked. Transforms are kept relative to the parent
+// and converted to world space once the lock is released, like getEntityProperties does.
+struct QueriedEntity {
+    QUuid id;
+    EntityTypes::EntityType type { EntityTypes::Unknown };
+    QUuid parentID;
+    int parentJointIndex { -1 };
+    bool scalesWithParent { false };
+    glm::vec3 localPosition;
+    glm::quat localRotation;
+    glm::vec3 localVelocity;
+    glm::vec3 localAngularVelocity;
+    glm::vec3 localDimensions;
+    glm::vec3 registrationPoint;
+    QString name;
+    QString userData;
+    bool visible { true };
+    bool locked { false };
+};
+
+ScriptValue EntityScriptingInterface::queryEntityProperties(ScriptContext* context, ScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_IDS = 0;
+    const int ARGUMENT_PROPERTIES = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityIDs = scriptvalue_cast<QVector<QUuid>>(context->argument(ARGUMENT_ENTITY_IDS));
+    return entityScriptingInterface->queryEntityPropertiesInternal(engine, entityIDs, context->argument(ARGUMENT_PROPERTIES));
+}
+
+ScriptValue EntityScriptingInterface::queryEntityPropertiesInternal(ScriptEngine* engine, const QVector<QUuid>& entityIDs,
+                                                                    const ScriptValue& properties) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    uint32_t columns = 0;
+    if (properties.isString()) {
+        columns = queryColumnFromName(properties.toString());
+    } else if (properties.isArray()) {
+        const quint32 length = properties.property("length").toInt32();
+        for (quint32 i = 0; i < length; i++) {
+            columns |= queryColumnFromName(properties.property(i).toString());
+        }
+    }
+    const bool needsParent = columns & (QUERY_WORLD_TRANSFORM | QUERY_PARENT_ID | QUERY_PARENT_JOINT_INDEX);
+
+    QVector<QueriedEntity> entities;
+    if (_entityTree) {
+        PROFILE_RANGE(script_entities, "EntityScriptingInterface::queryEntityProperties>Obtaining Properties");
+        entities.reserve(entityIDs.size());
+        _entityTree->withReadLock([&] {
+            for (const auto& entityID : entityIDs) {
+                const EntityItemPointer entity = _entityTree->findEntityByEntityItemID(EntityItemID(entityID));
+                if (!entity) {
+                    continue;
+                }
+
+                QueriedEntity queried;
+                queried.id = entityID;
+                if (needsParent) {
+                    queried.parentID = entity->getParentID();
+                    queried.parentJointIndex = entity->getParentJointIndex();
+                    queried.scalesWithParent = entity->getScalesWithParent();
+                }
+                if (columns & (QUERY_POSITION | QUERY_LOCAL_POSITION)) {
+                    queried.localPosition = entity->getLocalPosition();
+                }
+                if (columns & (QUERY_ROTATION | QUERY_LOCAL_ROTATION)) {
+                    queried.localRotation = entity->getLocalOrientation();
+                }
+                if (columns & QUERY_VELOCITY) {
+                    queried.localVelocity = entity->getLocalVelocity();
+                }
+                if (columns & QUERY_ANGULAR_VELOCITY) {
+                    queried.localAngularVelocity = entity->getLocalAngularVelocity();
+                }
+                if (columns & QUERY_DIMENSIONS) {
+                    queried.localDimensions = entity->getScaledDimensions();
+                }
+                if (columns & QUERY_REGISTRATION_POINT) {
+                    queried.registrationPoint = entity->getRegistrationPoint();
+                }
+                if (columns & QUERY_TYPE) {
+                    queried.type = entity->getType();
+                }
+                if (columns & QUERY_NAME) {
+                    queried.name = entity->getName();
+                }
+                if (columns & QUERY_USER_DATA) {
+                    queried.userData = entity->getUserData();
+                }
+                if (columns & QUERY_VISIBLE) {
+                    queried.visible = entity->getVisible();
+                }
+                if (columns & QUERY_LOCKED) {
+                    queried.locked = entity->getLocked();
+                }
+                entities.append(queried);
+            }
+        });
+    }
+
+    const int numEntities = entities.size();
+    ScriptValue result = engine->newObject();
+
+    ScriptValue ids = engine->newArray(numEntities);
+    for (int i = 0; i < numEntities; i++) {
+        ids.setProperty(i, quuidToScriptValue(engine, entities[i].id));
+    }
+    result.setProperty("id", ids);
+
+    auto addVec3Column = [&](const char* name, auto getValue) {
+        QVector<float> values(3 * numEntities);
+        for (int i = 0; i < numEntities; i++) {
+            glm::vec3 value = getValue(entities[i]);
+            values[3 * i] = value.x;
+            values[3 * i + 1] = value.y;
+            values[3 * i + 2] = value.z;
+        }
+        result.setProperty(name, engine->newFloat32Array(values));
+    };
+    auto addQuatColumn = [&](const char* name, auto getValue) {
+        QVector<float> values(4 * numEntities);
+        for (int i = 0; i < numEntities; i++) {
+            glm::quat value = getValue(entities[i]);
+            values[4 * i] = value.x;
+            values[4 * i + 1] = value.y;
+            values[4 * i + 2] = value.z;
+            values[4 * i + 3] = value.w;
+        }
+        result.setProperty(name, engine->newFloat32Array(values));
+    };
+    auto addColumn = [&](const char* name, auto getValue) {
+        ScriptValue values = engine->newArray(numEntities);
+        for (int i = 0; i < numEntities; i++) {
+            values.setProperty(i, getValue(entities[i]));
+        }
+        result.setProperty(name, values);
+    };
+
+    // in scripts, position, rotation, velocity, angularVelocity and dimensions are in world space
+    if (columns & QUERY_POSITION) {
+        addVec3Column("position", [](const QueriedEntity& queried) {
+            bool success;
+            return queried.parentID.isNull() ? queried.localPosition :
+                SpatiallyNestable::localToWorld(queried.localPosition, queried.parentID, queried.parentJointIndex,
+                                                queried.scalesWithParent, success);
+        });
+    }
+    if (columns & QUERY_ROTATION) {
+        addQuatColumn("rotation", [](const QueriedEntity& queried) {
+            bool success;
+            return queried.parentID.isNull() ? queried.localRotation :
+                SpatiallyNestable::localToWorld(queried.localRotation, queried.parentID, queried.parentJointIndex,
+                                                queried.scalesWithParent, success);
+        });
+    }
+    if (columns & QUERY_LOCAL_POSITION) {
+        addVec3Column("localPosition", [](const QueriedEntity& queried) { return queried.localPosition; });
+    }
+    if (columns & QUERY_LOCAL_ROTATION) {
+        addQuatColumn("localRotation", [](const QueriedEntity& queried) { return queried.localRotation; });
+    }
+    if (columns & QUERY_VELOCITY) {
+        addVec3Column("velocity", [](const QueriedEntity& queried) {
+            bool success;
+            return queried.parentID.isNull() ? queried.localVelocity :
+                SpatiallyNestable::localToWorldVelocity(queried.localVelocity, queried.parentID, queried.parentJointIndex,
+                                                        queried.scalesWithParent, success);
+        });
+    }
+    if (columns & QUERY_ANGULAR_VELOCITY) {
+        addVec3Column("angularVelocity", [](const QueriedEntity& queried) {
+            bool success;
+            return queried.parentID.isNull() ? queried.localAngularVelocity :
+                SpatiallyNestable::localToWorldAngularVelocity(queried.localAngularVelocity, queried.parentID,
+                                                               queried.parentJointIndex, queried.scalesWithParent, success);
+        });
+    }
+    if (columns & QUERY_DIMENSIONS) {
+        addVec3Column("dimensions", [](const QueriedEntity& queried) {
+            bool success;
+            return queried.parentID.isNull() ? queried.localDimensions :
+                SpatiallyNestable::localToWorldDimensions(queried.localDimensions, queried.parentID,
+                                                          queried.parentJointIndex, queried.scalesWithParent, success);
+        });
+    }
+    if (columns & QUERY_REGISTRATION_POINT) {
+        addVec3Column("registrationPoint", [](const QueriedEntity& queried) { return queried.registrationPoint; });
+    }
+    if (columns & QUERY_NAME) {
+        addColumn("name", [&](const QueriedEntity& queried) { return engine->newValue(queried.name); });
+    }
+    if (columns & QUERY_TYPE) {
+        addColumn("type", [&](const QueriedEntity& queried) {
+            return engine->newValue(EntityTypes::getEntityTypeName(queried.type));
+        });
+    }
+    if (columns & QUERY_PARENT_ID) {
+        addColumn("parentID", [&](const QueriedEntity& queried) { return quuidToScriptValue(engine, queried.parentID); });
+    }
+    if (columns & QUERY_PARENT_JOINT_INDEX) {
+        addColumn("parentJointIndex", [&](const QueriedEntity& queried) { return engine->newValue(queried.parentJointIndex); });
+    }
+    if (columns & QUERY_VISIBLE) {
+        addColumn("visible", [&](const QueriedEntity& queried) { return engine->newValue(queried.visible); });
+    }
+    if (columns & QUERY_LOCKED) {
+        addColumn("locked", [&](const QueriedEntity& queried) { return engine->newValue(queried.locked); });
+    }
+    if (columns & QUERY_USER_DATA) {
+        addColumn("userData", [&](const QueriedEntity& queried) { return engine->newValue(queried.userData); });
+    }
+    return result;
+}
+
 QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProperties& scriptSideProperties) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
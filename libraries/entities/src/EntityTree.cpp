@@ -15,6 +15,7 @@
 #include "EntityTree.h"
 #include <QtCore/QDateTime>
 #include <QtCore/QQueue>
+#include <QtCore/QSaveFile>
 #include <openssl/err.h>
 #include <openssl/pem.h>
 #include <openssl/x509.h>
@@ -26,6 +27,7 @@
 #include <QJsonArray>
 
 #include <Extents.h>
+#include <OctreeDataUtils.h>
 #include <PerfStat.h>
 #include <Profile.h>
 #include <AddressManager.h>
@@ -92,8 +94,7 @@ void EntityTree::eraseDomainAndNonOwnedEntities() {
         QHash<EntityItemID, EntityItemPointer> savedEntities;
         // NOTE: lock the Tree first, then lock the _entityMap.
         // It should never be done the other way around.
-        QReadLocker locker(&_entityMapLock);
-        foreach(EntityItemPointer entity, _entityMap) {
+        _entityMap.forEach([&](const EntityItemPointer& entity) {
             EntityTreeElementPointer element = entity->getElement();
             if (element) {
                 element->cleanupDomainAndNonOwnedEntities();
@@ -109,8 +110,8 @@ void EntityTree::eraseDomainAndNonOwnedEntities() {
                     }
                 }
             }
-        }
-        _entityMap.swap(savedEntities);
+        });
+        _entityMap.reset(savedEntities);
     });
 
     resetClientEditStats();
@@ -137,8 +138,7 @@ void EntityTree::eraseAllOctreeElements(bool createNewRoot) {
     if (_simulation) {
         _simulation->clearEntities();
     }
-    QHash<EntityItemID, EntityItemPointer> localMap;
-    localMap.swap(_entityMap);
+    QHash<EntityItemID, EntityItemPointer> localMap = _entityMap.take();
     this->withWriteLock([&] {
         foreach(EntityItemPointer entity, localMap) {
             EntityTreeElementPointer element = entity->getElement();
@@ -308,11 +308,7 @@ void EntityTree::postAddEntity(EntityItemPointer entity) {
 }
 
 bool EntityTree::updateEntity(const EntityItemID& entityID, const EntityItemProperties& properties, const SharedNodePointer& senderNode) {
-    EntityItemPointer entity;
-    {
-        QReadLocker locker(&_entityMapLock);
-        entity = _entityMap.value(entityID);
-    }
+    EntityItemPointer entity = _entityMap.value(entityID);
     if (!entity) {
         return false;
     }
@@ -630,6 +626,7 @@ void EntityTree::cleanupCloneIDs(const EntityItemID& entityID) {
             EntityItemPointer cloneOrigin = findEntityByID(cloneOriginID);
             if (cloneOrigin) {
                 cloneOrigin->removeCloneID(entityID);
+                cloneOrigin->markAsChangedOnServer();
             }
         }
         // clear the clone origin ID on any clones that this entity had
@@ -638,6 +635,7 @@ void EntityTree::cleanupCloneIDs(const EntityItemID& entityID) {
             EntityItemPointer cloneChild = findEntityByEntityItemID(cloneChildID);
             if (cloneChild) {
                 cloneChild->setCloneOriginID(QUuid());
+                cloneChild->markAsChangedOnServer();
             }
         }
     }
@@ -679,11 +677,7 @@ void EntityTree::deleteEntitiesByID(const std::vector<EntityItemID>& ids, bool f
             std::vector<EntityItemPointer> entitiesToDelete;
             entitiesToDelete.reserve(ids.size());
             for (auto id : ids) {
-                EntityItemPointer entity;
-                {
-                    QReadLocker locker(&_entityMapLock);
-                    entity = _entityMap.value(id);
-                }
+                EntityItemPointer entity = _entityMap.value(id);
                 if (entity) {
                     recursivelyFilterAndCollectForDelete(entity, entitiesToDelete, force);
                 }
@@ -699,11 +693,7 @@ void EntityTree::deleteEntitiesByID(const std::vector<EntityItemID>& ids, bool f
         QUuid sessionID = DependencyManager::get<NodeList>()->getSessionUUID();
         withWriteLock([&] {
             for (auto id : ids) {
-                EntityItemPointer entity;
-                {
-                    QReadLocker locker(&_entityMapLock);
-                    entity = _entityMap.value(id);
-                }
+                EntityItemPointer entity = _entityMap.value(id);
                 if (entity) {
                     bool isServerless = isServerlessMode();
                     if (entity->isDomainEntity() && !isServerless) {
@@ -1238,11 +1228,7 @@ EntityItemPointer EntityTree::findEntityByID(const QUuid& id) const {
 }
 
 EntityItemPointer EntityTree::findEntityByEntityItemID(const EntityItemID& entityID) const {
-    EntityItemPointer foundEntity = nullptr;
-    {
-        QReadLocker locker(&_entityMapLock);
-        foundEntity = _entityMap.value(entityID);
-    }
+    EntityItemPointer foundEntity = _entityMap.value(entityID);
     if (foundEntity && !foundEntity->getElement()) {
         // special case to maintain legacy behavior:
         // if the entity is in the map but not in the tree
@@ -1719,6 +1705,7 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
 
                         if (newEntity && isClone) {
                             entityToClone->addCloneID(newEntity->getEntityItemID());
+                            entityToClone->markAsChangedOnServer();
                             newEntity->setCloneOriginID(entityIDToClone);
                         }
 
@@ -2184,11 +2171,7 @@ int EntityTree::processEraseMessageDetails(const QByteArray& dataByteArray, cons
 }
 
 EntityTreeElementPointer EntityTree::getContainingElement(const EntityItemID& entityItemID)  /*const*/ {
-    EntityItemPointer entity;
-    {
-        QReadLocker locker(&_entityMapLock);
-        entity = _entityMap.value(entityItemID);
-    }
+    EntityItemPointer entity = _entityMap.value(entityItemID);
     if (entity) {
         return entity->getElement();
     }
@@ -2197,31 +2180,21 @@ EntityTreeElementPointer EntityTree::getContainingElement(const EntityItemID& en
 
 void EntityTree::addEntityMapEntry(EntityItemPointer entity) {
     EntityItemID id = entity->getEntityItemID();
-    QWriteLocker locker(&_entityMapLock);
-    EntityItemPointer otherEntity = _entityMap.value(id);
-    if (otherEntity) {
+    if (!_entityMap.insert(id, entity)) {
         qCWarning(entities) << "EntityTree::addEntityMapEntry() found pre-existing id " << id;
         assert(false);
-        return;
     }
-    _entityMap.insert(id, entity);
 }
 
 void EntityTree::clearEntityMapEntry(const EntityItemID& id) {
-    QWriteLocker locker(&_entityMapLock);
     _entityMap.remove(id);
 }
 
 void EntityTree::debugDumpMap() {
-    // QHash's are implicitly shared, so we make a shared copy and use that instead.
-    // This way we might be able to avoid both a lock and a true copy.
-    QHash<EntityItemID, EntityItemPointer> localMap(_entityMap);
     qCDebug(entities) << "EntityTree::debugDumpMap() --------------------------";
-    QHashIterator<EntityItemID, EntityItemPointer> i(localMap);
-    while (i.hasNext()) {
-        i.next();
-        qCDebug(entities) << i.key() << ": " << i.value()->getElement().get();
-    }
+    _entityMap.forEach([](const EntityItemPointer& entity) {
+        qCDebug(entities) << entity->getEntityItemID() << ": " << entity->getElement().get();
+    });
     qCDebug(entities) << "-----------------------------------------------------";
 }
 
@@ -2593,11 +2566,231 @@ bool EntityTree::writeToMap(QVariantMap& entityDescription, OctreeElementPointer
     _helperScriptEngine.run( [&] {
         RecurseOctreeToMapOperator theOperator(entityDescription, element, _helperScriptEngine.get(), skipDefaultValues,
                                                skipThoseWithBadParents, _myAvatar);
-        withReadLock([&] { recurseTreeWithOperator(&theOperator); });
+        withReadLock([&] {
+            quint64 lockStart = usecTimestampNow();
+            recurseTreeWithOperator(&theOperator);
+            _serializeLockUsecs += usecTimestampNow() - lockStart;
+        });
+    });
+    return true;
+}
+
+QVector<QUuid> EntityTree::findEntitiesChangedOnServerSince(quint64 since) {
+    QVector<QUuid> entityIDs;
+    withReadLock([&] {
+        quint64 lockStart = usecTimestampNow();
+        _entityMap.forEach([&](const EntityItemPointer& entity) {
+            // kinematic motion only moves the last simulated time
+            if (std::max(entity->getLastChangedOnServer(), entity->getLastSimulated()) >= since) {
+                entityIDs << entity->getID();
+            }
+        });
+        _serializeLockUsecs += usecTimestampNow() - lockStart;
+    });
+    return entityIDs;
+}
+
+bool EntityTree::writeEntitiesToList(const QVector<QUuid>& entityIDs, QVariantList& entities, bool skipDefaultValues,
+                                     bool skipThoseWithBadParents) {
+    // copy the properties under the lock, and convert them once it is released
+    std::vector<EntityItemProperties> properties(entityIDs.size());
+    std::vector<bool> found(entityIDs.size(), false);
+    withReadLock([&] {
+        quint64 lockStart = usecTimestampNow();
+        for (int i = 0; i < entityIDs.size(); ++i) {
+            EntityItemPointer entity = findEntityByID(entityIDs[i]);
+            // the same entities as RecurseOctreeToMapOperator leaves out of writeToMap()
+            if (entity && !(skipThoseWithBadParents && !entity->isParentIDValid())) {
+                properties[i] = entity->getProperties();
+                found[i] = true;
+            }
+        }
+        _serializeLockUsecs += usecTimestampNow() - lockStart;
+    });
+
+    entities.clear();
+    entities.reserve(entityIDs.size());
+    _helperScriptEngine.run([&] {
+        for (int i = 0; i < entityIDs.size(); ++i) {
+            if (!found[i]) {
+                entities << QVariant();
+                continue;
+            }
+            ScriptValue scriptValue = skipDefaultValues
+                ? EntityItemNonDefaultPropertiesToScriptValue(_helperScriptEngine.get(), properties[i])
+                : EntityItemPropertiesToScriptValue(_helperScriptEngine.get(), properties[i]);
+            entities << scriptValue.toVariant();
+        }
+    });
+    return true;
+}
+
+// Entities are stored in the snapshot as EntityAdd edit packets, which limit strings to 64KB, so any entity that fits a
+// buffer of this size is known to encode losslessly. The rare ones that don't are stored as JSON instead.
+const int MAX_SNAPSHOT_EDIT_RECORD_SIZE = 0xffff;
+
+bool EntityTree::writeToSnapshotFile(const char* fileName) {
+    // copy the properties under the lock, and encode them once it is released
+    std::vector<std::pair<EntityItemID, EntityItemProperties>> entities;
+    withReadLock([&] {
+        quint64 lockStart = usecTimestampNow();
+        entities.reserve(_entityMap.size());
+        _entityMap.forEach([&](const EntityItemPointer& entity) {
+            entities.emplace_back(entity->getEntityItemID(), entity->getProperties());
+        });
+        _serializeLockUsecs += usecTimestampNow() - lockStart;
     });
+
+    OctreeUtils::SnapshotHeader header;
+    QByteArray id = _persistID.toRfc4122();
+    memcpy(header.id, id.constData(), sizeof(header.id));
+    header.dataVersion = _persistDataVersion;
+    header.dataPacketType = (uint32_t)expectedDataPacketType();
+    header.dataPacketVersion = (uint32_t)expectedVersion();
+    header.recordPacketType = (uint32_t)PacketType::EntityAdd;
+    header.recordPacketVersion = (uint32_t)versionForPacketType(PacketType::EntityAdd);
+    header.numRecords = (uint32_t)entities.size();
+
+    QByteArray data;
+    data.reserve((int)(sizeof(header) + entities.size() * 256));
+    data.append(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    QByteArray buffer;
+    int numJSONRecords = 0;
+    for (auto& entity : entities) {
+        EntityItemProperties& entityProperties = entity.second;
+        entityProperties.markAllChanged();
+
+        OctreeUtils::SnapshotRecordHeader record;
+        record.created = entityProperties.getCreated();
+
+        buffer.resize(MAX_SNAPSHOT_EDIT_RECORD_SIZE);
+        EntityPropertyFlags didntFit;
+        auto appendState = EntityItemProperties::encodeEntityEditPacket(PacketType::EntityAdd, entity.first,
+            entityProperties, buffer, entityProperties.getChangedProperties(), didntFit);
+        if (appendState != OctreeElement::COMPLETED) {
+            record.encoding = OctreeUtils::SnapshotRecordHeader::JSON;
+            _helperScriptEngine.run([&] {
+                ScriptValue scriptValue = EntityItemNonDefaultPropertiesToScriptValue(_helperScriptEngine.get(), entityProperties);
+                buffer = QJsonDocument::fromVariant(scriptValue.toVariant()).toJson(QJsonDocument::Compact);
+            });
+            numJSONRecords++;
+        }
+
+        record.size = (uint32_t)buffer.size();
+        data.append(reinterpret_cast<const char*>(&record), sizeof(record));
+        data.append(buffer);
+    }
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+        qCCritical(entities) << "Failed to write entity snapshot" << fileName << file.errorString();
+        return false;
+    }
+
+    if (numJSONRecords > 0) {
+        qCDebug(entities) << "Entity snapshot" << fileName << "stored" << numJSONRecords << "oversized entities as JSON";
+    }
     return true;
 }
 
+bool EntityTree::readFromSnapshotFile(const QString& fileName) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCCritical(entities) << "Cannot open entity snapshot for reading:" << fileName;
+        return false;
+    }
+
+    // the records are decoded straight out of the mapped file, which is unmapped as soon as the entities are built
+    qint64 size = file.size();
+    const uchar* data = file.map(0, size);
+    if (!data) {
+        qCCritical(entities) << "Cannot map entity snapshot:" << fileName << file.errorString();
+        return false;
+    }
+
+    OctreeUtils::SnapshotHeader header;
+    if (!OctreeUtils::readSnapshotHeader(data, size, header)) {
+        qCCritical(entities) << "Not a valid entity snapshot:" << fileName;
+        return false;
+    }
+    if (header.dataPacketType != (uint32_t)expectedDataPacketType() || header.dataPacketVersion != (uint32_t)expectedVersion() ||
+        header.recordPacketType != (uint32_t)PacketType::EntityAdd ||
+        header.recordPacketVersion != (uint32_t)versionForPacketType(PacketType::EntityAdd)) {
+        qCCritical(entities) << "Entity snapshot" << fileName << "was written with packet version" << header.recordPacketVersion
+                             << "and can't be read by version" << (int)versionForPacketType(PacketType::EntityAdd);
+        return false;
+    }
+
+    _persistID = QUuid::fromRfc4122(QByteArray::fromRawData(reinterpret_cast<const char*>(header.id), sizeof(header.id)));
+    _persistDataVersion = header.dataVersion;
+    _namedPaths.clear();
+
+    QMap<QUuid, QVector<QUuid>> cloneIDs;
+
+    bool success = true;
+    qint64 offset = sizeof(header);
+    for (uint32_t i = 0; i < header.numRecords; ++i) {
+        OctreeUtils::SnapshotRecordHeader record;
+        if (offset + (qint64)sizeof(record) > size) {
+            qCCritical(entities) << "Entity snapshot" << fileName << "is truncated at record" << i;
+            success = false;
+            break;
+        }
+        memcpy(&record, data + offset, sizeof(record));
+        offset += sizeof(record);
+        if (offset + (qint64)record.size > size) {
+            qCCritical(entities) << "Entity snapshot" << fileName << "is truncated at record" << i;
+            success = false;
+            break;
+        }
+        const uchar* recordData = data + offset;
+        offset += record.size;
+
+        EntityItemID entityItemID;
+        EntityItemProperties properties;
+        if (record.encoding == OctreeUtils::SnapshotRecordHeader::EditPacket) {
+            int processedBytes = 0;
+            if (!EntityItemProperties::decodeEntityEditPacket(recordData, (int)record.size, processedBytes, entityItemID, properties)) {
+                qCDebug(entities) << "Failed to decode entity snapshot record" << i;
+                success = false;
+                continue;
+            }
+        } else {
+            QByteArray json = QByteArray::fromRawData(reinterpret_cast<const char*>(recordData), (int)record.size);
+            QVariantMap entityMap = QJsonDocument::fromJson(json).toVariant().toMap();
+            _helperScriptEngine.run([&] {
+                ScriptValue entityScriptValue = variantMapToScriptValue(entityMap, *_helperScriptEngine.get());
+                EntityItemPropertiesFromScriptValueIgnoreReadOnly(entityScriptValue, properties);
+            });
+            entityItemID = EntityItemID(QUuid(entityMap["id"].toString()));
+        }
+        properties.setCreated(record.created);
+
+        EntityItemPointer entity = addEntity(entityItemID, properties);
+        if (!entity) {
+            qCDebug(entities) << "adding Entity failed:" << entityItemID << properties.getType();
+            success = false;
+            continue;
+        }
+
+        const QUuid& cloneOriginID = entity->getCloneOriginID();
+        if (!cloneOriginID.isNull()) {
+            cloneIDs[cloneOriginID].push_back(entity->getEntityItemID());
+        }
+    }
+
+    for (const auto& entityID : cloneIDs.keys()) {
+        auto entity = findEntityByID(entityID);
+        if (entity) {
+            entity->setCloneIDs(cloneIDs.value(entityID));
+        }
+    }
+
+    file.unmap(const_cast<uchar*>(data));
+    return success;
+}
+
 void convertGrabUserDataToProperties(EntityItemProperties& properties) {
     GrabPropertyGroup& grabProperties = properties.getGrab();
     QJsonObject userData = QJsonDocument::fromJson(properties.getUserData().toUtf8()).object();
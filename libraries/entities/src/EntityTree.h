@@ -20,6 +20,7 @@
 #include <SpatialParentFinder.h>
 
 #include "AddEntityOperator.h"
+#include "EntityMap.h"
 #include "EntityTreeElement.h"
 #include "DeleteEntityOperator.h"
 #include "MovingEntitiesOperator.h"
@@ -197,6 +198,11 @@ public:
                             bool skipThoseWithBadParents) override;
     virtual bool readFromMap(QVariantMap& entityDescription, const bool isImport = false) override;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) override;
+    virtual bool writeEntitiesToList(const QVector<QUuid>& entityIDs, QVariantList& entities, bool skipDefaultValues,
+                                     bool skipThoseWithBadParents) override;
+    virtual QVector<QUuid> findEntitiesChangedOnServerSince(quint64 since) override;
+    virtual bool writeToSnapshotFile(const char* filename) override;
+    virtual bool readFromSnapshotFile(const QString& filename) override;
 
 
     glm::vec3 getContentsDimensions();
@@ -325,8 +331,7 @@ protected:
         _deletedEntityItemIDs << id;
     }
 
-    mutable QReadWriteLock _entityMapLock;
-    QHash<EntityItemID, EntityItemPointer> _entityMap;
+    EntityMap _entityMap;
 
     EntitySimulationPointer _simulation;
 
@@ -250,8 +250,12 @@ std::shared_ptr<storage::FileStorage> KtxStorage::maybeOpenFile() const {
         return file;
     }
 
-    // If the file isn't open, create it and save a weak_ptr to it
-    file = std::make_shared<storage::FileStorage>(_filename.c_str());
+    // If the file isn't open, create it and save a weak_ptr to it.  Cache entries share theirs with other readers
+    if (_cacheEntry) {
+        file = _cacheEntry->map();
+    } else {
+        file = std::make_shared<storage::FileStorage>(_filename.c_str());
+    }
     _cacheFile = file;
 
     {
@@ -565,6 +565,13 @@ public:
         }
     }
 
+    template <typename F>
+    void forEachLayer(F&& f) const {
+        for (const auto& layer : c) {
+            f(layer);
+        }
+    }
+
     // Schema to access the attribute values of the material
     class Schema {
     public:
@@ -19,11 +19,15 @@
 #include <QRgb>
 #include <QBuffer>
 #include <QImageReader>
+#include <QThread>
 
 #include <Finally.h>
 #include <Profile.h>
 #include <StatTracker.h>
 #include <GLMHelpers.h>
+#include <TBBHelpers.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 
 #include "TGAReader.h"
 #if !defined(Q_OS_ANDROID)
@@ -56,6 +60,16 @@ static const auto& GPU_CUBEMAP_HDR_FORMAT = gpu::Element::COLOR_R11G11B10;
 
 namespace image {
 
+static std::atomic<int> textureCompressionThreads { AUTOMATIC_COMPRESSION_THREADS };
+
+void setTextureCompressionThreads(int numThreads) {
+    textureCompressionThreads.store(std::max(0, numThreads));
+}
+
+int getTextureCompressionThreads() {
+    return textureCompressionThreads.load();
+}
+
 uint rectifyDimension(const uint& dimension) {
     if (dimension == 0) {
         return 0;
@@ -520,6 +534,78 @@ public:
     }
 };
 
+// NVTT splits each mip into tiles of blocks and compresses each tile with a task of its own, writing to its own part of
+// the output, so running the tasks in parallel produces the same bytes.
+class ParallelTaskDispatcher : public nvtt::TaskDispatcher {
+public:
+    ParallelTaskDispatcher(int numThreads, const std::atomic<bool>& abortProcessing) :
+        _arena(numThreads == AUTOMATIC_COMPRESSION_THREADS ? tbb::task_arena::automatic : numThreads),
+        _abortProcessing(abortProcessing) {}
+
+    void dispatch(nvtt::Task* task, void* context, int count) override {
+        _arena.execute([&] {
+            tbb::parallel_for(0, count, [&](int i) {
+                if (!_abortProcessing.load()) {
+                    task(context, i);
+                }
+            });
+        });
+    }
+
+private:
+    tbb::task_arena _arena;
+    const std::atomic<bool>& _abortProcessing;
+};
+
+std::unique_ptr<nvtt::TaskDispatcher> createTaskDispatcher(const std::atomic<bool>& abortProcessing) {
+    int numThreads = getTextureCompressionThreads();
+    if (numThreads == 1) {
+        return std::make_unique<SequentialTaskDispatcher>(abortProcessing);
+    }
+    return std::make_unique<ParallelTaskDispatcher>(numThreads, abortProcessing);
+}
+
+// Compresses the surface into mipLevel and, if buildMips, the rest of its mip chain into the following levels. When
+// compressing on several threads, each mip is built from the previous one while that one is being compressed.
+template <typename Compressor>
+void compressSurfaceMips(Compressor& compressor, nvtt::Surface& surface, int face, int mipLevel, bool buildMips,
+                         const nvtt::CompressionOptions& compressionOptions, const nvtt::OutputOptions& outputOptions,
+                         const std::atomic<bool>& abortProcessing) {
+    if (getTextureCompressionThreads() == 1) {
+        compressor.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
+        if (buildMips) {
+            while (surface.canMakeNextMipmap() && !abortProcessing.load()) {
+                surface.buildNextMipmap(nvtt::MipmapFilter_Box);
+                compressor.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
+            }
+        }
+        return;
+    }
+
+    tbb::task_group mipBuilder;
+    while (true) {
+        bool hasNextMip = buildMips && surface.canMakeNextMipmap();
+        nvtt::Surface nextSurface;
+        if (hasNextMip) {
+            // Surfaces share their pixels on copy, so detach the copy here, with the non-const data(), rather than leave
+            // buildNextMipmap() to do it on the worker while the compressor reads the same pixels through surface
+            nextSurface = surface;
+            nextSurface.data();
+            mipBuilder.run([&nextSurface] {
+                nextSurface.buildNextMipmap(nvtt::MipmapFilter_Box);
+            });
+        }
+
+        compressor.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
+        mipBuilder.wait();
+
+        if (!hasNextMip || abortProcessing.load()) {
+            break;
+        }
+        surface = nextSurface;
+    }
+}
+
 void convertToFloatFromPacked(const unsigned char* source, int width, int height, size_t srcLineByteStride, gpu::Element sourceFormat,
                               glm::vec4* output, size_t outputLinePixelStride) {
     glm::vec4* outputIt;
@@ -622,17 +708,10 @@ void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
     surface.setAlphaMode(nvtt::AlphaMode_None);
     surface.setWrapMode(nvtt::WrapMode_Mirror);
 
-    SequentialTaskDispatcher dispatcher(abortProcessing);
-    nvtt::Compressor compressor;
-    context.setTaskDispatcher(&dispatcher);
+    auto dispatcher = createTaskDispatcher(abortProcessing);
+    context.setTaskDispatcher(dispatcher.get());
 
-    context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
-    if (buildMips) {
-        while (surface.canMakeNextMipmap() && !abortProcessing.load()) {
-            surface.buildNextMipmap(nvtt::MipmapFilter_Box);
-            context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
-        }
-    }
+    compressSurfaceMips(context, surface, face, mipLevel, buildMips, compressionOptions, outputOptions, abortProcessing);
 }
 
 void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarget target, int baseMipLevel, bool buildMips, const std::atomic<bool>& abortProcessing, int face) {
@@ -759,16 +838,11 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
         MyErrorHandler errorHandler;
         outputOptions.setErrorHandler(&errorHandler);
 
-        SequentialTaskDispatcher dispatcher(abortProcessing);
+        auto dispatcher = createTaskDispatcher(abortProcessing);
         nvtt::Compressor context;
+        context.setTaskDispatcher(dispatcher.get());
 
-        context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
-        if (buildMips) {
-            while (surface.canMakeNextMipmap() && !abortProcessing.load()) {
-                surface.buildNextMipmap(nvtt::MipmapFilter_Box);
-                context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
-            }
-        }
+        compressSurfaceMips(context, surface, face, mipLevel, buildMips, compressionOptions, outputOptions, abortProcessing);
     } else {
         int numMips = 1;
 
@@ -807,7 +881,9 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
 
         const Etc::ErrorMetric errorMetric = Etc::ErrorMetric::RGBA;
         const float effort = 1.0f;
-        const int numEncodeThreads = 4;
+        // Etc encodes each block on its own, so the output doesn't depend on the number of threads
+        const int numEncodeThreads = getTextureCompressionThreads() == AUTOMATIC_COMPRESSION_THREADS ?
+            std::max(1, QThread::idealThreadCount()) : getTextureCompressionThreads();
         int encodingTime;
 
         if (localCopy.getFormat() != Image::Format_RGBAF) {
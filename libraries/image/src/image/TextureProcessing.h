@@ -124,6 +124,13 @@ gpu::TexturePointer processCubeTextureColorFromImage(Image&& srcImage, const std
 
 const QStringList getSupportedFormats();
 
+const int AUTOMATIC_COMPRESSION_THREADS = 0;
+
+// Number of threads each texture is compressed on, or AUTOMATIC_COMPRESSION_THREADS (the default) for one per core. With
+// 1, textures are compressed on the thread that processes them. The compressed output is the same for any number.
+void setTextureCompressionThreads(int numThreads);
+int getTextureCompressionThreads();
+
 std::pair<gpu::TexturePointer, glm::ivec2> processImage(std::shared_ptr<QIODevice> content, const std::string& url, ColorChannel sourceChannel,
                                                         int maxNumPixels, TextureUsage::Type textureType,
                                                         bool compress, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false);
@@ -24,7 +24,10 @@ const int KTXCache::INVALID_VERSION = 0x00;
 const char* KTXCache::SETTING_VERSION_NAME = "hifi.ktx.cache_version";
 
 KTXCache::KTXCache(const std::string& dir, const std::string& ext) :
-    FileCache(dir, ext) { }
+    FileCache(dir, ext) {
+    // tens of thousands of textures can be cached, so don't scan them all on startup
+    setPersistentIndex(true);
+}
 
 void KTXCache::initialize() {
     FileCache::initialize();
@@ -435,7 +435,11 @@ void NetworkTexture::setExtra(void* extra) {
     if (!_textureSource || needsNewTextureSource) {
         _textureSource = std::make_shared<gpu::TextureSource>(_url, (int)_type);
     }
-    _lowestRequestedMipLevel = 0;
+    auto textureCache = DependencyManager::get<TextureCache>();
+    _mipStreaming = textureCache && textureCache->getMipStreaming();
+    if (!_mipStreaming) {
+        _lowestRequestedMipLevel = 0;
+    }
 
     auto fileNameLowercase = _url.fileName().toLower();
     if (fileNameLowercase.endsWith(TEXTURE_META_EXTENSION)) {
@@ -537,7 +541,9 @@ void NetworkTexture::makeRequest() {
         return;
     }
 
-    if (isLocalUrl(_activeUrl)) {
+    // When streaming mips, local files are read by range like remote ones, through FileResourceRequest
+    bool isReadByRange = _mipStreaming && _activeUrl.scheme() != RESOURCE_SCHEME;
+    if (isLocalUrl(_activeUrl) && !isReadByRange) {
         auto self = _self;
         QtConcurrent::run(QThreadPool::globalInstance(), [self] {
             auto resource = self.lock();
@@ -700,7 +706,23 @@ void NetworkTexture::startRequestForNextMipLevel() {
     }
 
     _lowestKnownPopulatedMip = texture->minAvailableMipLevel();
+    if (_requestedScreenSize > 0.0f) {
+        uint16_t mipLevel = evalMipLevelForScreenSize(texture->getWidth(), texture->getHeight(), _requestedScreenSize);
+        _lowestRequestedMipLevel = std::min(_lowestRequestedMipLevel, mipLevel);
+        _requestedScreenSize = 0.0f;
+    }
+
     if (_lowestRequestedMipLevel < _lowestKnownPopulatedMip) {
+        if (_mipStreaming) {
+            // Don't fetch mips that the GPU would have to drop straight away, until the texture is asked for again
+            size_t allowedGPUMemory = gpu::Texture::getAllowedGPUMemoryUsage();
+            size_t populatedGPUMemory = gpu::Context::getTextureResourcePopulatedGPUMemSize();
+            if (allowedGPUMemory > 0 &&
+                populatedGPUMemory + texture->evalMipSize(_lowestKnownPopulatedMip - 1) > allowedGPUMemory) {
+                return;
+            }
+        }
+
         _ktxResourceState = PENDING_MIP_REQUEST;
 
         init(false);
@@ -711,6 +733,55 @@ void NetworkTexture::startRequestForNextMipLevel() {
     }
 }
 
+void NetworkTexture::requestMipLevel(int mipLevel) {
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, "requestMipLevel", Q_ARG(int, mipLevel));
+        return;
+    }
+
+    uint16_t level = (uint16_t)std::max(0, std::min(mipLevel, (int)NULL_MIP_LEVEL - 1));
+    if (level < _lowestRequestedMipLevel) {
+        _lowestRequestedMipLevel = level;
+    }
+    startRequestForNextMipLevel();
+}
+
+void NetworkTexture::requestScreenSize(float pixels) {
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, "requestScreenSize", Q_ARG(float, pixels));
+        return;
+    }
+
+    _requestedScreenSize = std::max(_requestedScreenSize, pixels);
+    startRequestForNextMipLevel();
+}
+
+uint16_t NetworkTexture::evalMipLevelForScreenSize(int width, int height, float pixels) {
+    int size = std::max(width, height);
+    if (size <= 0 || pixels >= (float)size) {
+        return 0;
+    }
+    // Each mip halves the size, so this is the coarsest mip that still has a texel for every pixel
+    float level = floorf(log2f((float)size / std::max(pixels, 1.0f)));
+    return (uint16_t)std::max(0.0f, level);
+}
+
+int NetworkTexture::getResidentMipLevel() const {
+    auto texture = _textureSource ? _textureSource->getGPUTexture() : nullptr;
+    if (!texture || !texture->isDefined()) {
+        return -1;
+    }
+    return texture->minAvailableMipLevel();
+}
+
+size_t NetworkTexture::getResidentSize() const {
+    auto texture = _textureSource ? _textureSource->getGPUTexture() : nullptr;
+    if (!texture || !texture->isDefined()) {
+        return 0;
+    }
+    return texture->evalTotalSize(texture->minAvailableMipLevel());
+}
+
 // Load mips in the range [low, high] (inclusive)
 void NetworkTexture::startMipRangeRequest(uint16_t low, uint16_t high) {
     if (_ktxMipRequest) {
@@ -12,6 +12,8 @@
 #ifndef hifi_TextureCache_h
 #define hifi_TextureCache_h
 
+#include <atomic>
+
 #include <gpu/Texture.h>
 
 #include <QImage>
@@ -73,6 +75,19 @@ public:
 
     void setExtra(void* extra) override;
 
+    // Mip streaming (see TextureCache::setMipStreaming()): report the finest mip, or the size in pixels on screen, that
+    // the texture is needed at. Requests only ever make the texture sharper, and can be made before it has loaded.
+    Q_INVOKABLE void requestMipLevel(int mipLevel);
+    Q_INVOKABLE void requestScreenSize(float pixels);
+
+    // The finest mip a texture of the given size needs to cover the given number of pixels on screen.
+    static uint16_t evalMipLevelForScreenSize(int width, int height, float pixels);
+
+    // The finest mip held by the texture and the bytes used by it and the coarser mips, or -1 and 0 if it isn't loaded.
+    int getResidentMipLevel() const;
+    size_t getResidentSize() const;
+    int getRequestedMipLevel() const { return _lowestRequestedMipLevel == NULL_MIP_LEVEL ? -1 : _lowestRequestedMipLevel; }
+
 signals:
     void networkTextureCreated(const QWeakPointer<NetworkTexture>& self);
 
@@ -137,6 +152,8 @@ private:
 
     uint16_t _lowestRequestedMipLevel { NULL_MIP_LEVEL };
     uint16_t _lowestKnownPopulatedMip { NULL_MIP_LEVEL };
+    float _requestedScreenSize { 0.0f }; // resolved into _lowestRequestedMipLevel once the size of the texture is known
+    bool _mipStreaming { false };
 
     // This is a copy of the original KTX descriptor from the source url.
     // We need this because the KTX that will be cached will likely include extra data
@@ -203,6 +220,15 @@ public:
     static const int DEFAULT_SPECTATOR_CAM_WIDTH { 2048 };
     static const int DEFAULT_SPECTATOR_CAM_HEIGHT { 1024 };
 
+    /// When enabled, KTX textures load their low mips and then only the finer mips they are requested at through
+    /// NetworkTexture::requestMipLevel() or requestScreenSize(), and not while the GPU texture memory is full.
+    /// Local KTX files are then read by range too, rather than all at once. Takes effect for textures created afterwards.
+    /// Models request the projected size of their parts as they render. Mips are never dropped here: under memory pressure
+    /// the GL backend's texture transfer engine demotes resource textures on the GPU, and promotes them again from the mips
+    /// already fetched once there is room.
+    void setMipStreaming(bool enabled) { _mipStreaming = enabled; }
+    bool getMipStreaming() const { return _mipStreaming; }
+
     void setGPUContext(const gpu::ContextPointer& context) { _gpuContext = context; }
     gpu::ContextPointer getGPUContext() const { return _gpuContext; }
 
@@ -232,6 +258,8 @@ private:
 
     std::shared_ptr<cache::FileCache> _ktxCache { nullptr };
 
+    std::atomic<bool> _mipStreaming { false };
+
     // Map from image hashes to texture weak pointers
     std::unordered_map<std::string, std::pair<std::weak_ptr<gpu::Texture>, glm::ivec2>> _texturesByHashes;
     std::mutex _texturesByHashesMutex;
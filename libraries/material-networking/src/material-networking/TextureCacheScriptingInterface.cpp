@@ -21,3 +21,36 @@ TextureCacheScriptingInterface::TextureCacheScriptingInterface() :
 ScriptableResource* TextureCacheScriptingInterface::prefetch(const QUrl& url, int type, int maxNumPixels) {
     return DependencyManager::get<TextureCache>()->prefetch(url, type, maxNumPixels);
 }
+
+QVariantList TextureCacheScriptingInterface::getTextureResidency(const QUrl& url) {
+    QVariantList residencies;
+    for (const auto& resource : DependencyManager::get<TextureCache>()->findResources(url)) {
+        auto texture = resource.staticCast<NetworkTexture>();
+        auto gpuTexture = texture->getGPUTexture();
+
+        QVariantMap residency;
+        residency["type"] = (int)texture->getTextureType();
+        residency["width"] = texture->getWidth();
+        residency["height"] = texture->getHeight();
+        residency["numMips"] = gpuTexture ? (int)gpuTexture->getNumMips() : 0;
+        residency["residentMip"] = texture->getResidentMipLevel();
+        residency["residentBytes"] = (qulonglong)texture->getResidentSize();
+        residency["requestedMip"] = texture->getRequestedMipLevel();
+        residencies << residency;
+    }
+    return residencies;
+}
+
+void TextureCacheScriptingInterface::requestTextureScreenSize(const QUrl& url, float pixels) {
+    for (const auto& resource : DependencyManager::get<TextureCache>()->findResources(url)) {
+        resource.staticCast<NetworkTexture>()->requestScreenSize(pixels);
+    }
+}
+
+bool TextureCacheScriptingInterface::getMipStreaming() const {
+    return DependencyManager::get<TextureCache>()->getMipStreaming();
+}
+
+void TextureCacheScriptingInterface::setMipStreaming(bool enabled) {
+    DependencyManager::get<TextureCache>()->setMipStreaming(enabled);
+}
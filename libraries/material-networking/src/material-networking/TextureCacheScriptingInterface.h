@@ -22,6 +22,8 @@
 class TextureCacheScriptingInterface : public ScriptableResourceCache, public Dependency {
     Q_OBJECT
 
+    Q_PROPERTY(bool mipStreaming READ getMipStreaming WRITE setMipStreaming)
+
     // Properties are copied over from ResourceCache (see ResourceCache.h for reason).
 
     /*@jsdoc
@@ -41,6 +43,10 @@ class TextureCacheScriptingInterface : public ScriptableResourceCache, public De
      *     <em>Read-only.</em>
      * @property {number} numGlobalQueriesLoading - Total number of global queries loading (across all resource cache managers).
      *     <em>Read-only.</em>
+     * @property {boolean} mipStreaming - <code>true</code> if KTX textures loaded from now on stop after their low resolution
+     *     mips, and only load finer mips down to the size they are requested at with
+     *     {@link TextureCache.requestTextureScreenSize|requestTextureScreenSize}, <code>false</code> if they load all their
+     *     mips. Default value: <code>false</code>.
      *
      * @borrows ResourceCache.getResourceList as getResourceList
      * @borrows ResourceCache.updateTotalSize as updateTotalSize
@@ -63,6 +69,40 @@ public:
      */
     Q_INVOKABLE ScriptableResource* prefetch(const QUrl& url, int type, int maxNumPixels = ABSOLUTE_MAX_TEXTURE_NUM_PIXELS);
 
+    /*@jsdoc
+     * Details of how much of a texture is loaded.
+     * @typedef {object} TextureCache.TextureResidency
+     * @property {TextureCache.TextureType} type - The type of the texture.
+     * @property {number} width - The width of the texture, in pixels.
+     * @property {number} height - The height of the texture, in pixels.
+     * @property {number} numMips - The number of mips in the texture.
+     * @property {number} residentMip - The finest mip held by the texture, <code>0</code> being the full resolution, or
+     *     <code>-1</code> if the texture isn't loaded.
+     * @property {number} residentBytes - The size in bytes of the mips held by the texture.
+     * @property {number} requestedMip - The finest mip requested for the texture, or <code>-1</code> if only its low
+     *     resolution mips are requested.
+     */
+    /*@jsdoc
+     * Gets how much of a texture is loaded: the finest mip it holds and the memory that it uses.
+     * @function TextureCache.getTextureResidency
+     * @param {string} url - The URL of the texture.
+     * @returns {TextureCache.TextureResidency[]} The residency of each texture loaded from the URL, one per texture type it
+     *     is used as. Empty if no texture from the URL is in the cache.
+     */
+    Q_INVOKABLE QVariantList getTextureResidency(const QUrl& url);
+
+    /*@jsdoc
+     * Requests the mips a texture needs to be displayed at a size on screen. Only has an effect on KTX textures loaded while
+     * <code>mipStreaming</code> is <code>true</code>, and only ever makes them sharper.
+     * @function TextureCache.requestTextureScreenSize
+     * @param {string} url - The URL of the texture.
+     * @param {number} pixels - The size of the texture on screen, in pixels along its longest side.
+     */
+    Q_INVOKABLE void requestTextureScreenSize(const QUrl& url, float pixels);
+
+    bool getMipStreaming() const;
+    void setMipStreaming(bool enabled);
+
 signals:
     /*@jsdoc
      * @function TextureCache.spectatorCameraFramebufferReset
@@ -194,7 +194,8 @@ namespace baker {
     };
 
     Baker::Baker(const hfm::Model::Pointer& hfmModel, const hifi::VariantHash& mapping, const hifi::URL& materialMappingBaseURL) :
-        _engine(std::make_shared<Engine>(BakerEngineBuilder::JobModel::create("Baker"), std::make_shared<BakeContext>())) {
+        _context(std::make_shared<BakeContext>()),
+        _engine(std::make_shared<Engine>(BakerEngineBuilder::JobModel::create("Baker"), _context)) {
         _engine->feedInput<BakerEngineBuilder::Input>(0, hfmModel);
         _engine->feedInput<BakerEngineBuilder::Input>(1, mapping);
         _engine->feedInput<BakerEngineBuilder::Input>(2, materialMappingBaseURL);
@@ -27,6 +27,11 @@ namespace baker {
 
         std::shared_ptr<TaskConfig> getConfiguration();
 
+        // Spreads the per-mesh work of the bake over numThreads threads, or as many as there are cores with
+        // BakeContext::AUTOMATIC_THREADS. The output is the same for any number of threads. Defaults to 1.
+        void setNumThreads(int numThreads) { _context->numThreads = numThreads; }
+        int getNumThreads() const { return _context->numThreads; }
+
         void run();
 
         // Outputs, available after run() is called
@@ -38,6 +43,7 @@ namespace baker {
         std::vector<std::vector<hifi::ByteArray>> getDracoMaterialLists() const;
 
     protected:
+        BakeContextPointer _context;
         EnginePointer _engine;
     };
 };
@@ -0,0 +1,34 @@
+//
+//  Engine.cpp
+//  model-baker/src/model-baker
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "Engine.h"
+
+#include <algorithm>
+
+#include <TBBHelpers.h>
+#include <tbb/task_arena.h>
+
+void baker::BakeContext::forEach(int count, const std::function<void(int)>& function) const {
+    if (numThreads == 1 || count <= 1) {
+        for (int i = 0; i < count; i++) {
+            function(i);
+        }
+        return;
+    }
+
+    // An arena of its own caps the concurrency of this bake without limiting other users of TBB.
+    int maxConcurrency = numThreads == AUTOMATIC_THREADS ? tbb::task_arena::automatic : std::min(numThreads, count);
+    tbb::task_arena arena(maxConcurrency);
+    arena.execute([&] {
+        tbb::parallel_for(0, count, [&](int i) {
+            function(i);
+        });
+    });
+}
@@ -12,13 +12,22 @@
 #ifndef hifi_baker_Engine_h
 #define hifi_baker_Engine_h
 
+#include <functional>
+
 #include <task/Task.h>
 
 namespace baker {
 
     class BakeContext : public task::JobContext {
     public:
-        // No context settings yet for model prep
+        static const int AUTOMATIC_THREADS = 0;
+
+        // Number of threads the per-mesh work of a task is spread over. 1 runs it on the calling thread.
+        int numThreads { 1 };
+
+        // Calls function(i) for each i in [0, count), in parallel when numThreads allows it. Each call must only write
+        // to its own outputs, so that the results don't depend on the number of threads.
+        void forEach(int count, const std::function<void(int)>& function) const;
     };
     using BakeContextPointer = std::shared_ptr<BakeContext>;
 
@@ -172,6 +172,7 @@ void GeometryReader::run() {
 
         // Do processing on the model
         baker::Baker modelBaker(hfmModel, _mapping.second, _mapping.first);
+        modelBaker.setNumThreads(baker::BakeContext::AUTOMATIC_THREADS);
         modelBaker.run();
 
         auto processedHFMModel = modelBaker.getHFMModel();
@@ -0,0 +1,84 @@
+//
+//  DomainListJournal.cpp
+//  libraries/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DomainListJournal.h"
+
+#include <QtCore/QDataStream>
+#include <QtCore/QSet>
+
+const int DomainListJournal::MAX_NUM_ENTRIES = 4096;
+
+bool DomainListJournal::update(const std::vector<SharedNodePointer>& nodes) {
+    quint64 version = _version + 1;
+    size_t numEntries = _entries.size();
+
+    QSet<QUuid> seen;
+    seen.reserve((int)nodes.size());
+    for (const auto& node : nodes) {
+        QByteArray data;
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream << *node;
+
+        const QUuid& nodeID = node->getUUID();
+        seen.insert(nodeID);
+        auto it = _nodes.find(nodeID);
+        if (it == _nodes.end()) {
+            _nodes.insert(nodeID, { (NodeType_t)node->getType(), data });
+        } else if (it->data != data) {
+            it->type = node->getType();
+            it->data = data;
+        } else {
+            continue;
+        }
+        _entries.push_back({ version, nodeID, (NodeType_t)node->getType() });
+    }
+
+    for (auto it = _nodes.begin(); it != _nodes.end();) {
+        if (!seen.contains(it.key())) {
+            _entries.push_back({ version, it.key(), it->type });
+            it = _nodes.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (_entries.size() == numEntries) {
+        return false;
+    }
+
+    _version = version;
+    while (_entries.size() > (size_t)MAX_NUM_ENTRIES) {
+        // a node that has seen this version or a later one doesn't need the entry anymore
+        _oldestVersion = _entries.front().version;
+        _entries.pop_front();
+    }
+    return true;
+}
+
+bool DomainListJournal::getChangesSince(quint64 version, Changes& changes) const {
+    // version 0 means the node has never received a whole list
+    if (version == 0 || version < _oldestVersion || version > _version) {
+        return false;
+    }
+
+    QSet<QUuid> found;
+    for (auto it = _entries.rbegin(); it != _entries.rend() && it->version > version; ++it) {
+        if (found.contains(it->nodeID)) {
+            continue;
+        }
+        found.insert(it->nodeID);
+        if (_nodes.contains(it->nodeID)) {
+            changes.changed.push_back(it->nodeID);
+        } else {
+            changes.removed.push_back({ it->nodeID, it->type });
+        }
+    }
+    return true;
+}
@@ -0,0 +1,73 @@
+//
+//  DomainListJournal.h
+//  libraries/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DomainListJournal_h
+#define hifi_DomainListJournal_h
+
+#include <deque>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QUuid>
+#include <QtCore/QVector>
+
+#include "Node.h"
+
+// After its header, a DomainList holds one record per node: its index in the list, the record type, and either the node
+// and the connection secret for it, or just the ID of a removed node. Every packet of the list repeats the header, which
+// carries the list's version, the version it holds the changes since (0 for the whole list) and its number of records.
+enum class DomainListRecord : quint8 {
+    Node = 0,
+    RemovedNode
+};
+
+// The domain-server's versioned record of the node list it sends in DomainList packets.
+//   Each update serializes every node once, as it is written to a DomainList, and journals the nodes that were added,
+//   changed or removed since the previous update under a new version. A node that checks in with the last version it
+//   received in full can then be sent just the nodes that changed since, instead of the whole list. The journal keeps
+//   a bounded number of entries, a node that has fallen further behind than that gets the whole list again.
+class DomainListJournal {
+public:
+    static const int MAX_NUM_ENTRIES;
+
+    struct NodeEntry {
+        NodeType_t type;
+        QByteArray data; // the node as written to a DomainList, without the connection secret
+    };
+
+    struct Changes {
+        QVector<QUuid> changed; // added or changed, in getNodes()
+        QVector<QPair<QUuid, NodeType_t>> removed;
+    };
+
+    quint64 getVersion() const { return _version; }
+    const QHash<QUuid, NodeEntry>& getNodes() const { return _nodes; }
+
+    // Records what changed since the previous update, returns true if anything did
+    bool update(const std::vector<SharedNodePointer>& nodes);
+
+    // Returns false when the changes since that version are no longer all journaled, or were never sent
+    bool getChangesSince(quint64 version, Changes& changes) const;
+
+private:
+    struct Entry {
+        quint64 version;
+        QUuid nodeID;
+        NodeType_t type;
+    };
+
+    QHash<QUuid, NodeEntry> _nodes;
+    std::deque<Entry> _entries;
+    quint64 _version { 0 };
+    quint64 _oldestVersion { 0 }; // the oldest version changes can still be found from
+};
+
+#endif // hifi_DomainListJournal_h
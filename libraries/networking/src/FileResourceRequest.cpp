@@ -11,6 +11,8 @@
 
 #include "FileResourceRequest.h"
 
+#include <algorithm>
+
 #include <QtCore/QFile>
 #include <QtCore/QFileSelector>
 #include <QtCore/QDateTime>
@@ -58,9 +60,13 @@ void FileResourceRequest::doSend() {
             setProperty("last-modified", toHttpDateString(QFileInfo(file).lastModified().toMSecsSinceEpoch()));
             if (file.open(QFile::ReadOnly)) {
 
-                if (file.size() < _byteRange.fromInclusive || file.size() < _byteRange.toExclusive) {
+                if (file.size() < _byteRange.fromInclusive ||
+                    (file.size() == _byteRange.fromInclusive && file.size() < _byteRange.toExclusive)) {
                     _result = ResourceRequest::InvalidByteRange;
                 } else {
+                    // like HTTP servers, serve what there is of a range that runs past the end of the file
+                    _byteRange.toExclusive = std::min(_byteRange.toExclusive, (int64_t)file.size());
+
                     // fix it up based on the known size of the file
                     _byteRange.fixupRange(file.size());
 
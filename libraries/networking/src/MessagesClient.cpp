@@ -101,6 +101,31 @@ std::unique_ptr<NLPacketList> MessagesClient::encodeMessagesDataPacket(QString c
     return packetList;
 }
 
+bool MessagesClient::peekMessagesPacketChannel(const QByteArray& payload, QByteArray& channelUtf8) {
+    const char* data = payload.constData();
+    const qint64 size = payload.size();
+
+    quint16 channelLength;
+    if (size < (qint64)sizeof(channelLength)) {
+        return false;
+    }
+    memcpy(&channelLength, data, sizeof(channelLength));
+
+    qint64 messageLengthOffset = sizeof(channelLength) + channelLength + sizeof(bool);
+    quint32 messageLength;
+    if (size < messageLengthOffset + (qint64)sizeof(messageLength)) {
+        return false;
+    }
+    memcpy(&messageLength, data + messageLengthOffset, sizeof(messageLength));
+
+    if (size != messageLengthOffset + (qint64)sizeof(messageLength) + messageLength + NUM_BYTES_RFC4122_UUID) {
+        return false;
+    }
+
+    channelUtf8 = payload.mid(sizeof(channelLength), channelLength);
+    return true;
+}
+
 
 void MessagesClient::handleMessagesPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
     QString channel, message;
@@ -168,6 +168,11 @@ public:
     static std::unique_ptr<NLPacketList> encodeMessagesPacket(QString channel, QString message, QUuid senderID);
     static std::unique_ptr<NLPacketList> encodeMessagesDataPacket(QString channel, QByteArray data, QUuid senderID);
 
+    // Reads just the channel of an encoded MessagesData payload, without decoding the message. Only the lengths are
+    // checked: returns false unless they add up to the payload size. The channel isn't validated as UTF-8, nor the
+    // text/data flag byte, so a payload this accepts can still fail to decode.
+    static bool peekMessagesPacketChannel(const QByteArray& payload, QByteArray& channelUtf8);
+
 signals:
     /*@jsdoc
      * Triggered when a text message is received.
@@ -35,6 +35,7 @@
 #include "Assignment.h"
 #include "AudioHelpers.h"
 #include "DomainAccountManager.h"
+#include "DomainListJournal.h"
 #include "SockAddr.h"
 #include "FingerprintUtils.h"
 
@@ -87,6 +88,13 @@ NodeList::NodeList(char newOwnerType, int socketListenPort, int dtlsListenPort)
     // clear our NodeList when the domain changes
     connect(&_domainHandler, SIGNAL(disconnectedFromDomain()), this, SLOT(resetFromDomainHandler()));
 
+    // a node we drop on our own, e.g. for going silent, is only sent to us again in a whole domain list
+    connect(this, &LimitedNodeList::nodeKilled, this, [this] {
+        if (!_isApplyingDomainServerRemoval) {
+            _domainListVersion = 0;
+        }
+    }, Qt::DirectConnection);
+
     // send an ICE heartbeat as soon as we get ice server information
     connect(&_domainHandler, &DomainHandler::iceSocketAndIDReceived, this, &NodeList::handleICEConnectionToDomainServer);
 
@@ -315,6 +323,9 @@ void NodeList::reset(QString reason, bool skipDomainHandlerReset) {
         _domainHandler.softReset(reason);
     }
 
+    _domainListVersion = 0;
+    _pendingDomainList = PendingDomainList();
+
     // refresh the owner UUID to the NULL UUID
     setSessionUUID(QUuid());
     setSessionLocalID(Node::NULL_LOCAL_ID);
@@ -501,6 +512,11 @@ void NodeList::sendDomainServerCheckIn() {
             << localSockAddr << _nodeTypesOfInterest.values();
         packetStream << DependencyManager::get<AddressManager>()->getPlaceName();
 
+        if (domainIsConnected) {
+            // the last node list we received whole, so that we're only sent what changed since
+            packetStream << _domainListVersion.load();
+        }
+
         if (!domainIsConnected) {
 
             // Directory services account.
@@ -762,6 +778,12 @@ void NodeList::processDomainList(QSharedPointer<ReceivedMessage> message) {
     bool newConnection;
     packetStream >> newConnection;
 
+    // the node list version this packet brings us to, and the version it holds the changes since, 0 for the whole list
+    quint64 domainListVersion;
+    quint64 domainListBaseVersion;
+    quint32 numDomainListRecords;
+    packetStream >> domainListVersion >> domainListBaseVersion >> numDomainListRecords;
+
     if (newConnection) {
         _nodeConnectTimestamp = usecTimestampNow();
         _connectReason = Connect;
@@ -858,9 +880,50 @@ void NodeList::processDomainList(QSharedPointer<ReceivedMessage> message) {
     setPermissions(newPermissions);
     setAuthenticatePackets(isAuthenticated);
 
-    // pull each node in the packet
-    while (packetStream.device()->pos() < message->getSize()) {
-        parseNodeFromPacketStream(packetStream);
+    parseDomainListRecords(packetStream, message->getSize(), domainListVersion, domainListBaseVersion, numDomainListRecords);
+}
+
+void NodeList::parseDomainListRecords(QDataStream& packetStream, qint64 size, quint64 version, quint64 baseVersion,
+                                      quint32 numRecords) {
+    if (version < _domainListVersion) {
+        // an older list arriving late, what it holds may have changed since
+        return;
+    }
+
+    auto& pending = _pendingDomainList;
+    if (pending.version != version || pending.baseVersion != baseVersion || pending.received.size() != numRecords) {
+        pending.version = version;
+        pending.baseVersion = baseVersion;
+        pending.received.assign(numRecords, false);
+        pending.numReceived = 0;
+    }
+
+    // pull each node, or removed node, in the packet
+    while (packetStream.device()->pos() < size) {
+        quint32 index;
+        DomainListRecord recordType;
+        packetStream >> index >> recordType;
+
+        if (recordType == DomainListRecord::RemovedNode) {
+            QUuid nodeUUID;
+            packetStream >> nodeUUID;
+            _isApplyingDomainServerRemoval = true;
+            killNodeWithUUID(nodeUUID);
+            _isApplyingDomainServerRemoval = false;
+            removeDelayedAdd(nodeUUID);
+        } else {
+            parseNodeFromPacketStream(packetStream);
+        }
+
+        if (index < numRecords && !pending.received[index]) {
+            pending.received[index] = true;
+            ++pending.numReceived;
+        }
+    }
+
+    // a list of what changed since a version is only whole for us if we had that version ourselves
+    if (pending.numReceived == numRecords && (baseVersion == 0 || baseVersion <= _domainListVersion)) {
+        _domainListVersion = version;
     }
 }
 
@@ -876,7 +939,9 @@ void NodeList::processDomainServerRemovedNode(QSharedPointer<ReceivedMessage> me
     // read the UUID from the packet, remove it if it exists
     QUuid nodeUUID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
     qCDebug(networking) << "Received packet from domain-server to remove node with UUID" << uuidStringWithoutCurlyBraces(nodeUUID);
+    _isApplyingDomainServerRemoval = true;
     killNodeWithUUID(nodeUUID);
+    _isApplyingDomainServerRemoval = false;
     removeDelayedAdd(nodeUUID);
 }
 
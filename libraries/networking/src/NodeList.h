@@ -170,6 +170,8 @@ private:
     void sendDSPathQuery(const QString& newPath);
 
     void parseNodeFromPacketStream(QDataStream& packetStream);
+    void parseDomainListRecords(QDataStream& packetStream, qint64 size, quint64 version, quint64 baseVersion,
+                                quint32 numRecords);
 
     void pingPunchForInactiveNode(const SharedNodePointer& node);
 
@@ -183,6 +185,18 @@ private:
     QTimer _keepAlivePingTimer;
     bool _requestsDomainListData { false };
 
+    // The last node list version received whole, sent back on check-in so the domain-server can send what changed since.
+    // A DomainList can span several unreliable packets, so the records of the one being received are tracked until all
+    // have arrived.
+    std::atomic<quint64> _domainListVersion { 0 };
+    struct PendingDomainList {
+        quint64 version { 0 };
+        quint64 baseVersion { 0 };
+        std::vector<bool> received;
+        quint32 numReceived { 0 };
+    } _pendingDomainList;
+    bool _isApplyingDomainServerRemoval { false };
+
     bool _sendDomainServerCheckInEnabled { true };
     bool _domainPortAutoDiscovery { true };
 
@@ -357,6 +357,21 @@ void ResourceCache::setRequestLimit(uint32_t limit) {
     }
 }
 
+QList<QSharedPointer<Resource>> ResourceCache::findResources(const QUrl& url) {
+    QList<QSharedPointer<Resource>> resources;
+    QReadLocker locker(&_resourcesLock);
+    auto resourcesWithExtraHash = _resources.find(url);
+    if (resourcesWithExtraHash != _resources.end()) {
+        for (const auto& weakResource : resourcesWithExtraHash.value()) {
+            auto resource = weakResource.lock();
+            if (resource) {
+                resources << resource;
+            }
+        }
+    }
+    return resources;
+}
+
 QSharedPointer<Resource> ResourceCache::getResource(const QUrl& url, const QUrl& fallback, void* extra, size_t extraHash) {
     QSharedPointer<Resource> resource;
     {
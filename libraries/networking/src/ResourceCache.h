@@ -265,6 +265,9 @@ protected:
     // It's automatically called by `prefetch`.
     Q_INVOKABLE ScriptableResource* prefetchAndMoveToThread(const QUrl& url, void* extra, size_t extraHash, QThread *scriptThread);
 
+    /// Returns the resources that exist for the specified URL, one for each extra hash, without creating or loading any.
+    QList<QSharedPointer<Resource>> findResources(const QUrl& url);
+
     /// Creates a new resource.
     virtual QSharedPointer<Resource> createResource(const QUrl& url) = 0;
     virtual QSharedPointer<Resource> createResourceCopy(const QSharedPointer<Resource>& resource) = 0;
@@ -78,7 +78,19 @@ BasePacket::BasePacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr
     
 }
 
+BasePacket::~BasePacket() {
+    releaseBuffer();
+}
+
+void BasePacket::releaseBuffer() {
+    if (auto bufferPool = _bufferPool.lock()) {
+        bufferPool->release(std::move(_packet));
+    }
+    _bufferPool.reset();
+}
+
 BasePacket& BasePacket::operator=(const BasePacket& other) {
+    releaseBuffer();
     _packetSize = other._packetSize;
     _packet = std::unique_ptr<char[]>(new char[_packetSize]);
     memcpy(_packet.get(), other._packet.get(), _packetSize);
@@ -104,8 +116,10 @@ BasePacket::BasePacket(BasePacket&& other) {
 }
 
 BasePacket& BasePacket::operator=(BasePacket&& other) {
+    releaseBuffer();
     _packetSize = other._packetSize;
     _packet = std::move(other._packet);
+    _bufferPool = std::move(other._bufferPool);
     
     _payloadStart = other._payloadStart;
     _payloadCapacity = other._payloadCapacity;
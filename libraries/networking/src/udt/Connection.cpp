@@ -69,15 +69,22 @@ Connection::~Connection() {
 
 void Connection::stopSendQueue() {
     if (auto sendQueue = _sendQueue.release()) {
-        // grab the send queue thread so we can wait on it
-        QThread* sendQueueThread = sendQueue->thread();
-        
         // tell the send queue to stop and be deleted
         
         sendQueue->stop();
 
         _lastMessageNumber = sendQueue->getCurrentMessageNumber();
 
+        if (sendQueue->isScheduled()) {
+            // a shared scheduler thread keeps running, just make sure it is done with this queue
+            sendQueue->unschedule();
+            sendQueue->deleteLater();
+            return;
+        }
+
+        // grab the send queue thread so we can wait on it
+        QThread* sendQueueThread = sendQueue->thread();
+
         sendQueue->deleteLater();
         
         // wait on the send queue thread so we know the send queue is gone
@@ -8,7 +8,39 @@
 
 #include "NetworkSocket.h"
 
+#if defined(NETWORK_SOCKET_BATCHED_IO)
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
 #include "../NetworkLogging.h"
+#include "Constants.h"
+
+static const int DATAGRAM_BATCH_SIZE = 32;
+
+#if defined(NETWORK_SOCKET_BATCHED_IO)
+// Enough idle buffers to refill a few batches without allocating; more than this are freed as their packets go.
+static const size_t MAX_FREE_RECEIVE_BUFFERS = 8 * DATAGRAM_BATCH_SIZE;
+
+struct NetworkSocket::ReceiveBatch {
+    ReceiveBatch() : pool(std::make_shared<udt::PacketBufferPool>(MAX_FREE_RECEIVE_BUFFERS)) {
+        for (int i = 0; i < DATAGRAM_BATCH_SIZE; ++i) {
+            buffers[i] = pool->acquire();
+        }
+    }
+
+    udt::PacketBufferPoolPointer pool;
+    std::unique_ptr<char[]> buffers[DATAGRAM_BATCH_SIZE];
+    mmsghdr headers[DATAGRAM_BATCH_SIZE];
+    iovec iovecs[DATAGRAM_BATCH_SIZE];
+    sockaddr_in addresses[DATAGRAM_BATCH_SIZE];
+};
+#else
+struct NetworkSocket::ReceiveBatch {};
+#endif
 
 
 NetworkSocket::NetworkSocket(QObject* parent) :
@@ -31,6 +63,12 @@ NetworkSocket::NetworkSocket(QObject* parent) :
     connect(&_webrtcSocket, &WebRTCSocket::stateChanged, this, &NetworkSocket::onWebRTCStateChanged);
     // WEBRTC TODO: Add similar for errorOccurred
 #endif
+
+    static const char* BATCHED_IO_ENV = "OVERTE_UDT_BATCHED_IO";
+    setBatchedIOEnabled(qEnvironmentVariableIntValue(BATCHED_IO_ENV) != 0);
+}
+
+NetworkSocket::~NetworkSocket() {
 }
 
 
@@ -130,6 +168,8 @@ qint64 NetworkSocket::writeDatagram(const QByteArray& datagram, const SockAddr&
     case SocketType::UDP:
         // WEBRTC TODO: The Qt documentation says that the following call shouldn't be used if the UDP socket is connected!!!
         // https://doc.qt.io/qt-5/qudpsocket.html#writeDatagram
+        ++_writeSyscalls;
+        ++_datagramsWritten;
         return _udpSocket.writeDatagram(datagram, sockAddr.getAddress(), sockAddr.getPort());
 #if defined(WEBRTC_DATA_CHANNELS)
     case SocketType::WebRTC:
@@ -157,6 +197,7 @@ qint64 NetworkSocket::bytesToWrite(SocketType socketType, const SockAddr& addres
 
 
 bool NetworkSocket::hasPendingDatagrams() const {
+    ++_readSyscalls;
     return
 #if defined(WEBRTC_DATA_CHANNELS)
         _webrtcSocket.hasPendingDatagrams() ||
@@ -165,6 +206,7 @@ bool NetworkSocket::hasPendingDatagrams() const {
 }
 
 qint64 NetworkSocket::pendingDatagramSize() {
+    ++_readSyscalls;
 #if defined(WEBRTC_DATA_CHANNELS)
     // Alternate socket types, remembering the socket type used so that the same socket type is used next readDatagram().
     if (_lastSocketTypeRead == SocketType::UDP) {
@@ -190,6 +232,8 @@ qint64 NetworkSocket::pendingDatagramSize() {
 }
 
 qint64 NetworkSocket::readDatagram(char* data, qint64 maxSize, SockAddr* sockAddr) {
+    ++_readSyscalls;
+    ++_datagramsRead;
 #if defined(WEBRTC_DATA_CHANNELS)
     // Read per preceding pendingDatagramSize() if any, otherwise alternate socket types.
     if (_pendingDatagramSizeSocketType == SocketType::UDP
@@ -223,6 +267,148 @@ qint64 NetworkSocket::readDatagram(char* data, qint64 maxSize, SockAddr* sockAdd
 }
 
 
+void NetworkSocket::setBatchedIOEnabled(bool enabled) {
+#if defined(NETWORK_SOCKET_BATCHED_IO)
+    if (enabled && !_receiveBatch) {
+        _receiveBatch.reset(new ReceiveBatch());
+    }
+    if (enabled != _batchedIOEnabled) {
+        qCDebug(networking) << "NetworkSocket batched UDP I/O" << (enabled ? "enabled" : "disabled");
+    }
+    _batchedIOEnabled = enabled;
+#else
+    if (enabled) {
+        qCWarning(networking) << "NetworkSocket batched UDP I/O is not available on this platform";
+    }
+#endif
+}
+
+int NetworkSocket::getDatagramBatchSize() {
+    return DATAGRAM_BATCH_SIZE;
+}
+
+NetworkSocket::IOStats NetworkSocket::getIOStats() const {
+    IOStats stats;
+    stats.datagramsRead = _datagramsRead;
+    stats.readSyscalls = _readSyscalls;
+    stats.datagramsWritten = _datagramsWritten;
+    stats.writeSyscalls = _writeSyscalls;
+    return stats;
+}
+
+int NetworkSocket::readDatagrams(std::vector<ReceivedDatagram>& datagrams) {
+    datagrams.clear();
+
+#if defined(NETWORK_SOCKET_BATCHED_IO)
+    if (!_batchedIOEnabled || _udpSocket.state() != QAbstractSocket::BoundState) {
+        return 0;
+    }
+
+    auto& batch = *_receiveBatch;
+    for (int i = 0; i < DATAGRAM_BATCH_SIZE; ++i) {
+        batch.iovecs[i].iov_base = batch.buffers[i].get();
+        batch.iovecs[i].iov_len = udt::PacketBufferPool::BUFFER_SIZE;
+        memset(&batch.headers[i], 0, sizeof(mmsghdr));
+        batch.headers[i].msg_hdr.msg_iov = &batch.iovecs[i];
+        batch.headers[i].msg_hdr.msg_iovlen = 1;
+        batch.headers[i].msg_hdr.msg_name = &batch.addresses[i];
+        batch.headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+    }
+
+    int fd = (int)_udpSocket.socketDescriptor();
+    int numReceived = recvmmsg(fd, batch.headers, DATAGRAM_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+    ++_readSyscalls;
+    if (numReceived <= 0) {
+        // EAGAIN: nothing pending. Anything else is reported by the Qt socket on its next read.
+        return 0;
+    }
+
+    datagrams.reserve(numReceived);
+    for (int i = 0; i < numReceived; ++i) {
+        const auto& header = batch.headers[i];
+        int size = (int)header.msg_len;
+        if (size <= 0 || (header.msg_hdr.msg_flags & MSG_TRUNC) || header.msg_hdr.msg_namelen != sizeof(sockaddr_in)) {
+            // not a datagram we could have produced, drop it
+            continue;
+        }
+
+        ReceivedDatagram datagram;
+        const auto& address = batch.addresses[i];
+        datagram.sender = SockAddr(SocketType::UDP, QHostAddress(ntohl(address.sin_addr.s_addr)), ntohs(address.sin_port));
+        datagram.size = size;
+        datagram.data = std::move(batch.buffers[i]);
+        datagram.bufferPool = batch.pool;
+        batch.buffers[i] = batch.pool->acquire();
+        datagrams.push_back(std::move(datagram));
+    }
+
+    _datagramsRead += datagrams.size();
+    return numReceived;
+#else
+    return 0;
+#endif
+}
+
+qint64 NetworkSocket::writeDatagrams(const std::vector<OutgoingDatagram>& datagrams, const SockAddr& sockAddr) {
+    if (datagrams.empty()) {
+        return 0;
+    }
+
+#if defined(NETWORK_SOCKET_BATCHED_IO)
+    if (_batchedIOEnabled && sockAddr.getType() == SocketType::UDP && sockAddr.getAddress().protocol() == QAbstractSocket::IPv4Protocol) {
+        sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(sockAddr.getAddress().toIPv4Address());
+        address.sin_port = htons(sockAddr.getPort());
+
+        mmsghdr headers[DATAGRAM_BATCH_SIZE];
+        iovec iovecs[DATAGRAM_BATCH_SIZE];
+
+        int fd = (int)_udpSocket.socketDescriptor();
+        qint64 bytesWritten = 0;
+        size_t next = 0;
+        while (next < datagrams.size()) {
+            int count = (int)std::min(datagrams.size() - next, (size_t)DATAGRAM_BATCH_SIZE);
+            for (int i = 0; i < count; ++i) {
+                iovecs[i].iov_base = const_cast<char*>(datagrams[next + i].data);
+                iovecs[i].iov_len = datagrams[next + i].size;
+                memset(&headers[i], 0, sizeof(mmsghdr));
+                headers[i].msg_hdr.msg_iov = &iovecs[i];
+                headers[i].msg_hdr.msg_iovlen = 1;
+                headers[i].msg_hdr.msg_name = &address;
+                headers[i].msg_hdr.msg_namelen = sizeof(address);
+            }
+
+            int numSent = sendmmsg(fd, headers, count, 0);
+            ++_writeSyscalls;
+            if (numSent <= 0) {
+                // same as a failed QUdpSocket::writeDatagram, the caller treats the rest as lost
+                return next == 0 ? -1 : bytesWritten;
+            }
+
+            for (int i = 0; i < numSent; ++i) {
+                bytesWritten += headers[i].msg_len;
+            }
+            _datagramsWritten += numSent;
+            next += numSent;
+        }
+        return bytesWritten;
+    }
+#endif
+
+    qint64 bytesWritten = 0;
+    for (const auto& datagram : datagrams) {
+        auto result = writeDatagram(QByteArray::fromRawData(datagram.data, datagram.size), sockAddr);
+        if (result < 0) {
+            return bytesWritten == 0 ? -1 : bytesWritten;
+        }
+        bytesWritten += result;
+    }
+    return bytesWritten;
+}
+
+
 QAbstractSocket::SocketState NetworkSocket::state(SocketType socketType) const {
     switch (socketType) {
     case SocketType::UDP:
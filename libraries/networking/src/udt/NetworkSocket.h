@@ -9,6 +9,10 @@
 #ifndef overte_NetworkSocket_h
 #define overte_NetworkSocket_h
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include <QObject>
 #include <QUdpSocket>
 
@@ -19,11 +23,18 @@
 #include "../SocketType.h"
 #if defined(WEBRTC_DATA_CHANNELS)
 #include "../webrtc/WebRTCSocket.h"
+#include "PacketBufferPool.h"
 #endif
 
 /// @addtogroup Networking
 /// @{
 
+#if defined(Q_OS_LINUX)
+/// @brief Defined where NetworkSocket can read and write UDP datagrams in batches using <code>recvmmsg</code> and
+/// <code>sendmmsg</code>.
+#define NETWORK_SOCKET_BATCHED_IO
+#endif
+
 
 /// @brief Multiplexes a QUdpSocket and a WebRTCSocket so that they appear as a single QUdpSocket-style socket.
 class NetworkSocket : public QObject {
@@ -34,6 +45,29 @@ public:
     /// @brief Constructs a new NetworkSocket object.
     /// @param parent Qt parent object.
     NetworkSocket(QObject* parent);
+    ~NetworkSocket();
+
+    /// @brief A UDP datagram read by readDatagrams().
+    struct ReceivedDatagram {
+        std::unique_ptr<char[]> data;
+        qint64 size { 0 };
+        SockAddr sender;
+        udt::PacketBufferPoolPointer bufferPool; // data is to be returned to it once done with
+    };
+
+    /// @brief A UDP datagram to be sent by writeDatagrams(). The data isn't copied.
+    struct OutgoingDatagram {
+        const char* data;
+        qint64 size;
+    };
+
+    /// @brief Counts of datagrams moved and system calls made, for measuring the cost per packet of each I/O path.
+    struct IOStats {
+        quint64 datagramsRead { 0 };
+        quint64 readSyscalls { 0 };
+        quint64 datagramsWritten { 0 };
+        quint64 writeSyscalls { 0 };
+    };
 
 
     /// @brief Set the value of a UDP or WebRTC socket option.
@@ -102,6 +136,41 @@ public:
     /// @return The number of bytes if successfully read, otherwise <code>-1</code>.
     qint64 readDatagram(char* data, qint64 maxSize, SockAddr* sockAddr = nullptr);
 
+
+    /// @brief Enables or disables batched UDP I/O. Has no effect unless NETWORK_SOCKET_BATCHED_IO is defined.
+    /// @details Initially enabled if the <code>OVERTE_UDT_BATCHED_IO</code> environment variable is set to a non-zero value.
+    /// @param enabled <code>true</code> to use readDatagrams() and writeDatagrams() batching, <code>false</code> to
+    /// fall back to one datagram per call.
+    void setBatchedIOEnabled(bool enabled);
+
+    /// @brief Gets whether batched UDP I/O is in use.
+    /// @return <code>true</code> if batched UDP I/O is available and enabled, <code>false</code> if it isn't.
+    bool isBatchedIOEnabled() const { return _batchedIOEnabled; }
+
+    /// @brief Reads as many pending UDP datagrams as fit in one batch with a single system call.
+    /// @details Each datagram is handed over in the buffer it was received in, taken from a pool, so that udt::Packet can
+    /// adopt it without a copy and give it back to the pool when destroyed. Malformed datagrams are dropped. WebRTC
+    /// datagrams are not read; keep using readDatagram() for those.
+    /// @param datagrams The vector to fill with the datagrams read. It is cleared first.
+    /// @return The number of datagrams received from the socket, including dropped ones. Fewer than
+    /// getDatagramBatchSize() means that the socket has been drained.
+    int readDatagrams(std::vector<ReceivedDatagram>& datagrams);
+
+    /// @brief Sends UDP datagrams to a single address using as few system calls as possible.
+    /// @details Falls back to writeDatagram() per datagram when batched I/O isn't in use.
+    /// @param datagrams The datagrams to send.
+    /// @param sockAddr The address to send to.
+    /// @return The total number of bytes sent, or <code>-1</code> if the first datagram could not be sent.
+    qint64 writeDatagrams(const std::vector<OutgoingDatagram>& datagrams, const SockAddr& sockAddr);
+
+    /// @brief Gets the maximum number of datagrams moved by one readDatagrams() or writeDatagrams() system call.
+    /// @return The batch size.
+    static int getDatagramBatchSize();
+
+    /// @brief Gets the datagram and system call counts since the socket was created.
+    /// @return The I/O statistics.
+    IOStats getIOStats() const;
+
     
     /// @brief Gets the state of the UDP or WebRTC socket.
     /// @param socketType The type of socket for which to get the state.
@@ -162,6 +231,15 @@ private:
     SocketType _pendingDatagramSizeSocketType { SocketType::Unknown };
     SocketType _lastSocketTypeRead { SocketType::Unknown };
 #endif
+
+    struct ReceiveBatch;
+    std::unique_ptr<ReceiveBatch> _receiveBatch; // only touched on the socket's thread
+    bool _batchedIOEnabled { false };
+
+    mutable std::atomic<quint64> _datagramsRead { 0 };
+    mutable std::atomic<quint64> _readSyscalls { 0 };
+    std::atomic<quint64> _datagramsWritten { 0 };
+    std::atomic<quint64> _writeSyscalls { 0 };
 };
 
 
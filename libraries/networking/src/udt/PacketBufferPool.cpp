@@ -0,0 +1,40 @@
+//
+//  PacketBufferPool.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketBufferPool.h"
+
+#include "Constants.h"
+
+using namespace udt;
+
+const int PacketBufferPool::BUFFER_SIZE = MAX_PACKET_SIZE_WITH_UDP_HEADER;
+
+std::unique_ptr<char[]> PacketBufferPool::acquire() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_freeBuffers.empty()) {
+            auto buffer = std::move(_freeBuffers.back());
+            _freeBuffers.pop_back();
+            return buffer;
+        }
+    }
+    ++_numAllocations;
+    return std::unique_ptr<char[]>(new char[BUFFER_SIZE]);
+}
+
+void PacketBufferPool::release(std::unique_ptr<char[]> buffer) {
+    if (!buffer) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_freeBuffers.size() < _maxFreeBuffers) {
+        _freeBuffers.push_back(std::move(buffer));
+    }
+}
@@ -0,0 +1,48 @@
+//
+//  PacketBufferPool.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PacketBufferPool_h
+#define hifi_PacketBufferPool_h
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QtGlobal>
+
+namespace udt {
+
+// Recycles the buffers that datagrams are received into. The packets that adopt them hand them back when they are
+// destroyed, on whichever thread that is, so that receiving doesn't cost an allocation per datagram once warmed up.
+class PacketBufferPool {
+public:
+    // large enough for any datagram, with room past the largest valid packet so oversized ones show up as truncated
+    static const int BUFFER_SIZE;
+
+    PacketBufferPool(size_t maxFreeBuffers) : _maxFreeBuffers(maxFreeBuffers) {}
+
+    std::unique_ptr<char[]> acquire();
+    void release(std::unique_ptr<char[]> buffer); // buffers past the free list limit are deleted
+
+    quint64 getNumAllocations() const { return _numAllocations; }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<char[]>> _freeBuffers;
+    const size_t _maxFreeBuffers;
+    std::atomic<quint64> _numAllocations { 0 };
+};
+
+using PacketBufferPoolPointer = std::shared_ptr<PacketBufferPool>;
+
+}
+
+#endif // hifi_PacketBufferPool_h
@@ -29,6 +29,7 @@
 #include "Packet.h"
 #include "PacketList.h"
 #include "../UserActivityLogger.h"
+#include "SendScheduler.h"
 #include "Socket.h"
 #include <Trace.h>
 #include <Profile.h>
@@ -66,6 +67,9 @@ private:
 const microseconds SendQueue::MAXIMUM_ESTIMATED_TIMEOUT = seconds(5);
 const microseconds SendQueue::MINIMUM_ESTIMATED_TIMEOUT = milliseconds(10);
 
+static const auto HANDSHAKE_RESEND_INTERVAL = milliseconds(100);
+static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = seconds(5);
+
 std::unique_ptr<SendQueue> SendQueue::create(Socket* socket, SockAddr destination, SequenceNumber currentSequenceNumber,
                                              MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK) {
     Q_ASSERT_X(socket, "SendQueue::create", "Must be called with a valid Socket*");
@@ -73,6 +77,13 @@ std::unique_ptr<SendQueue> SendQueue::create(Socket* socket, SockAddr destinatio
     auto queue = std::unique_ptr<SendQueue>(new SendQueue(socket, destination, currentSequenceNumber,
                                                           currentMessageNumber, hasReceivedHandshakeACK));
 
+    auto& scheduler = SendScheduler::getInstance();
+    if (scheduler.isEnabled()) {
+        // the queue stays on the creating thread and is run by a shared scheduler thread
+        queue->_schedulerThread = scheduler.schedule(queue.get());
+        return queue;
+    }
+
     // Setup queue private thread
     QThread* thread = new QThread();
     QString name = "Networking: SendQueue " + destination.objectName();
@@ -107,6 +118,19 @@ SendQueue::SendQueue(Socket* socket, SockAddr dest, SequenceNumber currentSequen
 }
 
 SendQueue::~SendQueue() {
+    unschedule();
+}
+
+void SendQueue::unschedule() {
+    if (_schedulerThread) {
+        _schedulerThread->remove(this);
+    }
+}
+
+void SendQueue::wakeScheduler() {
+    if (_schedulerThread) {
+        _schedulerThread->wake(this);
+    }
 }
 
 void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
@@ -115,7 +139,9 @@ void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
     _emptyCondition.notify_one();
     
-    if (!thread()->isRunning() && _state == State::NotStarted) {
+    if (_schedulerThread) {
+        wakeScheduler();
+    } else if (!thread()->isRunning() && _state == State::NotStarted) {
         thread()->start();
     }
 }
@@ -126,7 +152,9 @@ void SendQueue::queuePacketList(std::unique_ptr<PacketList> packetList) {
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
     _emptyCondition.notify_one();
     
-    if (!thread()->isRunning() && _state == State::NotStarted) {
+    if (_schedulerThread) {
+        wakeScheduler();
+    } else if (!thread()->isRunning() && _state == State::NotStarted) {
         thread()->start();
     }
 }
@@ -138,10 +166,12 @@ void SendQueue::stop() {
     // Notify all conditions in case we're waiting somewhere
     _handshakeACKCondition.notify_one();
     _emptyCondition.notify_one();
+    wakeScheduler();
 }
     
 int SendQueue::sendPacket(const Packet& packet) {
     _lastPacketSentAt = std::chrono::high_resolution_clock::now();
+    std::lock_guard<std::mutex> destinationLocker(_destinationLock);
     return _socket->writeDatagram(packet.getData(), packet.getDataSize(), _destination);
 }
     
@@ -170,6 +200,7 @@ void SendQueue::ack(SequenceNumber ack) {
 
     // call notify_one on the condition_variable_any in case the send thread is sleeping with a full congestion window
     _emptyCondition.notify_one();
+    wakeScheduler();
 }
 
 void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
@@ -180,25 +211,31 @@ void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
 
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for losses to re-send
     _emptyCondition.notify_one();
+    wakeScheduler();
 }
 
 void SendQueue::sendHandshake() {
     std::unique_lock<std::mutex> handshakeLock { _handshakeMutex };
     if (!_hasReceivedHandshakeACK) {
-        // we haven't received a handshake ACK from the client, send another now
-        // if the handshake hasn't been completed, then the initial sequence number
-        // should be the current sequence number + 1
-        SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
-        auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
-        handshakePacket->writePrimitive(initialSequenceNumber);
-        _socket->writeBasePacket(*handshakePacket, _destination);
+        sendHandshakePacket();
         
         // we wait for the ACK or the re-send interval to expire
-        static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
         _handshakeACKCondition.wait_for(handshakeLock, HANDSHAKE_RESEND_INTERVAL);
     }
 }
 
+void SendQueue::sendHandshakePacket() {
+    // we haven't received a handshake ACK from the client, send another now
+    // if the handshake hasn't been completed, then the initial sequence number
+    // should be the current sequence number + 1
+    SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
+    auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
+    handshakePacket->writePrimitive(initialSequenceNumber);
+
+    std::lock_guard<std::mutex> destinationLocker(_destinationLock);
+    _socket->writeBasePacket(*handshakePacket, _destination);
+}
+
 void SendQueue::handshakeACK() {
     {
         std::lock_guard<std::mutex> locker { _handshakeMutex };
@@ -207,6 +244,7 @@ void SendQueue::handshakeACK() {
 
     // Notify on the handshake ACK condition
     _handshakeACKCondition.notify_one();
+    wakeScheduler();
 }
 
 SequenceNumber SendQueue::getNextSequenceNumber() {
@@ -359,6 +397,118 @@ void SendQueue::run() {
     }
 }
 
+p_high_resolution_clock::time_point SendQueue::runOnce(p_high_resolution_clock::time_point now) {
+    // This mirrors one iteration of run(), but hands control back to the SendScheduler instead of sleeping:
+    // the returned time replaces both the pacing sleep and the condition variable waits.
+    if (_state == State::NotStarted) {
+        _state = State::Running;
+        _nextPacketTimestamp = now;
+        _nextHandshakeAt = now;
+    }
+
+    if (_state != State::Running) {
+        return p_high_resolution_clock::time_point::max();
+    }
+
+    if (!_hasReceivedHandshakeACK) {
+        // handshakeACK() wakes us up as soon as the ACK comes in
+        if (now >= _nextHandshakeAt) {
+            sendHandshakePacket();
+            _nextHandshakeAt = now + HANDSHAKE_RESEND_INTERVAL;
+        }
+        return _nextHandshakeAt;
+    }
+
+    bool attemptedToSendPacket = maybeResendPacket();
+    if (!attemptedToSendPacket) {
+        attemptedToSendPacket = (maybeSendNewPacket() > 0);
+    }
+
+    if (!attemptedToSendPacket) {
+        return nextIdleRun(now);
+    }
+
+    if (_isIdle) {
+        // don't burst to catch up on the time we spent idle
+        _isIdle = false;
+        _nextPacketTimestamp = now;
+    }
+
+    if (_packetSendPeriod > 0) {
+        auto nextPacketDelta = microseconds(_packetSendPeriod.load());
+        _nextPacketTimestamp += nextPacketDelta;
+
+        // same as run(): never let a late timestamp force a wait longer than one send period
+        if (_nextPacketTimestamp - now > nextPacketDelta) {
+            _nextPacketTimestamp = now + nextPacketDelta;
+        }
+        return _nextPacketTimestamp;
+    }
+
+    return now;
+}
+
+p_high_resolution_clock::time_point SendQueue::nextIdleRun(p_high_resolution_clock::time_point now) {
+    // Non-blocking counterpart of isInactive(): instead of waiting on _emptyCondition we return the time at which the
+    // wait would have timed out. Anything that would have notified the condition wakes the scheduler instead.
+    using DoubleLock = DoubleLock<std::recursive_mutex, std::mutex>;
+    DoubleLock doubleLock(_packets.getLock(), _naksLock);
+    DoubleLock::Lock locker(doubleLock, std::try_to_lock);
+
+    if (!locker.owns_lock() || !((_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty())) {
+        // someone is adding work right now, come straight back
+        return now;
+    }
+
+    bool wasIdle = _isIdle;
+    if (!_isIdle || _idleAck != _lastACKSequenceNumber) {
+        // (re)start the inactivity window, an ACK counts as activity just like it wakes up run()
+        _isIdle = true;
+        _idleSince = now;
+        _idleAck = _lastACKSequenceNumber;
+    }
+
+    if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
+        // we've sent the client as much data as we have (and they've ACKed it)
+        auto deadline = _idleSince + EMPTY_QUEUES_INACTIVE_TIMEOUT;
+        if (now < deadline) {
+            return deadline;
+        }
+
+#ifdef UDT_CONNECTION_DEBUG
+        qCDebug(networking) << "SendQueue to" << _destination << "has been empty for"
+            << EMPTY_QUEUES_INACTIVE_TIMEOUT.count()
+            << "seconds and receiver has ACKed all packets."
+            << "The queue is now inactive and will be stopped.";
+#endif
+
+        locker.unlock();
+        deactivate();
+        return p_high_resolution_clock::time_point::max();
+    }
+
+    // We think the client is still waiting for data (based on the sequence number gap)
+    auto estimatedTimeout = microseconds(_estimatedTimeout);
+    estimatedTimeout = std::min(MAXIMUM_ESTIMATED_TIMEOUT, std::max(MINIMUM_ESTIMATED_TIMEOUT, estimatedTimeout));
+
+    auto deadline = _idleSince + estimatedTimeout;
+    bool sentLongAgo = std::chrono::high_resolution_clock::now() - _lastPacketSentAt > estimatedTimeout;
+    if (now < deadline && !(wasIdle && sentLongAgo)) {
+        return deadline;
+    }
+
+    if (SequenceNumber(_lastACKSequenceNumber) < _currentSequenceNumber) {
+        // after a timeout if we still have sent packets that the client hasn't ACKed we add them to the loss list
+        _naks.append(SequenceNumber(_lastACKSequenceNumber) + 1, _currentSequenceNumber);
+        locker.unlock();
+
+        _isIdle = false;
+        emit timeout();
+    }
+
+    return now;
+}
+
 int SendQueue::maybeSendNewPacket() {
     if (!isFlowWindowFull()) {
         // we didn't re-send a packet, so time to send a new one
@@ -485,7 +635,6 @@ bool SendQueue::isInactive(bool attemptedToSendPacket) {
             if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
                 // we've sent the client as much data as we have (and they've ACKed it)
                 // either wait for new data to send or 5 seconds before cleaning up the queue
-                static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = std::chrono::seconds(5);
                 
                 // use our condition_variable_any to wait
                 auto cvStatus = _emptyCondition.wait_for(locker, EMPTY_QUEUES_INACTIVE_TIMEOUT);
@@ -563,5 +712,6 @@ bool SendQueue::isFlowWindowFull() const {
 }
 
 void SendQueue::updateDestinationAddress(SockAddr newAddress) {
+    std::lock_guard<std::mutex> destinationLocker(_destinationLock);
     _destination = newAddress;
 }
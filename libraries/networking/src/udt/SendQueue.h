@@ -39,6 +39,7 @@ class BasePacket;
 class ControlPacket;
 class Packet;
 class PacketList;
+class SendSchedulerThread;
 class Socket;
     
 class SendQueue : public QObject {
@@ -69,6 +70,16 @@ public:
     void setPacketSendPeriod(int newPeriod) { _packetSendPeriod = newPeriod; }
     
     void setEstimatedTimeout(int estimatedTimeout) { _estimatedTimeout = estimatedTimeout; }
+
+    // True if this queue is driven by a shared SendScheduler thread rather than a thread of its own
+    bool isScheduled() const { return _schedulerThread != nullptr; }
+
+    // Removes the queue from its SendScheduler thread, blocking while it is being run. No-op for unscheduled queues.
+    void unschedule();
+
+    // Runs one non-blocking iteration of the send loop on a SendScheduler thread.
+    // Returns when the queue next wants to run, or time_point::max() once it has stopped.
+    p_high_resolution_clock::time_point runOnce(p_high_resolution_clock::time_point now);
     
 public slots:
     void stop();
@@ -95,6 +106,7 @@ private:
               MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK);
     
     void sendHandshake();
+    void sendHandshakePacket();
     
     int sendPacket(const Packet& packet);
     bool sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket, SequenceNumber sequenceNumber);
@@ -103,6 +115,8 @@ private:
     bool maybeResendPacket(); // Determines whether to resend a packet and which one
     
     bool isInactive(bool attemptedToSendPacket);
+    p_high_resolution_clock::time_point nextIdleRun(p_high_resolution_clock::time_point now);
+    void wakeScheduler();
     void deactivate(); // makes the queue inactive and cleans it up
 
     bool isFlowWindowFull() const;
@@ -142,6 +156,16 @@ private:
 
     std::chrono::high_resolution_clock::time_point _lastPacketSentAt;
 
+    std::mutex _destinationLock; // Protects _destination, which scheduled queues see updated from the connection's thread
+
+    // Scheduled mode state, only touched by the SendScheduler thread inside runOnce
+    SendSchedulerThread* _schedulerThread { nullptr };
+    p_high_resolution_clock::time_point _nextPacketTimestamp;
+    p_high_resolution_clock::time_point _nextHandshakeAt;
+    p_high_resolution_clock::time_point _idleSince;
+    uint32_t _idleAck { 0 };
+    bool _isIdle { false };
+
     static const std::chrono::microseconds MAXIMUM_ESTIMATED_TIMEOUT;
     static const std::chrono::microseconds MINIMUM_ESTIMATED_TIMEOUT;
 };
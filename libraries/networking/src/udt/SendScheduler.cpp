@@ -0,0 +1,227 @@
+//
+//  SendScheduler.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SendScheduler.h"
+
+#include <algorithm>
+
+#include <QtCore/QtGlobal>
+
+#include <ThreadHelpers.h>
+
+#include "../NetworkLogging.h"
+#include "SendQueue.h"
+
+using namespace udt;
+using namespace std::chrono;
+
+// 2048 slots of 50us cover ~100ms per revolution, which holds the send periods TCPVegasCC produces in practice.
+// Longer deadlines (handshake re-sends, inactivity timeouts) simply stay in their slot for several revolutions.
+const microseconds SendSchedulerThread::TICK { 50 };
+const size_t SendSchedulerThread::NUM_SLOTS { 2048 };
+
+SendSchedulerThread::SendSchedulerThread(int index) :
+    _wheel(NUM_SLOTS)
+{
+    setObjectName("Networking: SendScheduler " + QString::number(index));
+}
+
+void SendSchedulerThread::add(SendQueue* queue) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& state = _queues[queue];
+        state.generation = ++_nextGeneration;
+        state.isReady = true;
+        _ready.push_back({ queue, state.generation, p_high_resolution_clock::now() });
+        ++_numQueues;
+    }
+    _condition.notify_one();
+}
+
+void SendSchedulerThread::remove(SendQueue* queue) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idleCondition.wait(lock, [&] { return _running != queue; });
+    if (_queues.erase(queue) > 0) {
+        --_numQueues;
+    }
+    // any timers still referencing the queue are dropped when the wheel reaches them
+}
+
+void SendSchedulerThread::wake(SendQueue* queue) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _queues.find(queue);
+        if (it == _queues.end() || it->second.isReady) {
+            return;
+        }
+        auto& state = it->second;
+        state.generation = ++_nextGeneration;
+        state.isReady = true;
+        _ready.push_back({ queue, state.generation, p_high_resolution_clock::now() });
+    }
+    _condition.notify_one();
+}
+
+void SendSchedulerThread::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _condition.notify_one();
+}
+
+void SendSchedulerThread::insert(SendQueue* queue, QueueState& state, TimePoint deadline, TimePoint now) {
+    state.generation = ++_nextGeneration;
+
+    if (deadline <= now) {
+        state.isReady = true;
+        _ready.push_back({ queue, state.generation, deadline });
+        return;
+    }
+
+    auto ticks = (size_t)std::max<int64_t>(0, duration_cast<microseconds>(deadline - _wheelTime).count() / TICK.count());
+    _wheel[(_wheelIndex + ticks) % NUM_SLOTS].push_back({ queue, state.generation, deadline });
+    ++_numTimers;
+}
+
+void SendSchedulerThread::advanceWheel(TimePoint now) {
+    if (_numTimers == 0) {
+        _wheelTime = now;
+        return;
+    }
+
+    size_t slotsVisited = 0;
+    while (true) {
+        auto& slot = _wheel[_wheelIndex];
+        auto keep = slot.begin();
+        for (auto& timer : slot) {
+            auto it = _queues.find(timer.queue);
+            if (it == _queues.end() || it->second.generation != timer.generation) {
+                // stale: the queue was removed, woken early or rescheduled since
+                --_numTimers;
+            } else if (timer.deadline <= now) {
+                it->second.isReady = true;
+                _ready.push_back(timer);
+                --_numTimers;
+            } else {
+                *keep++ = timer;
+            }
+        }
+        slot.erase(keep, slot.end());
+
+        if (_wheelTime + TICK > now || ++slotsVisited >= NUM_SLOTS) {
+            break;
+        }
+        _wheelIndex = (_wheelIndex + 1) % NUM_SLOTS;
+        _wheelTime += TICK;
+    }
+
+    if (slotsVisited >= NUM_SLOTS) {
+        // we fell more than a full revolution behind and have now looked at every slot, so catch up
+        _wheelTime = now;
+    }
+}
+
+void SendSchedulerThread::run() {
+    setThreadName(objectName().toStdString());
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _wheelTime = p_high_resolution_clock::now();
+
+    std::vector<Timer> batch;
+    while (!_stop) {
+        advanceWheel(p_high_resolution_clock::now());
+
+        if (_ready.empty()) {
+            if (_numTimers == 0) {
+                _condition.wait(lock);
+            } else {
+                // sleep until the next slot that holds a timer, or until woken by new work
+                size_t ticks = 1;
+                while (ticks < NUM_SLOTS && _wheel[(_wheelIndex + ticks) % NUM_SLOTS].empty()) {
+                    ++ticks;
+                }
+                _condition.wait_until(lock, _wheelTime + TICK * (int64_t)ticks);
+            }
+            continue;
+        }
+
+        batch.clear();
+        batch.swap(_ready);
+        for (const auto& timer : batch) {
+            auto it = _queues.find(timer.queue);
+            if (it == _queues.end() || it->second.generation != timer.generation) {
+                continue;
+            }
+            it->second.isReady = false;
+            _running = timer.queue;
+
+            lock.unlock();
+            auto nextRun = timer.queue->runOnce(p_high_resolution_clock::now());
+            lock.lock();
+
+            _running = nullptr;
+            _idleCondition.notify_all();
+
+            // the queue may have been woken while it ran, in which case it is already waiting in _ready
+            it = _queues.find(timer.queue);
+            if (it != _queues.end() && it->second.generation == timer.generation && nextRun != TimePoint::max()) {
+                insert(timer.queue, it->second, nextRun, p_high_resolution_clock::now());
+            }
+        }
+    }
+}
+
+SendScheduler& SendScheduler::getInstance() {
+    static SendScheduler instance;
+    return instance;
+}
+
+SendScheduler::SendScheduler() {
+    static const char* SEND_SCHEDULER_THREADS_ENV = "OVERTE_UDT_SEND_SCHEDULER_THREADS";
+    if (qEnvironmentVariableIsSet(SEND_SCHEDULER_THREADS_ENV)) {
+        setNumThreads(qEnvironmentVariableIntValue(SEND_SCHEDULER_THREADS_ENV));
+    }
+}
+
+SendScheduler::~SendScheduler() {
+    for (auto& thread : _threads) {
+        thread->stop();
+    }
+    for (auto& thread : _threads) {
+        thread->wait();
+    }
+}
+
+void SendScheduler::setNumThreads(int numThreads) {
+    numThreads = std::max(0, numThreads);
+    if (numThreads != _numThreads) {
+        qCDebug(networking) << "SendScheduler using" << numThreads << "shared send threads (was" << _numThreads << ")";
+        _numThreads = numThreads;
+    }
+}
+
+SendSchedulerThread* SendScheduler::schedule(SendQueue* queue) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    int numThreads = _numThreads;
+    Q_ASSERT(numThreads > 0);
+    while ((int)_threads.size() < numThreads) {
+        _threads.emplace_back(new SendSchedulerThread((int)_threads.size()));
+        _threads.back()->start();
+    }
+
+    // threads beyond the current count only keep serving the queues they already have
+    auto least = std::min_element(_threads.begin(), _threads.begin() + numThreads, [](const auto& a, const auto& b) {
+        return a->getNumQueues() < b->getNumQueues();
+    });
+    (*least)->add(queue);
+    return least->get();
+}
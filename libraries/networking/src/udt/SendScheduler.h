@@ -0,0 +1,110 @@
+//
+//  SendScheduler.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SendScheduler_h
+#define hifi_SendScheduler_h
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QThread>
+
+#include <PortableHighResolutionClock.h>
+
+namespace udt {
+
+class SendQueue;
+
+// One shared send thread. SendQueues assigned to it are paced with a hashed timer wheel instead of sleeping
+// on a thread of their own: each queue runs one send step, reports when it next wants to run (its packet send
+// period, a handshake resend or an inactivity timeout) and is re-inserted in the wheel at that time.
+class SendSchedulerThread : public QThread {
+public:
+    using TimePoint = p_high_resolution_clock::time_point;
+
+    SendSchedulerThread(int index);
+
+    void add(SendQueue* queue);
+    void remove(SendQueue* queue); // blocks until the queue is no longer being run
+    void wake(SendQueue* queue);
+
+    void stop();
+
+    int getNumQueues() const { return _numQueues; }
+
+protected:
+    void run() override;
+
+private:
+    struct Timer {
+        SendQueue* queue;
+        uint64_t generation;
+        TimePoint deadline;
+    };
+
+    struct QueueState {
+        uint64_t generation { 0 };
+        bool isReady { false };
+    };
+
+    void insert(SendQueue* queue, QueueState& state, TimePoint deadline, TimePoint now);
+    void advanceWheel(TimePoint now);
+
+    static const std::chrono::microseconds TICK;
+    static const size_t NUM_SLOTS;
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::condition_variable _idleCondition;
+
+    std::vector<std::vector<Timer>> _wheel;
+    std::vector<Timer> _ready;
+    std::unordered_map<SendQueue*, QueueState> _queues;
+    SendQueue* _running { nullptr };
+
+    TimePoint _wheelTime;
+    size_t _wheelIndex { 0 };
+    int _numTimers { 0 };
+    uint64_t _nextGeneration { 0 }; // never reused, so stale timers can't match a queue allocated at the same address
+    std::atomic<int> _numQueues { 0 };
+    bool _stop { false };
+};
+
+// Multiplexes SendQueues over a fixed pool of SendSchedulerThreads.
+//   With zero threads (the default) every SendQueue keeps a dedicated QThread. The initial thread count comes from
+//   the OVERTE_UDT_SEND_SCHEDULER_THREADS environment variable and can be changed at runtime with setNumThreads;
+//   the change applies to SendQueues created afterwards.
+class SendScheduler {
+public:
+    static SendScheduler& getInstance();
+
+    ~SendScheduler();
+
+    void setNumThreads(int numThreads);
+    int getNumThreads() const { return _numThreads; }
+    bool isEnabled() const { return _numThreads > 0; }
+
+    SendSchedulerThread* schedule(SendQueue* queue);
+
+private:
+    SendScheduler();
+
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<SendSchedulerThread>> _threads;
+    std::atomic<int> _numThreads { 0 };
+};
+
+}
+
+#endif // hifi_SendScheduler_h
@@ -208,6 +208,10 @@ qint64 Socket::writePacketList(std::unique_ptr<PacketList> packetList, const Soc
     }
 
     // Unreliable and Unordered
+    if (_networkSocket.isBatchedIOEnabled() && sockAddr.getType() == SocketType::UDP && packetList->_packets.size() > 1) {
+        return writeUnreliablePacketBatch(*packetList, sockAddr);
+    }
+
     qint64 totalBytesSent = 0;
     while (!packetList->_packets.empty()) {
         totalBytesSent += writePacket(packetList->takeFront<Packet>(), sockAddr);
@@ -215,6 +219,41 @@ qint64 Socket::writePacketList(std::unique_ptr<PacketList> packetList, const Soc
     return totalBytesSent;
 }
 
+qint64 Socket::writeUnreliablePacketBatch(PacketList& packetList, const SockAddr& sockAddr) {
+    if (_networkSocket.state(SocketType::UDP) != QAbstractSocket::BoundState) {
+        qCDebug(networking) << "Attempt to writeUnreliablePacketBatch when in unbound state to" << sockAddr;
+        return -1;
+    }
+
+    auto connection = findOrCreateConnection(sockAddr, true);
+
+    std::vector<NetworkSocket::OutgoingDatagram> datagrams;
+    datagrams.reserve(packetList._packets.size());
+    {
+        Lock lock(_unreliableSequenceNumbersMutex);
+        auto& sequenceNumber = _unreliableSequenceNumbers[sockAddr];
+        for (auto& packet : packetList._packets) {
+            packet->writeSequenceNumber(++sequenceNumber);
+            datagrams.push_back({ packet->getData(), packet->getDataSize() });
+        }
+    }
+
+    if (connection) {
+        for (auto& packet : packetList._packets) {
+            connection->recordSentUnreliablePackets(packet->getWireSize(), packet->getPayloadSize());
+        }
+    }
+
+    auto bytesWritten = _networkSocket.writeDatagrams(datagrams, sockAddr);
+    if (bytesWritten < 0) {
+        HIFI_FCDEBUG(networking(), "udt::writeUnreliablePacketBatch error writing" << datagrams.size()
+            << "datagrams to" << sockAddr << "-" << _networkSocket.errorString(SocketType::UDP));
+    }
+
+    packetList._packets.clear();
+    return bytesWritten;
+}
+
 void Socket::writeReliablePacket(Packet* packet, const SockAddr& sockAddr) {
     auto connection = findOrCreateConnection(sockAddr);
     if (connection) {
@@ -421,73 +460,109 @@ void Socket::readPendingDatagrams() {
             continue;
         }
 
-        auto it = _unfilteredHandlers.find(senderSockAddr);
+        processDatagram(std::move(buffer), sizeRead, senderSockAddr, receiveTime);
 
-        if (it != _unfilteredHandlers.end()) {
-            // we have a registered unfiltered handler for this SockAddr - call that and return
-            if (it->second) {
-                auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-                basePacket->setReceiveTime(receiveTime);
-                it->second(std::move(basePacket));
-            }
+        if (_networkSocket.isBatchedIOEnabled()) {
+            // QUdpSocket re-arms its read notifier on every readDatagram, so we've taken one datagram through Qt above.
+            // Drain whatever else is already queued in the kernel in batches, one recvmmsg call per batch.
+            drainDatagramBatches(abortTime);
+        }
+    }
+}
 
-            continue;
+void Socket::drainDatagramBatches(std::chrono::system_clock::time_point abortTime) {
+    int numReceived = 0;
+    do {
+        numReceived = _networkSocket.readDatagrams(_receivedDatagrams);
+        if (numReceived == 0) {
+            break;
         }
 
-        // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+        _readyReadBackupTimer->start();
+        auto receiveTime = p_high_resolution_clock::now();
 
-        if (isControlPacket) {
-            // setup a control packet from the data we just read
-            auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            controlPacket->setReceiveTime(receiveTime);
+        for (auto& datagram : _receivedDatagrams) {
+            _lastPacketSizeRead = datagram.size;
+            _lastPacketSockAddr = datagram.sender;
+            processDatagram(std::move(datagram.data), datagram.size, datagram.sender, receiveTime, datagram.bufferPool);
+        }
+        _receivedDatagrams.clear();
 
-            // move this control packet to the matching connection, if there is one
-            auto connection = findOrCreateConnection(senderSockAddr, true);
+        // a partial batch means the kernel queue is empty
+    } while (numReceived == NetworkSocket::getDatagramBatchSize() && std::chrono::system_clock::now() <= abortTime);
+}
 
-            if (connection) {
-                connection->processControl(move(controlPacket));
-            }
+void Socket::processDatagram(std::unique_ptr<char[]> buffer, qint64 size, const SockAddr& senderSockAddr,
+                             p_high_resolution_clock::time_point receiveTime, const PacketBufferPoolPointer& bufferPool) {
+    auto it = _unfilteredHandlers.find(senderSockAddr);
+
+    if (it != _unfilteredHandlers.end()) {
+        // we have a registered unfiltered handler for this SockAddr - call that and return
+        if (it->second) {
+            auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), size, senderSockAddr);
+            basePacket->setReceiveTime(receiveTime);
+            basePacket->setBufferPool(bufferPool);
+            it->second(std::move(basePacket));
+        }
 
-        } else {
-            // setup a Packet from the data we just read
-            auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            packet->setReceiveTime(receiveTime);
+        return;
+    }
 
-            // save the sequence number in case this is the packet that sticks readyRead
-            _lastReceivedSequenceNumber = packet->getSequenceNumber();
+    // check if this was a control packet or a data packet
+    bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
 
-            // call our verification operator to see if this packet is verified
-            if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
-                auto connection = findOrCreateConnection(senderSockAddr, true);
+    if (isControlPacket) {
+        // setup a control packet from the data we just read
+        auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), size, senderSockAddr);
+        controlPacket->setReceiveTime(receiveTime);
+        controlPacket->setBufferPool(bufferPool);
+
+        // move this control packet to the matching connection, if there is one
+        auto connection = findOrCreateConnection(senderSockAddr, true);
+
+        if (connection) {
+            connection->processControl(move(controlPacket));
+        }
+
+    } else {
+        // setup a Packet from the data we just read
+        auto packet = Packet::fromReceivedPacket(std::move(buffer), size, senderSockAddr);
+        packet->setReceiveTime(receiveTime);
+        packet->setBufferPool(bufferPool);
+
+        // save the sequence number in case this is the packet that sticks readyRead
+        _lastReceivedSequenceNumber = packet->getSequenceNumber();
+
+        // call our verification operator to see if this packet is verified
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            auto connection = findOrCreateConnection(senderSockAddr, true);
 
-                if (packet->isReliable()) {
-                    // if this was a reliable packet then signal the matching connection with the sequence number
+            if (packet->isReliable()) {
+                // if this was a reliable packet then signal the matching connection with the sequence number
 
-                    if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
-                                                                                  packet->getDataSize(),
-                                                                                  packet->getPayloadSize())) {
-                        // the connection could not be created or indicated that we should not continue processing this packet
+                if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
+                                                                              packet->getDataSize(),
+                                                                              packet->getPayloadSize())) {
+                    // the connection could not be created or indicated that we should not continue processing this packet
 #ifdef UDT_CONNECTION_DEBUG
-                        qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
-                            << ", type" << NLPacket::typeInHeader(*packet);
+                    qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
+                        << ", type" << NLPacket::typeInHeader(*packet);
 #endif
-                        continue;
-                    }
-                } else if (connection) {
-                    connection->recordReceivedUnreliablePackets(packet->getWireSize(),
-                                                                packet->getPayloadSize());
+                    return;
                 }
+            } else if (connection) {
+                connection->recordReceivedUnreliablePackets(packet->getWireSize(),
+                                                            packet->getPayloadSize());
+            }
 
-                if (packet->isPartOfMessage()) {
-                    auto connection = findOrCreateConnection(senderSockAddr, true);
-                    if (connection) {
-                        connection->queueReceivedMessagePacket(std::move(packet));
-                    }
-                } else if (_packetHandler) {
-                    // call the verified packet callback to let it handle this packet
-                    _packetHandler(std::move(packet));
+            if (packet->isPartOfMessage()) {
+                auto connection = findOrCreateConnection(senderSockAddr, true);
+                if (connection) {
+                    connection->queueReceivedMessagePacket(std::move(packet));
                 }
+            } else if (_packetHandler) {
+                // call the verified packet callback to let it handle this packet
+                _packetHandler(std::move(packet));
             }
         }
     }
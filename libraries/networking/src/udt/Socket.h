@@ -15,6 +15,7 @@
 #ifndef hifi_Socket_h
 #define hifi_Socket_h
 
+#include <chrono>
 #include <functional>
 #include <unordered_map>
 #include <mutex>
@@ -90,6 +91,11 @@ public:
     
     StatsVector sampleStatsForAllConnections();
 
+    // Batched (recvmmsg/sendmmsg) UDP I/O, see NetworkSocket::setBatchedIOEnabled. Must be called on the Socket thread.
+    void setBatchedIOEnabled(bool enabled) { _networkSocket.setBatchedIOEnabled(enabled); }
+    bool isBatchedIOEnabled() const { return _networkSocket.isBatchedIOEnabled(); }
+    NetworkSocket::IOStats getIOStats() const { return _networkSocket.getIOStats(); }
+
 #if defined(WEBRTC_DATA_CHANNELS)
     const WebRTCSocket* getWebRTCSocket();
 #endif
@@ -116,6 +122,12 @@ private slots:
 private:
     void setSystemBufferSizes(SocketType socketType);
     Connection* findOrCreateConnection(const SockAddr& sockAddr, bool filterCreation = false);
+
+    void drainDatagramBatches(std::chrono::system_clock::time_point abortTime);
+    void processDatagram(std::unique_ptr<char[]> buffer, qint64 size, const SockAddr& senderSockAddr,
+                         p_high_resolution_clock::time_point receiveTime,
+                         const PacketBufferPoolPointer& bufferPool = PacketBufferPoolPointer());
+    qint64 writeUnreliablePacketBatch(PacketList& packetList, const SockAddr& sockAddr);
    
     // privatized methods used by UDTTest - they are private since they must be called on the Socket thread
     ConnectionStats::Stats sampleStatsForConnection(const SockAddr& destination);
@@ -151,6 +163,8 @@ private:
     int _lastPacketSizeRead { 0 };
     SequenceNumber _lastReceivedSequenceNumber;
     SockAddr _lastPacketSockAddr;
+
+    std::vector<NetworkSocket::ReceivedDatagram> _receivedDatagrams;
     
     friend UDTTest;
 };
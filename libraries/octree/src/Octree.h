@@ -12,6 +12,7 @@
 #ifndef hifi_Octree_h
 #define hifi_Octree_h
 
+#include <atomic>
 #include <memory>
 #include <set>
 #include <stdint.h>
@@ -211,6 +212,22 @@ public:
                             bool skipThoseWithBadParents) = 0;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) = 0;
 
+    // Writes the current state of the given entities, in the same format as writeToMap, for incremental persistence.
+    // entities[i] is left invalid if entityIDs[i] is no longer in the tree, or is one writeToMap would leave out.
+    virtual bool writeEntitiesToList(const QVector<QUuid>& entityIDs, QVariantList& entities, bool skipDefaultValues,
+                                     bool skipThoseWithBadParents) {
+        return false;
+    }
+
+    // The entities the server itself changed or moved since the given time, which aren't reported as they change.
+    virtual QVector<QUuid> findEntitiesChangedOnServerSince(quint64 since) { return QVector<QUuid>(); }
+
+    // Binary snapshot of the whole tree, the "bin" persist file type. See OctreeUtils::SnapshotHeader.
+    virtual bool writeToSnapshotFile(const char* filename) { return false; }
+
+    // Time spent holding the tree lock while serializing the tree, accumulated until taken.
+    quint64 takeSerializeLockTime() { return _serializeLockUsecs.exchange(0); }
+
     // Octree importers
     bool readFromFile(const char* filename);
     bool readFromURL(const QString& url, const bool isObservable = true, const qint64 callerId = -1, const bool isImport = false); // will support file urls as well...
@@ -219,6 +236,7 @@ public:
     bool readJSONFromStream(uint64_t streamLength, QDataStream& inputStream, const bool isImport = false, const QUrl& urlString = QUrl());
     bool readJSONFromGzippedFile(QString qFileName);
     virtual bool readFromMap(QVariantMap& entityDescription, const bool isImport = false) = 0;
+    virtual bool readFromSnapshotFile(const QString& filename) { return false; }
 
     uint64_t getOctreeElementsCount();
 
@@ -257,6 +275,8 @@ public:
     virtual quint64 getAverageFilterTime() const { return 0; }
 
     void incrementPersistDataVersion() { _persistDataVersion++; }
+    QUuid getPersistID() const { return _persistID; }
+    int getPersistDataVersion() const { return _persistDataVersion; }
 
 
 protected:
@@ -274,6 +294,8 @@ protected:
     QUuid _persistID { QUuid::createUuid() };
     int _persistDataVersion { 0 };
 
+    std::atomic<quint64> _serializeLockUsecs { 0 };
+
     bool _isDirty;
     bool _shouldReaverage;
 
@@ -11,6 +11,8 @@
 #include "OctreeDataUtils.h"
 #include "OctreeEntitiesFileParser.h"
 
+#include <cstring>
+
 #include <Gzip.h>
 #include <udt/PacketHeaders.h>
 
@@ -60,6 +62,28 @@ bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromFile(QString path) {
     return readOctreeDataInfoFromData(data);
 }
 
+// Reads the ID and versions from the header of a binary snapshot, see OctreeUtils::SnapshotHeader.
+// Here "version" is the version of the data packet the snapshot was written with.
+bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromSnapshot(QString path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCritical() << "Cannot open snapshot file for reading: " << path;
+        return false;
+    }
+
+    QByteArray data = file.read(sizeof(SnapshotHeader));
+    SnapshotHeader header;
+    if (!readSnapshotHeader(reinterpret_cast<const uchar*>(data.constData()), data.size(), header)) {
+        qCritical() << "Not a valid snapshot file: " << path;
+        return false;
+    }
+
+    id = QUuid::fromRfc4122(QByteArray::fromRawData(reinterpret_cast<const char*>(header.id), sizeof(header.id)));
+    dataVersion = header.dataVersion;
+    version = header.dataPacketVersion;
+    return true;
+}
+
 QByteArray OctreeUtils::RawOctreeData::toByteArray() {
     QByteArray jsonString;
 
@@ -114,3 +138,11 @@ void OctreeUtils::RawEntityData::writeSubclassData(QByteArray& root) const {
 }
 
 PacketType OctreeUtils::RawEntityData::dataPacketType() const { return PacketType::EntityData; }
+
+bool OctreeUtils::readSnapshotHeader(const uchar* data, qint64 size, SnapshotHeader& header) {
+    if (!data || size < (qint64)sizeof(SnapshotHeader)) {
+        return false;
+    }
+    memcpy(&header, data, sizeof(SnapshotHeader));
+    return header.magic == SnapshotHeader::MAGIC && header.formatVersion == SnapshotHeader::FORMAT_VERSION;
+}
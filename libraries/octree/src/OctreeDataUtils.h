@@ -22,6 +22,42 @@ namespace OctreeUtils {
 using Version = int64_t;
 constexpr Version INITIAL_VERSION = 0;
 
+// Header of a binary octree snapshot (the "bin" persist file type), followed by numRecords records. Each record holds
+// one octree item encoded with the edit packet of recordPacketType, so a snapshot can only be read by a build with the
+// same packet versions and is meant for fast persistence, not for content exchange. Stored in host byte order, which is
+// little endian on every supported platform.
+struct SnapshotHeader {
+    static constexpr uint32_t MAGIC { 0x4e53454f }; // "OESN"
+    static constexpr uint32_t FORMAT_VERSION { 1 };
+
+    uint32_t magic { MAGIC };
+    uint32_t formatVersion { FORMAT_VERSION };
+    uint8_t id[16] {};
+    int64_t dataVersion { -1 };
+    uint32_t dataPacketType { 0 };
+    uint32_t dataPacketVersion { 0 };
+    uint32_t recordPacketType { 0 };
+    uint32_t recordPacketVersion { 0 };
+    uint32_t numRecords { 0 };
+    uint32_t reserved { 0 };
+};
+static_assert(sizeof(SnapshotHeader) == 56, "SnapshotHeader must not change size");
+
+struct SnapshotRecordHeader {
+    enum Encoding : uint32_t {
+        EditPacket = 0,
+        JSON // for items that don't fit an edit packet, e.g. with string properties over 64KB
+    };
+
+    uint32_t size { 0 }; // bytes of record data following this header
+    uint32_t encoding { EditPacket };
+    uint64_t created { 0 };
+};
+static_assert(sizeof(SnapshotRecordHeader) == 16, "SnapshotRecordHeader must not change size");
+
+// Reads the snapshot header at the start of data. The caller is responsible for checking the packet versions.
+bool readSnapshotHeader(const uchar* data, qint64 size, SnapshotHeader& header);
+
 //using PacketType = uint8_t;
 
 // RawOctreeData is an intermediate format between JSON and a fully deserialized Octree.
@@ -43,6 +79,7 @@ public:
     bool readOctreeDataInfoFromData(QByteArray data);
     bool readOctreeDataInfoFromFile(QString path);
     bool readOctreeDataInfoFromMap(const QVariantMap& map);
+    bool readOctreeDataInfoFromSnapshot(QString path);
 };
 
 class RawEntityData : public RawOctreeData {
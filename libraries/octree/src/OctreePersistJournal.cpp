@@ -0,0 +1,398 @@
+//
+//  OctreePersistJournal.cpp
+//  libraries/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreePersistJournal.h"
+
+#include <algorithm>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+
+#include <SharedUtil.h>
+#include <ThreadHelpers.h>
+
+#include "OctreeDataUtils.h"
+#include "OctreeLogging.h"
+
+static const QString JOURNAL_SEGMENT_INFIX = ".journal.";
+static const int JOURNAL_SEGMENT_INDEX_DIGITS = 8;
+
+static const quint32 JOURNAL_MAGIC = 0x4f454a4c; // "OEJL"
+static const quint32 JOURNAL_FORMAT_VERSION = 1;
+static const int JOURNAL_HEADER_SIZE = 2 * sizeof(quint32);
+static const QDataStream::Version JOURNAL_STREAM_VERSION = QDataStream::Qt_5_12;
+
+static QString segmentFilename(const QString& persistFilename, int index) {
+    return persistFilename + JOURNAL_SEGMENT_INFIX + QString("%1").arg(index, JOURNAL_SEGMENT_INDEX_DIGITS, 10, QChar('0'));
+}
+
+OctreePersistJournal::OctreePersistJournal(const QString& persistFilename) :
+    _persistFilename(persistFilename)
+{
+}
+
+OctreePersistJournal::~OctreePersistJournal() {
+    waitForCompaction();
+}
+
+void OctreePersistJournal::entityAdded(const QUuid& entityID) {
+    markChanged(entityID, EntityAdded);
+}
+
+void OctreePersistJournal::entityEdited(const QUuid& entityID) {
+    markChanged(entityID, EntityEdited);
+}
+
+void OctreePersistJournal::entityDeleted(const QUuid& entityID) {
+    markChanged(entityID, EntityDeleted);
+}
+
+void OctreePersistJournal::markChanged(const QUuid& entityID, RecordType type) {
+    std::lock_guard<std::mutex> lock(_changesMutex);
+    auto it = _changes.find(entityID);
+    if (it == _changes.end()) {
+        _changes.insert(entityID, type);
+    } else if (type == EntityDeleted || *it != EntityAdded) {
+        // an edit of an entity added in the same interval is still an add; a delete always wins, since the entity
+        // may have been in the journal before it was re-added
+        *it = type;
+    }
+}
+
+OctreePersistJournal::Changes OctreePersistJournal::takeChanges() {
+    QHash<QUuid, RecordType> changes;
+    {
+        std::lock_guard<std::mutex> lock(_changesMutex);
+        changes.swap(_changes);
+    }
+
+    Changes result;
+    for (auto it = changes.cbegin(); it != changes.cend(); ++it) {
+        switch (it.value()) {
+            case EntityAdded:
+                result.added.push_back(it.key());
+                break;
+            case EntityEdited:
+                result.edited.push_back(it.key());
+                break;
+            case EntityDeleted:
+                result.deleted.push_back(it.key());
+                break;
+        }
+    }
+    return result;
+}
+
+void OctreePersistJournal::restoreChanges(const Changes& changes) {
+    std::lock_guard<std::mutex> lock(_changesMutex);
+    for (const auto& entityID : changes.added) {
+        if (!_changes.contains(entityID)) {
+            _changes.insert(entityID, EntityAdded);
+        }
+    }
+    for (const auto& entityID : changes.edited) {
+        if (!_changes.contains(entityID)) {
+            _changes.insert(entityID, EntityEdited);
+        }
+    }
+    for (const auto& entityID : changes.deleted) {
+        if (!_changes.contains(entityID)) {
+            _changes.insert(entityID, EntityDeleted);
+        }
+    }
+}
+
+void OctreePersistJournal::clearChanges() {
+    std::lock_guard<std::mutex> lock(_changesMutex);
+    _changes.clear();
+}
+
+bool OctreePersistJournal::openActiveSegment() {
+    if (_activeSegment.isOpen()) {
+        return true;
+    }
+
+    if (_nextSegmentIndex < 0) {
+        _nextSegmentIndex = 0;
+        auto segments = findSegments(_persistFilename);
+        if (!segments.isEmpty()) {
+            _nextSegmentIndex = segments.last().section('.', -1).toInt() + 1;
+        }
+    }
+
+    _activeSegment.setFileName(segmentFilename(_persistFilename, _nextSegmentIndex++));
+    if (!_activeSegment.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(octree) << "Failed to open journal segment" << _activeSegment.fileName() << _activeSegment.errorString();
+        return false;
+    }
+
+    QByteArray header;
+    QDataStream stream(&header, QIODevice::WriteOnly);
+    stream.setVersion(JOURNAL_STREAM_VERSION);
+    stream << JOURNAL_MAGIC << JOURNAL_FORMAT_VERSION;
+    if (_activeSegment.write(header) != header.size()) {
+        qCWarning(octree) << "Failed to write journal segment" << _activeSegment.fileName() << _activeSegment.errorString();
+        _activeSegment.close();
+        return false;
+    }
+    _activeSegmentSize = header.size();
+    return true;
+}
+
+qint64 OctreePersistJournal::append(const QUuid& dataID, int64_t dataVersion, const Changes& changes,
+                                    const QVariantList& entities) {
+    if (!openActiveSegment()) {
+        return -1;
+    }
+
+    QByteArray records;
+    quint32 numRecords = 0;
+    {
+        QDataStream stream(&records, QIODevice::WriteOnly);
+        stream.setVersion(JOURNAL_STREAM_VERSION);
+
+        auto changedIDs = changes.getChangedIDs();
+        for (int i = 0; i < changedIDs.size() && i < entities.size(); ++i) {
+            if (!entities[i].isValid()) {
+                // gone, or one a snapshot would leave out, so drop any earlier record of it from the persist file
+                stream << (quint8)EntityDeleted << changedIDs[i];
+            } else {
+                RecordType type = i < changes.added.size() ? EntityAdded : EntityEdited;
+                stream << (quint8)type << changedIDs[i] << entities[i].toMap();
+            }
+            ++numRecords;
+        }
+        for (const auto& entityID : changes.deleted) {
+            stream << (quint8)EntityDeleted << entityID;
+            ++numRecords;
+        }
+    }
+
+    QByteArray payload;
+    {
+        QDataStream stream(&payload, QIODevice::WriteOnly);
+        stream.setVersion(JOURNAL_STREAM_VERSION);
+        stream << dataID << (qint64)dataVersion << numRecords;
+    }
+    payload.append(records);
+    QByteArray compressed = qCompress(payload);
+
+    QByteArray batch;
+    {
+        QDataStream stream(&batch, QIODevice::WriteOnly);
+        stream.setVersion(JOURNAL_STREAM_VERSION);
+        stream << (quint32)compressed.size() << qChecksum(compressed.constData(), compressed.size());
+    }
+    batch.append(compressed);
+
+    if (_activeSegment.write(batch) != batch.size() || !_activeSegment.flush()) {
+        qCWarning(octree) << "Failed to append to journal segment" << _activeSegment.fileName() << _activeSegment.errorString();
+        return -1;
+    }
+    _activeSegmentSize += batch.size();
+    return batch.size();
+}
+
+bool OctreePersistJournal::hasClosedSegments() const {
+    return findSegments(_persistFilename).size() > (_activeSegment.isOpen() ? 1 : 0);
+}
+
+void OctreePersistJournal::startCompaction() {
+    if (_isCompacting) {
+        return;
+    }
+    waitForCompaction();
+
+    if (_activeSegment.isOpen()) {
+        _activeSegment.close();
+        _activeSegmentSize = 0;
+    }
+
+    QStringList segments = findSegments(_persistFilename);
+    if (segments.isEmpty()) {
+        return;
+    }
+
+    _isCompacting = true;
+    _compactionThread = std::thread([this, segments] {
+        setThreadName("OctreePersistCompaction");
+
+        quint64 start = usecTimestampNow();
+        if (compact(_persistFilename, segments)) {
+            _lastCompactionUsecs = usecTimestampNow() - start;
+            ++_numCompactions;
+            ++_numUnseenCompactions;
+        }
+        _isCompacting = false;
+    });
+}
+
+void OctreePersistJournal::waitForCompaction() {
+    if (_compactionThread.joinable()) {
+        _compactionThread.join();
+    }
+}
+
+QStringList OctreePersistJournal::findSegments(const QString& persistFilename) {
+    QFileInfo persistFile(persistFilename);
+    QDir directory = persistFile.absoluteDir();
+    QString prefix = persistFile.fileName() + JOURNAL_SEGMENT_INFIX;
+
+    QStringList segments;
+    for (const auto& name : directory.entryList({ prefix + "*" }, QDir::Files, QDir::Name)) {
+        bool isIndex = false;
+        name.mid(prefix.size()).toInt(&isIndex);
+        if (isIndex) {
+            segments << directory.absoluteFilePath(name);
+        }
+    }
+    return segments;
+}
+
+bool OctreePersistJournal::readSegment(const QString& filename, QVector<Batch>& batches) {
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(octree) << "Failed to open journal segment" << filename << file.errorString();
+        return false;
+    }
+    QByteArray data = file.readAll();
+    if (data.size() < JOURNAL_HEADER_SIZE) {
+        // created right before a crash, nothing was written to it
+        return true;
+    }
+
+    QDataStream stream(data);
+    stream.setVersion(JOURNAL_STREAM_VERSION);
+    quint32 magic;
+    quint32 formatVersion;
+    stream >> magic >> formatVersion;
+    if (magic != JOURNAL_MAGIC || formatVersion != JOURNAL_FORMAT_VERSION) {
+        qCWarning(octree) << "Unrecognized journal segment" << filename;
+        return false;
+    }
+
+    while (!stream.atEnd()) {
+        quint32 size;
+        quint16 checksum;
+        stream >> size >> checksum;
+        if (stream.status() != QDataStream::Ok || size > (quint32)(data.size() - stream.device()->pos())) {
+            qCWarning(octree) << "Ignoring truncated batch at the end of journal segment" << filename;
+            break;
+        }
+
+        QByteArray compressed(size, Qt::Uninitialized);
+        stream.readRawData(compressed.data(), size);
+        if (qChecksum(compressed.constData(), size) != checksum) {
+            qCWarning(octree) << "Ignoring corrupt batch at the end of journal segment" << filename;
+            break;
+        }
+
+        QByteArray payload = qUncompress(compressed);
+        QDataStream batchStream(payload);
+        batchStream.setVersion(JOURNAL_STREAM_VERSION);
+
+        Batch batch;
+        qint64 dataVersion;
+        quint32 numRecords;
+        batchStream >> batch.dataID >> dataVersion >> numRecords;
+        batch.dataVersion = dataVersion;
+        for (quint32 i = 0; i < numRecords && batchStream.status() == QDataStream::Ok; ++i) {
+            Record record;
+            quint8 type;
+            batchStream >> type >> record.entityID;
+            record.type = (RecordType)type;
+            if (record.type != EntityDeleted) {
+                batchStream >> record.properties;
+            }
+            batch.records.push_back(record);
+        }
+        if (batchStream.status() != QDataStream::Ok) {
+            qCWarning(octree) << "Ignoring unreadable batch at the end of journal segment" << filename;
+            break;
+        }
+        batches.push_back(batch);
+    }
+    return true;
+}
+
+bool OctreePersistJournal::compact(const QString& persistFilename, const QStringList& segments) {
+    OctreeUtils::RawEntityData data;
+    QFile persistFile(persistFilename);
+    if (persistFile.exists()) {
+        if (!persistFile.open(QIODevice::ReadOnly)) {
+            qCWarning(octree) << "Failed to open" << persistFilename << "for compaction:" << persistFile.errorString();
+            return false;
+        }
+        if (!data.readOctreeDataInfoFromData(persistFile.readAll())) {
+            qCWarning(octree) << "Failed to read" << persistFilename << "for compaction";
+            return false;
+        }
+        persistFile.close();
+    } else {
+        data.resetIdAndVersion();
+        data.version = versionForPacketType(data.dataPacketType());
+    }
+
+    QHash<QUuid, int> indices;
+    for (int i = 0; i < data.variantEntityData.size(); ++i) {
+        indices[QUuid(data.variantEntityData[i].toMap()["id"].toString())] = i;
+    }
+
+    int numRecords = 0;
+    for (const auto& segment : segments) {
+        QVector<Batch> batches;
+        if (!readSegment(segment, batches)) {
+            return false;
+        }
+
+        for (const auto& batch : batches) {
+            data.id = batch.dataID;
+            data.dataVersion = batch.dataVersion;
+
+            for (const auto& record : batch.records) {
+                auto it = indices.find(record.entityID);
+                if (record.type == EntityDeleted) {
+                    if (it != indices.end()) {
+                        data.variantEntityData[it.value()] = QVariant();
+                        indices.erase(it);
+                    }
+                } else if (it != indices.end()) {
+                    data.variantEntityData[it.value()] = record.properties;
+                } else {
+                    indices[record.entityID] = data.variantEntityData.size();
+                    data.variantEntityData.push_back(record.properties);
+                }
+            }
+            numRecords += batch.records.size();
+        }
+    }
+
+    // drop the slots of deleted entities
+    data.variantEntityData.erase(std::remove_if(data.variantEntityData.begin(), data.variantEntityData.end(),
+                                                [](const QVariant& entity) { return !entity.isValid(); }),
+                                 data.variantEntityData.end());
+
+    QByteArray contents = persistFilename.endsWith(".gz") ? data.toGzippedByteArray() : data.toByteArray();
+    QSaveFile file(persistFilename);
+    if (contents.isEmpty() || !file.open(QIODevice::WriteOnly) || file.write(contents) != contents.size() || !file.commit()) {
+        qCWarning(octree) << "Failed to write compacted" << persistFilename << file.errorString();
+        return false;
+    }
+
+    for (const auto& segment : segments) {
+        QFile::remove(segment);
+    }
+
+    qCDebug(octree) << "Compacted" << segments.size() << "journal segments (" << numRecords << "records ) into"
+                    << persistFilename << "-" << data.variantEntityData.size() << "entities";
+    return true;
+}
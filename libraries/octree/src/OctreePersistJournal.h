@@ -0,0 +1,117 @@
+//
+//  OctreePersistJournal.h
+//  libraries/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Incremental octree persistence: an append-only journal of entity changes next to the json.gz persist file
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreePersistJournal_h
+#define hifi_OctreePersistJournal_h
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QUuid>
+#include <QtCore/QVariant>
+#include <QtCore/QVector>
+
+// The journal is a series of segment files named <persist file>.journal.<n>. Each persist interval appends one batch to
+// the active segment holding the current state of every entity added or edited since the previous batch, and the IDs of
+// the entities deleted since. Compaction closes the active segment and folds the closed ones into the persist file on a
+// background thread, without touching the tree. Any segments left over at startup are folded in before the persist file
+// is loaded, so that a crash loses at most the changes of the last persist interval.
+class OctreePersistJournal {
+public:
+    enum RecordType : uint8_t {
+        EntityAdded = 0,
+        EntityEdited,
+        EntityDeleted
+    };
+
+    struct Changes {
+        QVector<QUuid> added;
+        QVector<QUuid> edited;
+        QVector<QUuid> deleted;
+
+        bool isEmpty() const { return added.isEmpty() && edited.isEmpty() && deleted.isEmpty(); }
+        QVector<QUuid> getChangedIDs() const { return added + edited; }
+    };
+
+    OctreePersistJournal(const QString& persistFilename);
+    ~OctreePersistJournal();
+
+    // Change tracking. These only record the entity ID, so they are cheap enough to call from the tree's add, edit and
+    // delete hooks while the tree is locked, from any thread.
+    void entityAdded(const QUuid& entityID);
+    void entityEdited(const QUuid& entityID);
+    void entityDeleted(const QUuid& entityID);
+    Changes takeChanges();
+    void restoreChanges(const Changes& changes); // puts back changes that failed to persist, unless superseded since
+    void clearChanges();
+
+    // Appends one batch to the active segment. entities holds the current state of changes.added followed by
+    // changes.edited. Invalid entries, for entities deleted since or left out of the persist file, are written as deletes.
+    // Returns the bytes written, or -1.
+    qint64 append(const QUuid& dataID, int64_t dataVersion, const Changes& changes, const QVariantList& entities);
+    qint64 getActiveSegmentSize() const { return _activeSegmentSize; }
+    bool hasClosedSegments() const;
+
+    // Closes the active segment and folds every closed segment into the persist file on a background thread.
+    void startCompaction();
+    bool isCompacting() const { return _isCompacting; }
+    void waitForCompaction();
+
+    // True once for every compaction that completed successfully since the last call.
+    bool takeCompactionCompleted() { return _numUnseenCompactions.exchange(0) > 0; }
+    int getNumCompactions() const { return _numCompactions; }
+    quint64 getLastCompactionTime() const { return _lastCompactionUsecs; }
+
+    static QStringList findSegments(const QString& persistFilename);
+
+    // Folds the given segments, in order, into the persist file and removes them.
+    static bool compact(const QString& persistFilename, const QStringList& segments);
+
+private:
+    struct Record {
+        RecordType type;
+        QUuid entityID;
+        QVariantMap properties;
+    };
+
+    struct Batch {
+        QUuid dataID;
+        int64_t dataVersion;
+        QVector<Record> records;
+    };
+
+    void markChanged(const QUuid& entityID, RecordType type);
+    bool openActiveSegment();
+    static bool readSegment(const QString& filename, QVector<Batch>& batches);
+
+    const QString _persistFilename;
+
+    std::mutex _changesMutex;
+    QHash<QUuid, RecordType> _changes;
+
+    QFile _activeSegment;
+    qint64 _activeSegmentSize { 0 };
+    int _nextSegmentIndex { -1 };
+
+    std::thread _compactionThread;
+    std::atomic<bool> _isCompacting { false };
+    std::atomic<int> _numUnseenCompactions { 0 };
+    std::atomic<int> _numCompactions { 0 };
+    std::atomic<quint64> _lastCompactionUsecs { 0 };
+};
+
+#endif // hifi_OctreePersistJournal_h
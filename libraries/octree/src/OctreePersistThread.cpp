@@ -11,6 +11,7 @@
 
 #include "OctreePersistThread.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -38,11 +39,15 @@
 #include "OctreeDataUtils.h"
 
 constexpr std::chrono::seconds OctreePersistThread::DEFAULT_PERSIST_INTERVAL { 30 };
+constexpr std::chrono::seconds OctreePersistThread::DEFAULT_COMPACTION_INTERVAL { 300 };
 constexpr std::chrono::milliseconds TIME_BETWEEN_PROCESSING { 10 };
 
 constexpr int MAX_OCTREE_REPLACEMENT_BACKUP_FILES_COUNT { 20 };
 constexpr int64_t MAX_OCTREE_REPLACEMENT_BACKUP_FILES_SIZE_BYTES { 50 * 1000 * 1000 };
 
+// the journal is compacted early once it grows past the size of the persist file, or this, whichever is larger
+constexpr qint64 MIN_JOURNAL_COMPACTION_BYTES { 8 * 1000 * 1000 };
+
 OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& filename, std::chrono::milliseconds persistInterval,
                                          bool debugTimestampNow, QString persistAsFileType) :
     _tree(tree),
@@ -60,9 +65,29 @@ OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& file
     _filename = sansExt + "." + _persistAsFileType;
 }
 
+void OctreePersistThread::enableJournal(std::chrono::milliseconds compactionInterval) {
+    if (_persistAsFileType != "json.gz") {
+        qCWarning(octree) << "Journaled persistence requires a json.gz persist file, not" << _persistAsFileType;
+        return;
+    }
+    _journal = std::make_shared<OctreePersistJournal>(_filename);
+    _compactionInterval = compactionInterval;
+}
+
 void OctreePersistThread::start() {
     cleanupOldReplacementBackups();
 
+    // fold whatever the journal of the previous run holds into the persist file before reading it. This happens even
+    // if the journal is now disabled, so that switching it off doesn't lose the changes it recorded.
+    auto journalSegments = OctreePersistJournal::findSegments(_filename);
+    if (!journalSegments.isEmpty()) {
+        qCDebug(octree) << "Replaying" << journalSegments.size() << "journal segments into" << _filename;
+        if (!OctreePersistJournal::compact(_filename, journalSegments)) {
+            qCWarning(octree) << "Failed to replay the journal into" << _filename;
+        }
+    }
+    _lastCompaction = std::chrono::steady_clock::now();
+
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
     packetReceiver.registerListener(PacketType::OctreeDataFileReply,
         PacketReceiver::makeUnsourcedListenerReference<OctreePersistThread>(this, &OctreePersistThread::handleOctreeDataFileReply));
@@ -72,10 +97,26 @@ void OctreePersistThread::start() {
 
     auto packet = NLPacket::create(PacketType::OctreeDataFileRequest, -1, true, false);
 
+    // the newest persist file of any type is loaded, which is how the content carries over when the file type changes
+    _loadFilename = findMostRecentFileExtension(_filename, PERSIST_EXTENSIONS);
+
     OctreeUtils::RawOctreeData data;
-    qCDebug(octree) << "Reading octree data from" << _filename;
-    QFile file(_filename);
-    if (file.open(QIODevice::ReadOnly)) {
+    qCDebug(octree) << "Reading octree data from" << _loadFilename;
+    QFile file(_loadFilename);
+    if (_loadFilename.endsWith(".bin")) {
+        // only the header is needed up front, the records are read straight from the mapped file once the DS replies
+        if (data.readOctreeDataInfoFromSnapshot(_loadFilename) && data.version == _tree->expectedVersion()) {
+            qCDebug(octree) << "Current octree snapshot: ID(" << data.id << ") DataVersion(" << data.dataVersion << ")";
+            packet->writePrimitive(true);
+            auto id = data.id.toRfc4122();
+            packet->write(id);
+            packet->writePrimitive(data.dataVersion);
+        } else {
+            // snapshots are tied to the packet version they were written with, so ask the DS for its JSON copy instead
+            qCWarning(octree) << "Octree snapshot" << _loadFilename << "is invalid or from another version, not using it";
+            packet->writePrimitive(false);
+        }
+    } else if (file.open(QIODevice::ReadOnly)) {
         QByteArray jsonData(file.readAll());
         file.close();
         if (!gunzip(jsonData, _cachedJSONData)) {
@@ -94,7 +135,7 @@ void OctreePersistThread::start() {
             packet->writePrimitive(false);
         }
     } else {
-        qCWarning(octree) << "Couldn't access file" << _filename << file.errorString();
+        qCWarning(octree) << "Couldn't access file" << _loadFilename << file.errorString();
         packet->writePrimitive(false);
     }
 
@@ -113,24 +154,28 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     QByteArray replacementData;
     OctreeUtils::RawOctreeData data;
     bool hasValidOctreeData { false };
+    bool resetSnapshotID { false };
     if (includesNewData) {
         _cachedJSONData.clear();
         replacementData = message->readAll();
         replaceData(replacementData);
-        hasValidOctreeData = data.readOctreeDataInfoFromFile(_filename);
+        hasValidOctreeData = data.readOctreeDataInfoFromFile(_loadFilename);
         qDebug() << "Got OctreeDataFileReply, new data sent";
     } else {
         qDebug() << "Got OctreeDataFileReply, current entity data is sufficient";
         
         OctreeUtils::RawEntityData data;
-        qCDebug(octree) << "Reading octree data from" << _filename;
-        if (data.readOctreeDataInfoFromData(_cachedJSONData)) {
+        qCDebug(octree) << "Reading octree data from" << _loadFilename;
+        if (_loadFilename.endsWith(".bin")) {
+            hasValidOctreeData = data.readOctreeDataInfoFromSnapshot(_loadFilename);
+            resetSnapshotID = hasValidOctreeData && data.id.isNull();
+        } else if (data.readOctreeDataInfoFromData(_cachedJSONData)) {
             hasValidOctreeData = true;
             if (data.id.isNull()) {
                 qCDebug(octree) << "Current octree data has a null id, updating";
                 data.resetIdAndVersion();
 
-                QFile file(_filename);
+                QFile file(_loadFilename);
                 if (file.open(QIODevice::WriteOnly)) {
                     auto entityData = data.toGzippedByteArray();
                     file.write(entityData);
@@ -155,7 +200,7 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
         PerformanceWarning warn(true, "Loading Octree File", true);
 
         if (_cachedJSONData.isEmpty()) {
-            persistentFileRead = _tree->readFromFile(_filename.toLocal8Bit().constData());
+            persistentFileRead = _tree->readFromFile(_loadFilename.toLocal8Bit().constData());
         } else {
             QDataStream jsonStream(_cachedJSONData);
             persistentFileRead = _tree->readFromStream(-1, jsonStream);
@@ -164,10 +209,31 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     });
 
     _cachedJSONData.clear();
+
+    if (resetSnapshotID) {
+        // the id is read along with the records, so it is replaced once they are loaded and persisted with them
+        qCDebug(octree) << "Current octree snapshot has a null id, updating";
+        data.resetIdAndVersion();
+        _tree->setOctreeVersionInfo(data.id, data.dataVersion);
+        _isPersistFileStale = true;
+    }
+
     quint64 loadDone = usecTimestampNow();
     _loadTimeUSecs = loadDone - loadStarted;
 
     _tree->clearDirtyBit(); // the tree is clean since we just loaded it
+    if (_journal) {
+        _journal->clearChanges(); // and so is the journal, loading reported every entity as added
+    }
+
+    if (persistentFileRead && _loadFilename != _filename) {
+        // the content came from a persist file of another type, write it out as the configured type on the next persist
+        qCDebug(octree) << "Loaded" << _loadFilename << "- will persist it as" << _filename;
+        _isPersistFileStale = true;
+    }
+    if (_isPersistFileStale) {
+        _tree->setDirtyBit();
+    }
 
     unsigned long nodeCount = OctreeElement::getNodeCount();
     unsigned long internalNodeCount = OctreeElement::getInternalNodeCount();
@@ -188,6 +254,7 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     }
 
     _initialLoadComplete = true;
+    _lastJournalScan = usecTimestampNow();
 
     // Since we just loaded the persistent file, we can consider ourselves as having just persisted
     _lastPersistCheck = std::chrono::steady_clock::now();
@@ -205,8 +272,8 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
 QString OctreePersistThread::getPersistFileMimeType() const {
     if (_persistAsFileType == "json") {
         return "application/json";
-    } if (_persistAsFileType == "json.gz") {
-        return "application/zip";
+    } if (_persistAsFileType == "json.gz" || _persistAsFileType == "bin") {
+        return "application/zip"; // snapshots are handed out as json.gz, see getPersistFileContents
     }
     return "";
 }
@@ -214,7 +281,13 @@ QString OctreePersistThread::getPersistFileMimeType() const {
 void OctreePersistThread::replaceData(QByteArray data) {
     backupCurrentFile();
 
-    QFile currentFile { _filename };
+    // the DS always sends JSON, which is converted to a snapshot by the first persist
+    _loadFilename = _filename;
+    if (_persistAsFileType == "bin") {
+        _loadFilename = fileNameWithoutExtension(_filename, PERSIST_EXTENSIONS) + ".json.gz";
+    }
+
+    QFile currentFile { _loadFilename };
     if (currentFile.open(QIODevice::WriteOnly)) {
         currentFile.write(data);
         qDebug() << "Wrote replacement data";
@@ -252,6 +325,13 @@ void OctreePersistThread::process() {
     if (timeSinceLastPersist > _persistInterval) {
         _lastPersistCheck = now;
         persist();
+        if (_journal) {
+            compactJournalIfNeeded();
+        }
+    }
+
+    if (_journal && _journal->takeCompactionCompleted()) {
+        sendLatestEntityDataToDS();
     }
 
     QTimer::singleShot(TIME_BETWEEN_PROCESSING.count(), this, &OctreePersistThread::process);
@@ -260,11 +340,20 @@ void OctreePersistThread::process() {
 void OctreePersistThread::aboutToFinish() {
     qCDebug(octree) << "Persist thread about to finish...";
     persist();
+    if (_journal) {
+        _journal->waitForCompaction();
+    }
     qCDebug(octree) << "Persist thread done with about to finish...";
 }
 
 QByteArray OctreePersistThread::getPersistFileContents() const {
     QByteArray fileContents;
+    if (_persistAsFileType == "bin") {
+        // snapshots only load in builds with the same packet versions, so hand out the content as json.gz instead
+        _tree->toJSON(&fileContents, nullptr, true);
+        return fileContents;
+    }
+
     QFile file(_filename);
     if (file.open(QIODevice::ReadOnly)) {
         fileContents = file.readAll();
@@ -303,26 +392,117 @@ void OctreePersistThread::cleanupOldReplacementBackups() {
 }
 
 void OctreePersistThread::persist() {
-    if (_tree->isDirty() && _initialLoadComplete) {
+    // the journal only holds changes, so it needs a persist file that is up to date with the tree to apply to
+    bool useJournal = _journal && !_isPersistFileStale;
+    // changes the server makes itself, such as simulation, don't mark the tree dirty, so the journal looks for them anyway
+    if ((_tree->isDirty() || useJournal) && _initialLoadComplete) {
+        quint64 persistStart = usecTimestampNow();
+        _tree->takeSerializeLockTime();
+
+        quint64 lockUsecs = 0;
+        qint64 bytesWritten = useJournal ? persistJournal() : persistSnapshot(lockUsecs);
+        if (bytesWritten == 0) {
+            return;
+        }
 
-        _tree->withWriteLock([&] {
-            qCDebug(octree) << "pruning Octree before saving...";
-            _tree->pruneTree();
-            qCDebug(octree) << "DONE pruning Octree before saving...";
-        });
+        quint64 persistUsecs = usecTimestampNow() - persistStart;
+        lockUsecs += _tree->takeSerializeLockTime();
+        qCDebug(octree) << "Persist took" << persistUsecs << "usecs, tree locked for" << lockUsecs << "usecs,"
+                        << bytesWritten << "bytes written";
+
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        _stats.numPersists++;
+        _stats.lastPersistUsecs = persistUsecs;
+        _stats.lastLockUsecs = lockUsecs;
+        _stats.lastBytesWritten = bytesWritten;
+        _stats.maxPersistUsecs = std::max(_stats.maxPersistUsecs, persistUsecs);
+        _stats.maxLockUsecs = std::max(_stats.maxLockUsecs, lockUsecs);
+        _stats.totalPersistUsecs += persistUsecs;
+        _stats.totalLockUsecs += lockUsecs;
+    }
+}
 
-        _tree->incrementPersistDataVersion();
+qint64 OctreePersistThread::persistSnapshot(quint64& lockUsecs) {
+    _tree->withWriteLock([&] {
+        quint64 lockStart = usecTimestampNow();
+        qCDebug(octree) << "pruning Octree before saving...";
+        _tree->pruneTree();
+        qCDebug(octree) << "DONE pruning Octree before saving...";
+        lockUsecs += usecTimestampNow() - lockStart;
+    });
 
-        qCDebug(octree) << "Saving Octree data to:" << _filename;
-        if (_tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
-            _tree->clearDirtyBit(); // tree is clean after saving
-            qCDebug(octree) << "DONE persisting Octree data to" << _filename;
-        } else {
-            qCWarning(octree) << "Failed to persist Octree data to" << _filename;
-        }
+    _tree->incrementPersistDataVersion();
+
+    qint64 bytesWritten = -1;
+    qCDebug(octree) << "Saving Octree data to:" << _filename;
+    quint64 snapshotStart = usecTimestampNow();
+    if (_tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
+        _tree->clearDirtyBit(); // tree is clean after saving
+        _isPersistFileStale = false;
+        _lastJournalScan = snapshotStart;
+        bytesWritten = QFileInfo(_filename).size();
+        qCDebug(octree) << "DONE persisting Octree data to" << _filename;
+    } else {
+        qCWarning(octree) << "Failed to persist Octree data to" << _filename;
+    }
 
-        sendLatestEntityDataToDS();
+    sendLatestEntityDataToDS();
+    return bytesWritten;
+}
+
+qint64 OctreePersistThread::persistJournal() {
+    // clear the dirty bit first, so that an edit racing with this persist either makes it into this batch or marks the
+    // tree dirty again
+    _tree->clearDirtyBit();
+    quint64 scanStart = usecTimestampNow();
+    for (const auto& entityID : _tree->findEntitiesChangedOnServerSince(_lastJournalScan)) {
+        _journal->entityEdited(entityID);
+    }
+    _lastJournalScan = scanStart;
+    auto changes = _journal->takeChanges();
+    if (changes.isEmpty()) {
+        return 0;
     }
+
+    _tree->incrementPersistDataVersion();
+
+    QVariantList entities;
+    _tree->writeEntitiesToList(changes.getChangedIDs(), entities, true, true);
+
+    qint64 bytesWritten = _journal->append(_tree->getPersistID(), _tree->getPersistDataVersion(), changes, entities);
+    if (bytesWritten < 0) {
+        qCWarning(octree) << "Failed to persist Octree changes to the journal of" << _filename;
+        _journal->restoreChanges(changes);
+        _tree->setDirtyBit();
+    }
+    return bytesWritten;
+}
+
+void OctreePersistThread::compactJournalIfNeeded() {
+    if (_journal->isCompacting()) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    qint64 journalSize = _journal->getActiveSegmentSize();
+    bool isJournalLarge = journalSize >= std::max(MIN_JOURNAL_COMPACTION_BYTES, QFileInfo(_filename).size());
+    bool isCompactionDue = now - _lastCompaction > _compactionInterval && (journalSize > 0 || _journal->hasClosedSegments());
+
+    if (isJournalLarge || isCompactionDue) {
+        qCDebug(octree) << "Compacting the journal of" << _filename << "-" << journalSize << "bytes";
+        _lastCompaction = now;
+        _journal->startCompaction();
+    }
+}
+
+OctreePersistThread::PersistStats OctreePersistThread::getPersistStats() const {
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    PersistStats stats = _stats;
+    if (_journal) {
+        stats.numCompactions = _journal->getNumCompactions();
+        stats.lastCompactionUsecs = _journal->getLastCompactionTime();
+    }
+    return stats;
 }
 
 void OctreePersistThread::sendLatestEntityDataToDS() {
@@ -331,7 +511,16 @@ void OctreePersistThread::sendLatestEntityDataToDS() {
     const DomainHandler& domainHandler = nodeList->getDomainHandler();
 
     QByteArray data;
-    if (_tree->toJSON(&data, nullptr, true)) {
+    bool hasData;
+    if (_journal) {
+        // the persist file is current as of the last compaction, send it as is rather than serializing the whole tree
+        data = getPersistFileContents();
+        hasData = !data.isEmpty();
+    } else {
+        hasData = _tree->toJSON(&data, nullptr, true);
+    }
+
+    if (hasData) {
         auto message = NLPacketList::create(PacketType::OctreeDataPersist, QByteArray(), true, true);
         message->write(data);
         nodeList->sendPacketList(std::move(message), domainHandler.getSockAddr());
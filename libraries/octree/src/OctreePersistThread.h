@@ -14,10 +14,14 @@
 #ifndef hifi_OctreePersistThread_h
 #define hifi_OctreePersistThread_h
 
+#include <memory>
+#include <mutex>
+
 #include <QString>
 #include <QtCore/QSharedPointer>
 #include <GenericThread.h>
 #include "Octree.h"
+#include "OctreePersistJournal.h"
 
 class OctreePersistThread : public QObject {
     Q_OBJECT
@@ -31,7 +35,21 @@ public:
         quint64 lastBackup;
     };
 
+    struct PersistStats {
+        int numPersists { 0 };
+        quint64 lastPersistUsecs { 0 };
+        quint64 lastLockUsecs { 0 }; // time the tree was locked for during the last persist
+        qint64 lastBytesWritten { 0 };
+        quint64 maxPersistUsecs { 0 };
+        quint64 maxLockUsecs { 0 };
+        quint64 totalPersistUsecs { 0 };
+        quint64 totalLockUsecs { 0 };
+        int numCompactions { 0 };
+        quint64 lastCompactionUsecs { 0 };
+    };
+
     static const std::chrono::seconds DEFAULT_PERSIST_INTERVAL;
+    static const std::chrono::seconds DEFAULT_COMPACTION_INTERVAL;
 
     OctreePersistThread(OctreePointer tree,
                         const QString& filename,
@@ -48,6 +66,15 @@ public:
 
     void aboutToFinish(); /// call this to inform the persist thread that the owner is about to finish to support final persist
 
+    /// Persist changes to a journal instead of rewriting the whole file every interval, see OctreePersistJournal.
+    /// Must be called before start(); the owner is responsible for feeding the tree's changes to getJournal().
+    void enableJournal(std::chrono::milliseconds compactionInterval = DEFAULT_COMPACTION_INTERVAL);
+    // Shared, so that connections feeding it can't outlive it
+    std::shared_ptr<OctreePersistJournal> getJournal() const { return _journal; }
+    bool isJournalEnabled() const { return (bool)_journal; }
+
+    PersistStats getPersistStats() const;
+
 public slots:
     void start();
 
@@ -60,6 +87,9 @@ protected slots:
 
 protected:
     void persist();
+    qint64 persistSnapshot(quint64& lockUsecs);
+    qint64 persistJournal();
+    void compactJournalIfNeeded();
     bool backupCurrentFile();
     void cleanupOldReplacementBackups();
 
@@ -79,7 +109,17 @@ private:
     quint64 _lastTimeDebug;
 
     QString _persistAsFileType;
+    QString _loadFilename; // the persist file the tree is loaded from, which may be of another type than _filename
+    bool _isPersistFileStale { false };
     QByteArray _cachedJSONData;
+
+    std::shared_ptr<OctreePersistJournal> _journal;
+    std::chrono::milliseconds _compactionInterval { DEFAULT_COMPACTION_INTERVAL };
+    std::chrono::steady_clock::time_point _lastCompaction;
+    quint64 _lastJournalScan { 0 }; // the server's own changes since then are yet to be journaled
+
+    mutable std::mutex _statsMutex;
+    PersistStats _stats;
 };
 
 #endif // hifi_OctreePersistThread_h
@@ -11,6 +11,8 @@
 
 #include "CharacterController.h"
 
+#include <mutex>
+
 #include <AvatarConstants.h>
 #include <NumericalConstants.h>
 #include <PhysicsCollisionGroups.h>
@@ -25,9 +27,11 @@ const float STUCK_IMPULSE = 500.0f;
 
 
 const btVector3 LOCAL_UP_AXIS(0.0f, 1.0f, 0.0f);
-static bool _appliedStuckRecoveryStrategy = false;
+static std::atomic<bool> _appliedStuckRecoveryStrategy { false };
 
 static TemporaryPairwiseCollisionFilter _pairwiseFilter;
+// with multithreaded stepping the narrowphase, and hence applyPairwiseFilter, runs on several threads at once
+static std::mutex _pairwiseFilterMutex;
 
 // Note: applyPairwiseFilter is registered as a sub-callback to Bullet's gContactAddedCallback feature
 // when we detect MyAvatar is "stuck".  It will disable new ManifoldPoints between MyAvatar and mesh objects with
@@ -41,6 +45,7 @@ bool applyPairwiseFilter(btManifoldPoint& cp,
     // and the flagged object will always be sorted to Obj0.  Hence the "other" is always Obj1.
     const btCollisionObject* other = colObj1Wrap->m_collisionObject;
 
+    std::lock_guard<std::mutex> lock(_pairwiseFilterMutex);
     if (_pairwiseFilter.isFiltered(other)) {
         _pairwiseFilter.incrementEntry(other);
         // disable contact point by setting distance too large and normal to zero
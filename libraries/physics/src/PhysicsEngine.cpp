@@ -19,6 +19,8 @@
 #include <PhysicsCollisionGroups.h>
 #include <Profile.h>
 #include <BulletCollision/CollisionShapes/btTriangleShape.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
 
 #include "CharacterController.h"
 #include "ObjectMotionState.h"
@@ -32,6 +34,10 @@
 PhysicsEngine::PhysicsEngine(const glm::vec3& offset) :
         _originOffset(offset),
         _myAvatarController(nullptr) {
+    static const char* PHYSICS_THREADS_ENV = "OVERTE_PHYSICS_THREADS";
+    if (qEnvironmentVariableIsSet(PHYSICS_THREADS_ENV)) {
+        setNumSimulationThreads(qEnvironmentVariableIntValue(PHYSICS_THREADS_ENV));
+    }
 }
 
 PhysicsEngine::~PhysicsEngine() {
@@ -44,13 +50,36 @@ PhysicsEngine::~PhysicsEngine() {
     delete _ghostPairCallback;
 }
 
+void PhysicsEngine::setNumSimulationThreads(int numThreads) {
+    assert(!_dynamicsWorld);
+    _numSimulationThreads = std::max(1, numThreads);
+}
+
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
+        // the task scheduler must be in place before the multithreaded dispatcher is created
+        bool multithreaded = false;
+        if (_numSimulationThreads > 1) {
+            multithreaded = ThreadSafeDynamicsWorld::setNumTaskSchedulerThreads(_numSimulationThreads);
+            if (multithreaded) {
+                qCDebug(physics) << "PhysicsEngine stepping on" << _numSimulationThreads << "threads";
+            } else {
+                qCWarning(physics) << "Bullet was built without multithreading support, stepping physics on one thread";
+                _numSimulationThreads = 1;
+            }
+        }
+
         _collisionConfig = new btDefaultCollisionConfiguration();
-        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
+        if (multithreaded) {
+            _collisionDispatcher = new btCollisionDispatcherMt(_collisionConfig);
+            _constraintSolver = new btSequentialImpulseConstraintSolverMt();
+        } else {
+            _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
+            _constraintSolver = new btSequentialImpulseConstraintSolver;
+        }
         _broadphaseFilter = new btDbvtBroadphase();
-        _constraintSolver = new btSequentialImpulseConstraintSolver;
         _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
+        _dynamicsWorld->setMultithreaded(multithreaded);
         _physicsDebugDraw.reset(new PhysicsDebugDraw());
 
         // hook up debug draw renderer
@@ -478,6 +507,8 @@ void PhysicsEngine::updateContactMap() {
     BT_PROFILE("updateContactMap");
     ++_numContactFrames;
 
+    // This runs between substeps, after any worker threads have joined. With the multithreaded dispatcher the
+    // manifolds come in no particular order, which is fine: the map is keyed by object pair and bump() only raises.
     // update all contacts every frame
     int numManifolds = _collisionDispatcher->getNumManifolds();
     for (int i = 0; i < numManifolds; ++i) {
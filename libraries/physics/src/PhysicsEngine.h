@@ -94,6 +94,13 @@ public:
 
     PhysicsEngine(const glm::vec3& offset);
     ~PhysicsEngine();
+
+    // With more than one simulation thread the collision dispatch, the constraint solver and the integration of
+    // the bodies run on Bullet's task scheduler. Defaults to the OVERTE_PHYSICS_THREADS environment variable, or one
+    // thread, and must be set before init().
+    void setNumSimulationThreads(int numThreads);
+    int getNumSimulationThreads() const { return _numSimulationThreads; }
+
     void init();
 
     uint32_t getNumSubsteps() const;
@@ -189,6 +196,7 @@ private:
     CharacterController* _myAvatarController;
 
     uint32_t _numContactFrames { 0 };
+    int _numSimulationThreads { 1 };
 
     bool _dumpNextStats { false };
     bool _saveNextStats { false };
@@ -18,6 +18,7 @@
 #include "ThreadSafeDynamicsWorld.h"
 
 #include <LinearMath/btQuickprof.h>
+#include <LinearMath/btThreads.h>
 
 #include "Profile.h"
 
@@ -92,6 +93,76 @@ int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep
     return subSteps;
 }
 
+// bodies per task of the task scheduler, as in btDiscreteDynamicsWorldMt
+static const int PARALLEL_FOR_GRAIN_SIZE = 50;
+
+bool ThreadSafeDynamicsWorld::setNumTaskSchedulerThreads(int numThreads) {
+    // null when Bullet was built without BT_THREADSAFE
+    static btITaskScheduler* taskScheduler = btCreateDefaultTaskScheduler();
+    if (!taskScheduler) {
+        return false;
+    }
+    taskScheduler->setNumThreads(numThreads);
+    btSetTaskScheduler(taskScheduler);
+    return true;
+}
+
+void ThreadSafeDynamicsWorld::predictUnconstraintMotion(btScalar timeStep) {
+    if (!_isMultithreaded) {
+        btDiscreteDynamicsWorld::predictUnconstraintMotion(timeStep);
+        return;
+    }
+    BT_PROFILE("predictUnconstraintMotion");
+    if (m_nonStaticRigidBodies.size() == 0) {
+        return;
+    }
+
+    struct Predictor : public btIParallelForBody {
+        btRigidBody** bodies;
+        btScalar timeStep;
+
+        void forLoop(int begin, int end) const override {
+            for (int i = begin; i < end; ++i) {
+                btRigidBody* body = bodies[i];
+                if (!body->isStaticOrKinematicObject()) {
+                    // velocities are integrated in the constraint solver, not here
+                    body->applyDamping(timeStep);
+                    body->predictIntegratedTransform(timeStep, body->getInterpolationWorldTransform());
+                }
+            }
+        }
+    } predictor;
+    predictor.bodies = &m_nonStaticRigidBodies[0];
+    predictor.timeStep = timeStep;
+    btParallelFor(0, m_nonStaticRigidBodies.size(), PARALLEL_FOR_GRAIN_SIZE, predictor);
+}
+
+void ThreadSafeDynamicsWorld::integrateTransforms(btScalar timeStep) {
+    // speculative contact restitution walks the predictive manifolds after integrating, which only the serial version does
+    if (!_isMultithreaded || m_applySpeculativeContactRestitution) {
+        btDiscreteDynamicsWorld::integrateTransforms(timeStep);
+        return;
+    }
+    BT_PROFILE("integrateTransforms");
+    if (m_nonStaticRigidBodies.size() == 0) {
+        return;
+    }
+
+    struct Integrator : public btIParallelForBody {
+        ThreadSafeDynamicsWorld* world;
+        btRigidBody** bodies;
+        btScalar timeStep;
+
+        void forLoop(int begin, int end) const override {
+            world->integrateTransformsInternal(&bodies[begin], end - begin, timeStep);
+        }
+    } integrator;
+    integrator.world = this;
+    integrator.bodies = &m_nonStaticRigidBodies[0];
+    integrator.timeStep = timeStep;
+    btParallelFor(0, m_nonStaticRigidBodies.size(), PARALLEL_FOR_GRAIN_SIZE, integrator);
+}
+
 // call this instead of non-virtual btDiscreteDynamicsWorld::synchronizeSingleMotionState()
 void ThreadSafeDynamicsWorld::synchronizeMotionState(btRigidBody* body) {
     btAssert(body);
@@ -55,6 +55,20 @@ public:
     void addChangedMotionState(ObjectMotionState* motionState) { _changedMotionStates.push_back(motionState); }
     virtual void debugDrawObject(const btTransform& worldTransform, const btCollisionShape* shape, const btVector3& color) override;
 
+    // Sets the number of threads of Bullet's task scheduler, which is shared by every world in the process.
+    // Returns false when Bullet was built without BT_THREADSAFE and can only step on the calling thread.
+    static bool setNumTaskSchedulerThreads(int numThreads);
+
+    // When multithreaded, the motion prediction and transform integration of the bodies are spread over the task
+    // scheduler's threads, as btDiscreteDynamicsWorldMt does. Use btCollisionDispatcherMt and
+    // btSequentialImpulseConstraintSolverMt with it to also run the narrowphase and the solver in parallel.
+    void setMultithreaded(bool multithreaded) { _isMultithreaded = multithreaded; }
+    bool isMultithreaded() const { return _isMultithreaded; }
+
+protected:
+    virtual void predictUnconstraintMotion(btScalar timeStep) override;
+    virtual void integrateTransforms(btScalar timeStep) override;
+
 private:
     // call this instead of non-virtual btDiscreteDynamicsWorld::synchronizeSingleMotionState()
     void synchronizeMotionState(btRigidBody* body);
@@ -66,6 +80,7 @@ private:
     SetOfMotionStates _activeStates;
     SetOfMotionStates _lastActiveStates;
     int _numSubsteps { 0 };
+    bool _isMultithreaded { false };
 };
 
 #endif // hifi_ThreadSafeDynamicsWorld_h
@@ -1144,6 +1144,14 @@ bool NetworkMaterial::isMissingTexture() {
     return false;
 }
 
+void NetworkMaterial::requestScreenSize(float pixels) {
+    for (auto& networkTexture : _textures) {
+        if (networkTexture.second.texture) {
+            networkTexture.second.texture->requestScreenSize(pixels);
+        }
+    }
+}
+
 bool NetworkMaterial::checkResetOpacityMap() {
     // If material textures are loaded, check the material translucency
     // FIXME: This should not be done here.  The opacity map should already be reset in Material::setTextureMap.
@@ -40,6 +40,9 @@ public:
     virtual bool isMissingTexture();
     virtual bool checkResetOpacityMap();
 
+    // Passes the size in pixels the material is drawn at on to its textures, see NetworkTexture::requestScreenSize()
+    virtual void requestScreenSize(float pixels);
+
     class Texture {
     public:
         QString name;
@@ -146,6 +146,14 @@ bool ReferenceMaterial::checkResetOpacityMap() {
     });
 }
 
+void ReferenceMaterial::requestScreenSize(float pixels) {
+    withLock([&] {
+        if (auto material = getNetworkMaterial()) {
+            material->requestScreenSize(pixels);
+        }
+    });
+}
+
 // ProceduralMaterial
 bool ReferenceMaterial::isProcedural() const {
     return resultWithLock<bool>([&] {
@@ -39,6 +39,7 @@ public:
     // NetworkMaterial
     bool isMissingTexture() override;
     bool checkResetOpacityMap() override;
+    void requestScreenSize(float pixels) override;
 
     // ProceduralMaterial
     bool isProcedural() const override;
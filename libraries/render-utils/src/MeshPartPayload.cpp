@@ -351,6 +351,10 @@ void ModelMeshPartPayload::render(RenderArgs* args) {
         return;
     }
 
+    if (args->_renderMode == RenderArgs::RenderMode::DEFAULT_RENDER_MODE && args->_mirrorDepth == 0) {
+        requestTextureScreenSize(args);
+    }
+
     gpu::Batch& batch = *(args->_batch);
 
     Transform transform = _parentTransform;
@@ -404,6 +408,26 @@ void ModelMeshPartPayload::render(RenderArgs* args) {
     args->_details._trianglesRendered += _drawPart._numIndices / INDICES_PER_TRIANGLE;
 }
 
+void ModelMeshPartPayload::requestTextureScreenSize(RenderArgs* args) {
+    // With mip streaming, textures only load the finer mips they are asked for, so pass on the projected size of the part.
+    // Requests only ever make textures sharper, so this only needs to be done when the part gets bigger on screen.
+    const ViewFrustum& viewFrustum = args->getViewFrustum();
+    AABox bound = getBound(args);
+    float distance = std::max(viewFrustum.distanceToCamera(bound.calcCenter()), viewFrustum.getNearClip());
+    float viewHeight = 2.0f * distance * tanf(0.5f * glm::radians(viewFrustum.getFieldOfView()));
+    float pixels = (float)args->_viewport.w * glm::length(bound.getDimensions()) / viewHeight;
+
+    const float TEXTURE_SCREEN_SIZE_REQUEST_STEP = 1.25f;
+    if (pixels > _requestedTextureScreenSize * TEXTURE_SCREEN_SIZE_REQUEST_STEP) {
+        _requestedTextureScreenSize = pixels;
+        _drawMaterials.forEachLayer([pixels](const graphics::MaterialLayer& layer) {
+            if (auto material = std::dynamic_pointer_cast<NetworkMaterial>(layer.material)) {
+                material->requestScreenSize(pixels);
+            }
+        });
+    }
+}
+
 bool ModelMeshPartPayload::passesZoneOcclusionTest(const std::unordered_set<QUuid>& containingZones) const {
     if (!_renderWithZones.isEmpty()) {
         if (!containingZones.empty()) {
@@ -66,7 +66,7 @@ public:
     render::ItemID computeMirrorView(ViewFrustum& viewFrustum) const;
     render::HighlightStyle getOutlineStyle(const ViewFrustum& viewFrustum, const size_t height) const;
 
-    void addMaterial(graphics::MaterialLayer material) { _drawMaterials.push(material); }
+    void addMaterial(graphics::MaterialLayer material) { _drawMaterials.push(material); _requestedTextureScreenSize = 0.0f; }
     void removeMaterial(graphics::MaterialPointer material) { _drawMaterials.remove(material); }
 
     void setBlendshapeBuffer(const std::unordered_map<int, gpu::BufferPointer>& blendshapeBuffers, const QVector<int>& blendedMeshSizes);
@@ -76,6 +76,7 @@ protected:
 
 private:
     void initCache(const ModelPointer& model, int shapeID);
+    void requestTextureScreenSize(RenderArgs* args);
 
     int _meshIndex;
     std::shared_ptr<const graphics::Mesh> _drawMesh;
@@ -108,6 +109,7 @@ private:
     Transform _parentTransform;
     graphics::Box _localBound;
     graphics::Box _adjustedLocalBound;
+    float _requestedTextureScreenSize { 0.0f };
 };
 
 namespace render {
@@ -18,10 +18,39 @@
 
 #include <QDebug>
 
+#include "ScriptBindings.h"
 #include "ScriptEngineLogging.h"
 #include "ScriptEngine.h"
 #include "ScriptManager.h"
 
+STATIC_SCRIPT_TYPES_INITIALIZER((+[](ScriptManager* manager) {
+    SCRIPT_BINDING(Quat, multiply);
+    SCRIPT_BINDING(Quat, normalize);
+    SCRIPT_BINDING(Quat, conjugate);
+    SCRIPT_BINDING(Quat, lookAt);
+    SCRIPT_BINDING(Quat, lookAtSimple);
+    SCRIPT_BINDING(Quat, rotationBetween);
+    SCRIPT_BINDING(Quat, fromVec3Degrees);
+    SCRIPT_BINDING(Quat, fromVec3Radians);
+    SCRIPT_BINDING(Quat, fromPitchYawRollDegrees);
+    SCRIPT_BINDING(Quat, fromPitchYawRollRadians);
+    SCRIPT_BINDING(Quat, inverse);
+    SCRIPT_BINDING(Quat, getForward);
+    SCRIPT_BINDING(Quat, getRight);
+    SCRIPT_BINDING(Quat, getUp);
+    SCRIPT_BINDING(Quat, safeEulerAngles);
+    SCRIPT_BINDING(Quat, angleAxis);
+    SCRIPT_BINDING(Quat, axis);
+    SCRIPT_BINDING(Quat, angle);
+    SCRIPT_BINDING(Quat, mix);
+    SCRIPT_BINDING(Quat, slerp);
+    SCRIPT_BINDING(Quat, squad);
+    SCRIPT_BINDING(Quat, dot);
+    SCRIPT_BINDING(Quat, equal);
+    SCRIPT_BINDING(Quat, cancelOutRollAndPitch);
+    SCRIPT_BINDING(Quat, cancelOutRoll);
+}));
+
 quat Quat::normalize(const glm::quat& q) {
     return glm::normalize(q);
 }
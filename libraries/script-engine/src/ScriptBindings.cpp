@@ -0,0 +1,62 @@
+//
+//  ScriptBindings.cpp
+//  libraries/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ScriptBindings.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QMetaObject>
+#include <QtCore/QReadWriteLock>
+
+namespace {
+    struct BindingKey {
+        const QMetaObject* metaObject;
+        QByteArray methodName;
+        int numArguments;
+
+        bool operator==(const BindingKey& other) const {
+            return metaObject == other.metaObject && numArguments == other.numArguments && methodName == other.methodName;
+        }
+    };
+
+    uint qHash(const BindingKey& key, uint seed = 0) {
+        return ::qHash(key.methodName, seed) ^ ::qHash(key.metaObject, seed) ^ (uint)key.numArguments;
+    }
+
+    struct BindingRegistry {
+        QReadWriteLock lock;
+        QHash<BindingKey, ScriptBindingInvoker> bindings;
+    };
+
+    BindingRegistry& getRegistry() {
+        static BindingRegistry registry;
+        return registry;
+    }
+}
+
+void ScriptBindings::registerBinding(const QMetaObject* metaObject, const char* methodName, int numArguments,
+                                     ScriptBindingInvoker invoker) {
+    auto& registry = getRegistry();
+    QWriteLocker locker(&registry.lock);
+    registry.bindings.insert({ metaObject, QByteArray(methodName), numArguments }, invoker);
+}
+
+ScriptBindingInvoker ScriptBindings::findBinding(const QMetaObject* metaObject, const QByteArray& methodName,
+                                                 int numArguments) {
+    auto& registry = getRegistry();
+    QReadLocker locker(&registry.lock);
+    for (; metaObject; metaObject = metaObject->superClass()) {
+        auto binding = registry.bindings.value({ metaObject, methodName, numArguments }, nullptr);
+        if (binding) {
+            return binding;
+        }
+    }
+    return nullptr;
+}
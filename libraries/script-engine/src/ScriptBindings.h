@@ -0,0 +1,236 @@
+//
+//  ScriptBindings.h
+//  libraries/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+/// @addtogroup ScriptEngine
+/// @{
+
+#ifndef hifi_ScriptBindings_h
+#define hifi_ScriptBindings_h
+
+#include <cfloat>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QMetaType>
+#include <QtCore/QString>
+#include <QtCore/QUuid>
+#include <QtCore/QVariant>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "ScriptValue.h"
+
+class QMetaObject;
+class QObject;
+
+/**
+ * @brief The arguments and return value of one call from a script into a native method, as seen by a script binding.
+ *
+ * Implemented by each script engine. The typed getters only succeed when the script value already is of that type, in the
+ * shape scripts usually pass it (a number, a string, a plain {x, y, z} object, ...), so that they can skip the generic
+ * conversion. Anything else goes through getVariant, which converts exactly like the generic method dispatch does.
+ */
+class ScriptBindingCall {
+public:
+    virtual ~ScriptBindingCall() {}
+
+    virtual int getArgumentCount() const = 0;
+
+    virtual bool getNumber(int index, double& value) = 0;
+    virtual bool getInt(int index, int& value) = 0;
+    virtual bool getBool(int index, bool& value) = 0;
+    virtual bool getString(int index, QString& value) = 0;
+    virtual bool getVec3(int index, glm::vec3& value) = 0;
+    virtual bool getQuat(int index, glm::quat& value) = 0; // not normalized
+    virtual bool getVariant(int index, int typeId, QVariant& value) = 0;
+    virtual ScriptValue getScriptValue(int index) = 0;
+
+    virtual void setReturnNumber(double value) = 0;
+    virtual void setReturnBool(bool value) = 0;
+    virtual void setReturnString(const QString& value) = 0;
+    virtual void setReturnVec3(const glm::vec3& value) = 0;
+    virtual void setReturnQuat(const glm::quat& value) = 0;
+    virtual void setReturnVariant(const QVariant& value) = 0;
+    virtual void setReturnScriptValue(const ScriptValue& value) = 0;
+};
+
+/// Calls a native method with the arguments of a script call. Returns false, before calling it, if the arguments can't be
+/// converted, in which case the call is left to the generic method dispatch.
+using ScriptBindingInvoker = bool (*)(QObject* object, ScriptBindingCall& call);
+
+/**
+ * @brief Typed bindings for the native methods scripts call the most.
+ *
+ * A binding is generated at compile time from the method's signature, converts each argument straight to its C++ type
+ * and calls the method directly, instead of going through QVariant and QMetaMethod::invoke. Bindings are looked up by
+ * class, method name and number of arguments when an object is first wrapped for a script engine; methods without one
+ * keep using the generic dispatch. Register them with SCRIPT_BINDING, or with SCRIPT_BINDING_OVERLOAD for overloaded
+ * methods, e.g. from a STATIC_SCRIPT_TYPES_INITIALIZER.
+ */
+namespace ScriptBindings {
+    void registerBinding(const QMetaObject* metaObject, const char* methodName, int numArguments, ScriptBindingInvoker invoker);
+
+    // Searches the class and its super classes
+    ScriptBindingInvoker findBinding(const QMetaObject* metaObject, const QByteArray& methodName, int numArguments);
+
+    template <typename T, typename = void>
+    struct Argument {
+        static bool get(ScriptBindingCall& call, int index, T& value) {
+            QVariant variant;
+            if (!call.getVariant(index, qMetaTypeId<T>(), variant)) {
+                return false;
+            }
+            value = variant.value<T>();
+            return true;
+        }
+        static void setReturn(ScriptBindingCall& call, const T& value) { call.setReturnVariant(QVariant::fromValue(value)); }
+    };
+
+    // the primary template, which converts through QVariant, for the typed conversions to fall back on
+    template <typename T>
+    using GenericArgument = Argument<T, bool>;
+
+    template <typename T>
+    struct Argument<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+        static bool get(ScriptBindingCall& call, int index, T& value) {
+            double number;
+            if (call.getNumber(index, number)) {
+                value = (T)number;
+                return true;
+            }
+            return GenericArgument<T>::get(call, index, value);
+        }
+        static void setReturn(ScriptBindingCall& call, T value) { call.setReturnNumber((double)value); }
+    };
+
+    template <>
+    struct Argument<int> {
+        static bool get(ScriptBindingCall& call, int index, int& value) {
+            return call.getInt(index, value) || GenericArgument<int>::get(call, index, value);
+        }
+        static void setReturn(ScriptBindingCall& call, int value) { call.setReturnNumber((double)value); }
+    };
+
+    template <>
+    struct Argument<bool> {
+        static bool get(ScriptBindingCall& call, int index, bool& value) {
+            return call.getBool(index, value) || GenericArgument<bool>::get(call, index, value);
+        }
+        static void setReturn(ScriptBindingCall& call, bool value) { call.setReturnBool(value); }
+    };
+
+    template <>
+    struct Argument<QString> {
+        static bool get(ScriptBindingCall& call, int index, QString& value) {
+            return call.getString(index, value) || GenericArgument<QString>::get(call, index, value);
+        }
+        static void setReturn(ScriptBindingCall& call, const QString& value) { call.setReturnString(value); }
+    };
+
+    template <>
+    struct Argument<QUuid> {
+        static bool get(ScriptBindingCall& call, int index, QUuid& value) {
+            QString string;
+            if (call.getString(index, string)) {
+                value = QUuid(string);
+                return true;
+            }
+            return GenericArgument<QUuid>::get(call, index, value);
+        }
+        static void setReturn(ScriptBindingCall& call, const QUuid& value) { call.setReturnVariant(value); }
+    };
+
+    template <>
+    struct Argument<glm::vec3> {
+        static bool get(ScriptBindingCall& call, int index, glm::vec3& value) {
+            return call.getVec3(index, value) || GenericArgument<glm::vec3>::get(call, index, value);
+        }
+        static void setReturn(ScriptBindingCall& call, const glm::vec3& value) { call.setReturnVec3(value); }
+    };
+
+    template <>
+    struct Argument<glm::quat> {
+        static bool get(ScriptBindingCall& call, int index, glm::quat& value) {
+            if (!call.getQuat(index, value)) {
+                return GenericArgument<glm::quat>::get(call, index, value);
+            }
+            // as quatFromScriptValue does
+            float length = glm::length(value);
+            value = length > FLT_EPSILON ? value / length : glm::quat();
+            return true;
+        }
+        static void setReturn(ScriptBindingCall& call, const glm::quat& value) { call.setReturnQuat(value); }
+    };
+
+    template <>
+    struct Argument<ScriptValue> {
+        static bool get(ScriptBindingCall& call, int index, ScriptValue& value) {
+            value = call.getScriptValue(index);
+            return true;
+        }
+        static void setReturn(ScriptBindingCall& call, const ScriptValue& value) { call.setReturnScriptValue(value); }
+    };
+
+    template <typename Method>
+    struct MethodTraits;
+
+    template <typename C, typename R, typename... A>
+    struct MethodTraits<R (C::*)(A...)> {
+        using Class = C;
+        using Return = std::decay_t<R>;
+        using Arguments = std::tuple<std::decay_t<A>...>;
+    };
+
+    template <typename C, typename R, typename... A>
+    struct MethodTraits<R (C::*)(A...) const> : MethodTraits<R (C::*)(A...)> {};
+
+    template <auto Method, size_t... I>
+    bool invoke(QObject* object, ScriptBindingCall& call, std::index_sequence<I...>) {
+        using Traits = MethodTraits<decltype(Method)>;
+        typename Traits::Arguments arguments;
+        if (!(Argument<std::tuple_element_t<I, typename Traits::Arguments>>::get(call, (int)I, std::get<I>(arguments)) && ...)) {
+            return false;
+        }
+
+        auto target = static_cast<typename Traits::Class*>(object);
+        if constexpr (std::is_void_v<typename Traits::Return>) {
+            (target->*Method)(std::get<I>(arguments)...);
+        } else {
+            Argument<typename Traits::Return>::setReturn(call, (target->*Method)(std::get<I>(arguments)...));
+        }
+        return true;
+    }
+
+    template <auto Method>
+    bool invoke(QObject* object, ScriptBindingCall& call) {
+        using Arguments = typename MethodTraits<decltype(Method)>::Arguments;
+        return invoke<Method>(object, call, std::make_index_sequence<std::tuple_size_v<Arguments>>());
+    }
+
+    template <auto Method>
+    void registerMethod(const char* methodName) {
+        using Traits = MethodTraits<decltype(Method)>;
+        registerBinding(&Traits::Class::staticMetaObject, methodName,
+                        (int)std::tuple_size_v<typename Traits::Arguments>, &invoke<Method>);
+    }
+}
+
+#define SCRIPT_BINDING(Class, method) ScriptBindings::registerMethod<&Class::method>(#method)
+
+#define SCRIPT_BINDING_OVERLOAD(Class, method, Signature) \
+    ScriptBindings::registerMethod<static_cast<Signature>(&Class::method)>(#method)
+
+#endif // hifi_ScriptBindings_h
+
+/// @}
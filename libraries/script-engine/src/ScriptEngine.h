@@ -22,6 +22,7 @@
 
 #include <QtCore/QFlags>
 #include <QtCore/QObject>
+#include <QtCore/QVector>
 
 #include "ScriptValue.h"
 #include "ScriptException.h"
@@ -328,6 +329,7 @@ public:
 
     virtual ScriptValue newArray(uint length = 0) = 0;
     virtual ScriptValue newArrayBuffer(const QByteArray& message) = 0;
+    virtual ScriptValue newFloat32Array(const QVector<float>& values) = 0;
     virtual ScriptValue newFunction(FunctionSignature fun, int length = 0) {
         Q_ASSERT(false);
         return ScriptValue();
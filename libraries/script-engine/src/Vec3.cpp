@@ -21,10 +21,33 @@
 #include <glm/gtx/string_cast.hpp>
 
 #include "NumericalConstants.h"
+#include "ScriptBindings.h"
 #include "ScriptEngine.h"
 #include "ScriptEngineLogging.h"
 #include "ScriptManager.h"
 
+// the overloads of multiply take the same number of arguments, so they keep using the generic dispatch
+STATIC_SCRIPT_TYPES_INITIALIZER((+[](ScriptManager* manager) {
+    SCRIPT_BINDING(Vec3, reflect);
+    SCRIPT_BINDING(Vec3, cross);
+    SCRIPT_BINDING(Vec3, dot);
+    SCRIPT_BINDING(Vec3, multiplyVbyV);
+    SCRIPT_BINDING(Vec3, multiplyQbyV);
+    SCRIPT_BINDING(Vec3, sum);
+    SCRIPT_BINDING(Vec3, subtract);
+    SCRIPT_BINDING(Vec3, length);
+    SCRIPT_BINDING(Vec3, distance);
+    SCRIPT_BINDING(Vec3, orientedAngle);
+    SCRIPT_BINDING(Vec3, normalize);
+    SCRIPT_BINDING(Vec3, mix);
+    SCRIPT_BINDING(Vec3, equal);
+    SCRIPT_BINDING(Vec3, withinEpsilon);
+    SCRIPT_BINDING(Vec3, toPolar);
+    SCRIPT_BINDING_OVERLOAD(Vec3, fromPolar, glm::vec3 (Vec3::*)(const glm::vec3&));
+    SCRIPT_BINDING_OVERLOAD(Vec3, fromPolar, glm::vec3 (Vec3::*)(float, float));
+    SCRIPT_BINDING(Vec3, getAngle);
+}));
+
 Vec3::~Vec3() {
     qCDebug(scriptengine) << "ScriptMethodV8Proxy destroyed";
     printf("ScriptMethodV8Proxy destroyed");
@@ -0,0 +1,140 @@
+//
+//  ScriptBindingCallV8.cpp
+//  libraries/script-engine/src/v8
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ScriptBindingCallV8.h"
+
+#include "../ScriptValueUtils.h"
+#include "FastScriptValueUtils.h"
+#include "ScriptValueV8Wrapper.h"
+
+ScriptBindingCallV8::ScriptBindingCallV8(ScriptEngineV8* engine, const v8::FunctionCallbackInfo<v8::Value>& arguments,
+                                         int numArguments) :
+    _engine(engine),
+    _isolate(engine->getIsolate()),
+    _context(engine->getContext()),
+    _arguments(arguments),
+    _numArguments(numArguments)
+{
+}
+
+bool ScriptBindingCallV8::getNumber(int index, double& value) {
+    v8::Local<v8::Value> argument = _arguments[index];
+    if (!argument->IsNumber()) {
+        return false;
+    }
+    value = argument.As<v8::Number>()->Value();
+    return true;
+}
+
+bool ScriptBindingCallV8::getInt(int index, int& value) {
+    v8::Local<v8::Value> argument = _arguments[index];
+    if (!argument->IsInt32()) {
+        return false;
+    }
+    value = argument.As<v8::Int32>()->Value();
+    return true;
+}
+
+bool ScriptBindingCallV8::getBool(int index, bool& value) {
+    v8::Local<v8::Value> argument = _arguments[index];
+    if (!argument->IsBoolean()) {
+        return false;
+    }
+    value = argument.As<v8::Boolean>()->Value();
+    return true;
+}
+
+bool ScriptBindingCallV8::getString(int index, QString& value) {
+    v8::Local<v8::Value> argument = _arguments[index];
+    if (!argument->IsString()) {
+        return false;
+    }
+    v8::String::Utf8Value string(_isolate, argument);
+    value = QString::fromUtf8(*string, string.length());
+    return true;
+}
+
+bool ScriptBindingCallV8::getNumberProperty(v8::Local<v8::Object> object, const char* name, double& value) {
+    v8::Local<v8::String> key = v8::String::NewFromUtf8(_isolate, name, v8::NewStringType::kInternalized).ToLocalChecked();
+    v8::Local<v8::Value> property;
+    if (!object->Get(_context, key).ToLocal(&property) || !property->IsNumber()) {
+        return false;
+    }
+    value = property.As<v8::Number>()->Value();
+    return true;
+}
+
+bool ScriptBindingCallV8::getVec3(int index, glm::vec3& value) {
+    v8::Local<v8::Value> argument = _arguments[index];
+    if (!argument->IsObject() || argument->IsArray()) {
+        return false;
+    }
+    auto object = argument.As<v8::Object>();
+    double x, y, z;
+    if (!getNumberProperty(object, "x", x) || !getNumberProperty(object, "y", y) || !getNumberProperty(object, "z", z)) {
+        return false;
+    }
+    value = glm::vec3(x, y, z);
+    return true;
+}
+
+bool ScriptBindingCallV8::getQuat(int index, glm::quat& value) {
+    v8::Local<v8::Value> argument = _arguments[index];
+    if (!argument->IsObject() || argument->IsArray()) {
+        return false;
+    }
+    auto object = argument.As<v8::Object>();
+    double x, y, z, w;
+    if (!getNumberProperty(object, "x", x) || !getNumberProperty(object, "y", y) || !getNumberProperty(object, "z", z) ||
+        !getNumberProperty(object, "w", w)) {
+        return false;
+    }
+    value = glm::quat((float)w, (float)x, (float)y, (float)z);
+    return true;
+}
+
+bool ScriptBindingCallV8::getVariant(int index, int typeId, QVariant& value) {
+    return _engine->castValueToVariant(V8ScriptValue(_engine, _arguments[index]), value, typeId);
+}
+
+ScriptValue ScriptBindingCallV8::getScriptValue(int index) {
+    return ScriptValue(new ScriptValueV8Wrapper(_engine, V8ScriptValue(_engine, _arguments[index])));
+}
+
+void ScriptBindingCallV8::setReturnNumber(double value) {
+    _arguments.GetReturnValue().Set(value);
+}
+
+void ScriptBindingCallV8::setReturnBool(bool value) {
+    _arguments.GetReturnValue().Set(value);
+}
+
+void ScriptBindingCallV8::setReturnString(const QString& value) {
+    QByteArray utf8 = value.toUtf8();
+    _arguments.GetReturnValue().Set(
+        v8::String::NewFromUtf8(_isolate, utf8.constData(), v8::NewStringType::kNormal, utf8.size()).ToLocalChecked());
+}
+
+void ScriptBindingCallV8::setReturnVec3(const glm::vec3& value) {
+    setReturnScriptValue(vec3ToScriptValue(_engine, value));
+}
+
+void ScriptBindingCallV8::setReturnQuat(const glm::quat& value) {
+    setReturnScriptValue(quatToScriptValue(_engine, value));
+}
+
+void ScriptBindingCallV8::setReturnVariant(const QVariant& value) {
+    _arguments.GetReturnValue().Set(_engine->castVariantToValue(value).get());
+}
+
+void ScriptBindingCallV8::setReturnScriptValue(const ScriptValue& value) {
+    _arguments.GetReturnValue().Set(ScriptValueV8Wrapper::fullUnwrap(_engine, value).get());
+}
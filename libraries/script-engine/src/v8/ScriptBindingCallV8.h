@@ -0,0 +1,58 @@
+//
+//  ScriptBindingCallV8.h
+//  libraries/script-engine/src/v8
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+/// @addtogroup ScriptEngine
+/// @{
+
+#ifndef hifi_ScriptBindingCallV8_h
+#define hifi_ScriptBindingCallV8_h
+
+#include "../ScriptBindings.h"
+#include "ScriptEngineV8.h"
+#include "V8Types.h"
+
+/// [V8] The arguments and return value of a V8 function callback, for typed script bindings
+class ScriptBindingCallV8 final : public ScriptBindingCall {
+public:
+    ScriptBindingCallV8(ScriptEngineV8* engine, const v8::FunctionCallbackInfo<v8::Value>& arguments, int numArguments);
+
+    int getArgumentCount() const override { return _numArguments; }
+
+    bool getNumber(int index, double& value) override;
+    bool getInt(int index, int& value) override;
+    bool getBool(int index, bool& value) override;
+    bool getString(int index, QString& value) override;
+    bool getVec3(int index, glm::vec3& value) override;
+    bool getQuat(int index, glm::quat& value) override;
+    bool getVariant(int index, int typeId, QVariant& value) override;
+    ScriptValue getScriptValue(int index) override;
+
+    void setReturnNumber(double value) override;
+    void setReturnBool(bool value) override;
+    void setReturnString(const QString& value) override;
+    void setReturnVec3(const glm::vec3& value) override;
+    void setReturnQuat(const glm::quat& value) override;
+    void setReturnVariant(const QVariant& value) override;
+    void setReturnScriptValue(const ScriptValue& value) override;
+
+private:
+    bool getNumberProperty(v8::Local<v8::Object> object, const char* name, double& value);
+
+    ScriptEngineV8* _engine;
+    v8::Isolate* _isolate;
+    v8::Local<v8::Context> _context;
+    const v8::FunctionCallbackInfo<v8::Value>& _arguments;
+    const int _numArguments;
+};
+
+#endif // hifi_ScriptBindingCallV8_h
+
+/// @}
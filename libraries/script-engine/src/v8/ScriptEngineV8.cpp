@@ -1103,6 +1103,18 @@ ScriptValue ScriptEngineV8::newArrayBuffer(const QByteArray& message) {
     return ScriptValue(new ScriptValueV8Wrapper(this, std::move(result)));
 }
 
+ScriptValue ScriptEngineV8::newFloat32Array(const QVector<float>& values) {
+    Q_ASSERT(_v8Isolate->IsCurrent());
+    v8::HandleScope handleScope(_v8Isolate);
+    v8::Context::Scope contextScope(getContext());
+    size_t byteLength = (size_t)values.size() * sizeof(float);
+    std::shared_ptr<v8::BackingStore> backingStore(v8::ArrayBuffer::NewBackingStore(_v8Isolate, byteLength));
+    std::memcpy(backingStore.get()->Data(), values.constData(), byteLength);
+    auto arrayBuffer = v8::ArrayBuffer::New(_v8Isolate, backingStore);
+    V8ScriptValue result(this, v8::Float32Array::New(arrayBuffer, 0, values.size()));
+    return ScriptValue(new ScriptValueV8Wrapper(this, std::move(result)));
+}
+
 ScriptValue ScriptEngineV8::newObject() {
     ScriptValue result;
     {
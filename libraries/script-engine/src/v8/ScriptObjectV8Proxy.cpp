@@ -20,6 +20,7 @@
 
 #include "../ScriptEngineLogging.h"
 
+#include "ScriptBindingCallV8.h"
 #include "ScriptContextV8Wrapper.h"
 #include "ScriptValueV8Wrapper.h"
 #include "ScriptEngineLoggingV8.h"
@@ -922,6 +923,25 @@ ScriptMethodV8Proxy::ScriptMethodV8Proxy(ScriptEngineV8* engine, QObject* object
     v8::Context::Scope contextScope(engine->getContext());
     _objectLifetime.Reset(isolate, lifetime.get());
     _objectLifetime.SetWeak(this, weakHandleCallback, v8::WeakCallbackType::kParameter);
+
+    // a typed binding can only stand in for a call that has a single overload to choose from
+    for (int numArgs = 0; numArgs <= numMaxParams; ++numArgs) {
+        int numOverloads = 0;
+        const QMetaMethod* overload = nullptr;
+        for (const auto& meta : _metas) {
+            if (meta.parameterCount() == numArgs) {
+                ++numOverloads;
+                overload = &meta;
+            }
+        }
+        if (numOverloads == 1) {
+            auto binding = ScriptBindings::findBinding(overload->enclosingMetaObject(), overload->name(), numArgs);
+            if (binding) {
+                _bindings.resize(numMaxParams + 1);
+                _bindings[numArgs] = binding;
+            }
+        }
+    }
 }
 
 ScriptMethodV8Proxy::~ScriptMethodV8Proxy() {
@@ -1004,6 +1024,16 @@ void ScriptMethodV8Proxy::call(const v8::FunctionCallbackInfo<v8::Value>& argume
     int scriptNumArgs = arguments.Length();
     int numArgs = std::min(scriptNumArgs, _numMaxParams);
 
+    if (numArgs < _bindings.size() && _bindings[numArgs]) {
+        ScriptContextV8Wrapper ourContext(_engine, &arguments, context, _engine->currentContext()->parentContext());
+        ScriptContextGuard guard(&ourContext);
+        ScriptBindingCallV8 call(_engine, arguments, numArgs);
+        if (_bindings[numArgs](qobject, call)) {
+            return;
+        }
+        // the arguments need the generic conversions and overload resolution below
+    }
+
     const int scriptValueTypeId = qMetaTypeId<ScriptValue>();
 
     int parameterConversionFailureId = 0;
@@ -22,8 +22,10 @@
 #include <QtCore/QList>
 #include <QtCore/QPointer>
 #include <QtCore/QString>
+#include <QtCore/QVector>
 
 #include "ScriptEngineDebugFlags.h"
+#include "../ScriptBindings.h"
 #include "../ScriptEngine.h"
 #include "../Scriptable.h"
 #include "ScriptEngineV8.h"
@@ -227,6 +229,7 @@ private:  // storage
     v8::Persistent<v8::Value> _objectLifetime;
     //V8ScriptValue _objectLifetime;
     const QList<QMetaMethod> _metas;
+    QVector<ScriptBindingInvoker> _bindings; // typed bindings by number of arguments, see ScriptBindings.h
 
     Q_DISABLE_COPY(ScriptMethodV8Proxy)
 };
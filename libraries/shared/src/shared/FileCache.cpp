@@ -12,10 +12,13 @@
 #include "FileCache.h"
 
 
+#include <algorithm>
 #include <unordered_set>
-#include <queue>
 #include <cassert>
+#include <cmath>
+#include <vector>
 
+#include <QtCore/QDataStream>
 #include <QtCore/QDateTime>
 #include <QtCore/QDir>
 #include <QtCore/QSaveFile>
@@ -39,6 +42,12 @@ using namespace cache;
 
 static const char DIR_SEP = '/';
 static const char EXT_SEP = '.';
+static const char* INDEX_FILENAME = "index";
+static const quint32 INDEX_MAGIC = 0x46434958; // "FCIX"
+static const quint32 INDEX_VERSION = 1;
+// Once over its max size, the cache ejects down to this fraction of it, so that the files written next don't each set off
+// another pass over all the unused files
+static const double EJECTION_TARGET_RATIO = 0.9;
 
 const size_t FileCache::DEFAULT_MAX_SIZE { GB_TO_BYTES(5) };
 const size_t FileCache::MAX_MAX_SIZE { GB_TO_BYTES(100) };
@@ -87,7 +96,7 @@ FileCache::~FileCache() {
 }
 
 void FileCache::initialize() {
-    Lock lock(_mutex);
+    Lock lock(_cleanMutex);
     if (_initialized) {
         qCWarning(file_cache) << "File cache already initialized";
         return;
@@ -96,18 +105,12 @@ void FileCache::initialize() {
     QDir dir(_dirpath.c_str());
 
     if (dir.exists()) {
-        auto nameFilters = QStringList(("*." + _ext).c_str());
-        auto filters = QDir::Filters(QDir::NoDotAndDotDot | QDir::Files);
-        auto sort = QDir::SortFlags(QDir::Time);
-        auto files = dir.entryList(nameFilters, filters, sort);
-
         // load persisted files
-        foreach(QString filename, files) {
-            const Key key = filename.section('.', 0, 0).toStdString();
-            const std::string filepath = dir.filePath(filename).toStdString();
-            const size_t length = QFileInfo(filepath.c_str()).size();
-            addFile(Metadata(key, length), filepath);
+        if (!_usePersistentIndex || !restoreFromIndex()) {
+            restoreFromDirectory();
         }
+        // The index is only good until the cache changes, so it isn't left behind for a session that may not end well
+        QFile::remove(getIndexFilepath().c_str());
 
         qCDebug(file_cache, "[%s] Initialized %s", _dirname.c_str(), _dirpath.c_str());
     } else {
@@ -116,27 +119,175 @@ void FileCache::initialize() {
     }
 
     _initialized = true;
+    lock.unlock();
+
+    clean();
+    emit dirty();
+}
+
+void FileCache::restoreFromDirectory() {
+    QDir dir(_dirpath.c_str());
+    auto nameFilters = QStringList(("*." + _ext).c_str());
+    auto filters = QDir::Filters(QDir::NoDotAndDotDot | QDir::Files);
+    auto files = dir.entryInfoList(nameFilters, filters, QDir::Unsorted);
+
+    for (const auto& fileInfo : files) {
+        const Key key = fileInfo.fileName().section('.', 0, 0).toStdString();
+        restoreFile(Metadata(key, fileInfo.size()), fileInfo.filePath().toStdString(),
+                    fileInfo.lastRead().toMSecsSinceEpoch());
+    }
+}
+
+bool FileCache::restoreFromIndex() {
+    QFile file(getIndexFilepath().c_str());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    quint32 magic, version, count;
+    QByteArray ext;
+    stream >> magic >> version >> ext >> count;
+    if (stream.status() != QDataStream::Ok || magic != INDEX_MAGIC || version != INDEX_VERSION ||
+        ext.toStdString() != _ext) {
+        qCWarning(file_cache, "[%s] Ignoring invalid index", _dirname.c_str());
+        return false;
+    }
+
+    for (quint32 i = 0; i < count; ++i) {
+        QByteArray key;
+        quint64 length;
+        qint64 modified;
+        stream >> key >> length >> modified;
+        if (stream.status() != QDataStream::Ok) {
+            // Start over from the directory, which has everything the index has
+            qCWarning(file_cache, "[%s] Ignoring truncated index", _dirname.c_str());
+            for (auto& shard : _shards) {
+                Set unusedFiles;
+                {
+                    Lock lock(shard.mutex);
+                    unusedFiles.swap(shard.unusedFiles);
+                    shard.files.clear();
+                }
+                for (const auto& unusedFile : unusedFiles) {
+                    unusedFile->_shouldPersist = true;
+                    unusedFile->_parent.reset();
+                }
+            }
+            _numTotalFiles = _numUnusedFiles = _totalFilesSize = _unusedFilesSize = 0;
+            return false;
+        }
+
+        Key fileKey = key.toStdString();
+        std::string filepath = getFilepath(fileKey);
+        restoreFile(Metadata(fileKey, length), filepath, modified);
+    }
+
+    qCDebug(file_cache, "[%s] Restored %u files from the index", _dirname.c_str(), count);
+    return true;
+}
+
+void FileCache::writeIndex() {
+    struct Entry {
+        Key key;
+        size_t length;
+        int64_t modified;
+    };
+    std::vector<Entry> entries;
+    for (auto& shard : _shards) {
+        std::vector<FilePointer> files;
+        {
+            Lock lock(shard.mutex);
+            files.reserve(shard.files.size());
+            for (const auto& weakFile : shard.files) {
+                if (auto file = weakFile.second.lock()) {
+                    files.push_back(file);
+                }
+            }
+        }
+        for (const auto& file : files) {
+            entries.push_back({ file->getKey(), file->getLength(), file->_modified });
+        }
+    }
+
+    QSaveFile file(getIndexFilepath().c_str());
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(file_cache, "[%s] Failed to write index", _dirname.c_str());
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << INDEX_MAGIC << INDEX_VERSION << QByteArray::fromStdString(_ext) << (quint32)entries.size();
+    for (const auto& entry : entries) {
+        stream << QByteArray::fromStdString(entry.key) << (quint64)entry.length << (qint64)entry.modified;
+    }
+    if (stream.status() != QDataStream::Ok || !file.commit()) {
+        qCWarning(file_cache, "[%s] Failed to write index", _dirname.c_str());
+    }
 }
 
 std::unique_ptr<File> FileCache::createFile(Metadata&& metadata, const std::string& filepath) {
     return std::unique_ptr<File>(new cache::File(std::move(metadata), filepath));
 }
 
-FilePointer FileCache::addFile(Metadata&& metadata, const std::string& filepath) {
+FilePointer FileCache::addFile(Metadata&& metadata, const std::string& filepath, bool overwrite) {
     File* rawFile = createFile(std::move(metadata), filepath).release();
     FilePointer file(rawFile, std::bind(&File::deleter, rawFile));
     if (file) {
-        _numTotalFiles += 1;
-        _totalFilesSize += file->getLength();
+        file->_modified = QDateTime::currentMSecsSinceEpoch();
         file->_parent = shared_from_this();
         file->_locked = true;
-        emit dirty();
 
-        _files[file->getKey()] = file;
+        // Declared before the lock, so that it's released after it
+        FilePointer existingFile;
+        auto& shard = getShard(file->getKey());
+        Lock lock(shard.mutex);
+        auto& entry = shard.files[file->getKey()];
+        existingFile = entry.lock();
+        if (existingFile && !overwrite) {
+            // The same file was written concurrently, and is the one already handed out
+            file->_parent.reset();
+            file->_locked = false;
+            file->_shouldPersist = true;
+            file = existingFile;
+        } else {
+            if (existingFile) {
+                // Leave the entry being replaced to its holders, without letting it remove the new file from the disk
+                existingFile->_shouldPersist = true;
+                if (shard.unusedFiles.erase(existingFile)) {
+                    _numUnusedFiles -= 1;
+                    _unusedFilesSize -= existingFile->getLength();
+                }
+                existingFile->_locked = false;
+                _numTotalFiles -= 1;
+                _totalFilesSize -= existingFile->getLength();
+            }
+            entry = file;
+            _numTotalFiles += 1;
+            _totalFilesSize += file->getLength();
+        }
     }
+    emit dirty();
     return file;
 }
 
+void FileCache::restoreFile(Metadata&& metadata, const std::string& filepath, int64_t modified) {
+    File* rawFile = createFile(std::move(metadata), filepath).release();
+    FilePointer file(rawFile, std::bind(&File::deleter, rawFile));
+    file->_modified = modified;
+    file->_isUnchecked = _usePersistentIndex;
+    file->_parent = shared_from_this();
+
+    auto& shard = getShard(file->getKey());
+    Lock lock(shard.mutex);
+    shard.files[file->getKey()] = file;
+    shard.unusedFiles.insert(file);
+    _numTotalFiles += 1;
+    _totalFilesSize += file->getLength();
+    _numUnusedFiles += 1;
+    _unusedFilesSize += file->getLength();
+}
+
 FilePointer FileCache::writeFile(const char* data, File::Metadata&& metadata, bool overwrite) {
     FilePointer file;
 
@@ -145,9 +296,6 @@ FilePointer FileCache::writeFile(const char* data, File::Metadata&& metadata, bo
         return file;
     }
 
-
-    Lock lock(_mutex);
-
     if (!_initialized) {
         qCWarning(file_cache) << "File cache used before initialization";
         return file;
@@ -167,14 +315,29 @@ FilePointer FileCache::writeFile(const char* data, File::Metadata&& metadata, bo
         }
     }
 
+    // Written without any lock held, so that writes don't hold up each other or lookups
+    const Key key = metadata.key;
+    auto& shard = getShard(key);
+    {
+        Lock lock(shard.mutex);
+        ++shard.writes[key];
+    }
+
     QSaveFile saveFile(QString::fromStdString(filepath));
     if (saveFile.open(QIODevice::WriteOnly)
         && saveFile.write(data, metadata.length) == static_cast<qint64>(metadata.length)
         && saveFile.commit()) {
 
-        file = addFile(std::move(metadata), filepath);
+        file = addFile(std::move(metadata), filepath, overwrite);
     } else {
-        qCWarning(file_cache, "[%s] Failed to write %s", _dirname.c_str(), metadata.key.c_str());
+        qCWarning(file_cache, "[%s] Failed to write %s", _dirname.c_str(), key.c_str());
+    }
+
+    {
+        Lock lock(shard.mutex);
+        if (0 == --shard.writes[key]) {
+            shard.writes.erase(key);
+        }
     }
     assert(!file || (file->_locked && file->_parent.lock()));
     return file;
@@ -182,37 +345,68 @@ FilePointer FileCache::writeFile(const char* data, File::Metadata&& metadata, bo
 
 
 FilePointer FileCache::getFile(const Key& key) {
-    Lock lock(_mutex);
-
     FilePointer file;
     if (!_initialized) {
         qCWarning(file_cache) << "File cache used before initialization";
         return file;
     }
 
-    // check if file exists
-    const auto it = _files.find(key);
-    if (it != _files.cend()) {
+    FilePointer missingFile; // released once the shard lock is, as releasing a file takes it
+    auto& shard = getShard(key);
+    {
+        Lock lock(shard.mutex);
+
+        // check if file exists
+        const auto it = shard.files.find(key);
+        if (it == shard.files.cend()) {
+            return file;
+        }
+
         file = it->second.lock();
-        if (file) {
-            file->touch();
-            // if it exists, it is active - remove it from the cache
-            if (_unusedFiles.erase(file)) {
-                assert(!file->_locked);
-                file->_locked = true;
-                _numUnusedFiles -= 1;
-                _unusedFilesSize -= file->getLength();
-            } else {
-                assert(file->_locked);
+        if (!file) {
+            // if not, remove the weak_ptr
+            shard.files.erase(it);
+            return file;
+        }
+
+        // Checked under the lock, so that no concurrent lookup is handed the file before it is known to exist
+        if (file->_isUnchecked) {
+            file->_isUnchecked = false;
+            if (!QFileInfo::exists(file->getFilepath().c_str())) {
+                // removed from the disk while the cache wasn't running
+                shard.files.erase(it);
+                _numTotalFiles -= 1;
+                _totalFilesSize -= file->getLength();
+                if (shard.unusedFiles.erase(file)) {
+                    _numUnusedFiles -= 1;
+                    _unusedFilesSize -= file->getLength();
+                }
+                file->_locked = false;
+                missingFile = std::move(file);
             }
-            qCDebug(file_cache, "[%s] Found %s", _dirname.c_str(), key.c_str());
-            emit dirty();
+        }
+
+        // if it exists, it is active - remove it from the cache
+        if (file && shard.unusedFiles.erase(file)) {
+            assert(!file->_locked);
+            file->_locked = true;
+            _numUnusedFiles -= 1;
+            _unusedFilesSize -= file->getLength();
         } else {
-            // if not, remove the weak_ptr
-            _files.erase(it);
+            assert(!file || file->_locked);
         }
     }
 
+    if (missingFile) {
+        qCDebug(file_cache, "[%s] Missing %s", _dirname.c_str(), key.c_str());
+        emit dirty();
+        return file;
+    }
+
+    file->touch(!_usePersistentIndex);
+    qCDebug(file_cache, "[%s] Found %s", _dirname.c_str(), key.c_str());
+    emit dirty();
+
     assert(!file || (file->_locked && file->_parent.lock()));
     return file;
 }
@@ -221,15 +415,27 @@ std::string FileCache::getFilepath(const Key& key) {
     return _dirpath + DIR_SEP + key + EXT_SEP + _ext;
 }
 
-// This is a non-public function that uses the mutex because it's 
+std::string FileCache::getIndexFilepath() const {
+    return _dirpath + DIR_SEP + INDEX_FILENAME;
+}
+
+FileCache::Shard& FileCache::getShard(const Key& key) {
+    return _shards[std::hash<Key>()(key) % NUM_SHARDS];
+}
+
+// This is a non-public function that takes the shard lock because it's
 // essentially a public function specifically to a File object
 void FileCache::addUnusedFile(const FilePointer& file) {
-    assert(file->_locked);
-    file->_locked = false;
-    _files[file->getKey()] = file;
-    _unusedFiles.insert(file);
-    _numUnusedFiles += 1;
-    _unusedFilesSize += file->getLength();
+    {
+        auto& shard = getShard(file->getKey());
+        Lock lock(shard.mutex);
+        assert(file->_locked);
+        file->_locked = false;
+        shard.files[file->getKey()] = file;
+        shard.unusedFiles.insert(file);
+        _numUnusedFiles += 1;
+        _unusedFilesSize += file->getLength();
+    }
     clean();
 
     emit dirty();
@@ -250,78 +456,141 @@ size_t FileCache::getOverbudgetAmount() const {
     return result;
 }
 
-namespace cache {
-    struct FilePointerComparator {
-        bool operator()(const FilePointer& a, const FilePointer& b) {
-            return a->_modified > b->_modified;
-        }
-    };
+double FileCache::evalEjectionScore(const File& file, int64_t now) {
+    // Idle time weighted by the square root of the size: big files go sooner, which takes fewer ejections to get
+    // back under budget, but a big file used recently still outlives a small one left unused for long.
+    // Between files of the same size, this is least recently used first.
+    double idle = (double)std::max<int64_t>(now - file._modified, 0) + 1.0;
+    return idle * std::sqrt((double)std::max<size_t>(file.getLength(), 1));
 }
 
-// Take file pointer by value to insure it doesn't get destructed during the "erase()" calls
-void FileCache::eject(FilePointer file) {
+// Take file pointer by reference: the caller keeps it alive, so that it isn't destructed with the shard lock held
+bool FileCache::eject(Shard& shard, const FilePointer& file) {
+    if (0 == shard.unusedFiles.erase(file)) {
+        return false; // in use again, or already ejected
+    }
     file->_locked = false;
     const auto& length = file->getLength();
-    const auto& key = file->getKey();
+    _numUnusedFiles -= 1;
+    _unusedFilesSize -= length;
 
-    if (0 != _files.erase(key)) {
+    auto it = shard.files.find(file->getKey());
+    if (it != shard.files.end() && it->second.lock() == file) {
+        shard.files.erase(it);
         _numTotalFiles -= 1;
         _totalFilesSize -= length;
     }
-    if (0 != _unusedFiles.erase(file)) {
-        _numUnusedFiles -= 1;
-        _unusedFilesSize -= length;
+
+    // Removed here rather than when the file is destroyed, so that it can't remove the same file written again since
+    if (shard.files.find(file->getKey()) == shard.files.end() && shard.writes.find(file->getKey()) == shard.writes.end()) {
+        QFile::remove(file->getFilepath().c_str());
+        qCInfo(file_cache, "Unlinked %s", file->getFilepath().c_str());
     }
+    file->_shouldPersist = true;
+    return true;
 }
 
 void FileCache::clean() {
-    size_t overbudgetAmount = getOverbudgetAmount();
-
-    // Avoid sorting the unused files by LRU if we're not over budget / under free space
-    if (0 == overbudgetAmount) {
+    // Avoid scoring the unused files if we're not over budget / under free space
+    if (0 == getOverbudgetAmount()) {
         return;
     }
 
-    using Queue = std::priority_queue<FilePointer, std::vector<FilePointer>, FilePointerComparator>;
-    Queue queue;
-    for (const auto& file : _unusedFiles) {
-        queue.push(file);
-    }
+    // Released only once the locks are, as releasing a file can take them
+    std::vector<std::pair<double, FilePointer>> candidates;
+    {
+        Lock cleanLock(_cleanMutex);
+        size_t overbudgetAmount = getOverbudgetAmount();
+        if (0 == overbudgetAmount) {
+            return;
+        }
+        size_t targetSize = (size_t)(EJECTION_TARGET_RATIO * _maxSize);
+        if (_totalFilesSize > targetSize) {
+            overbudgetAmount = std::max<size_t>(overbudgetAmount, _totalFilesSize - targetSize);
+        }
+
+        int64_t now = QDateTime::currentMSecsSinceEpoch();
+        for (auto& shard : _shards) {
+            Lock lock(shard.mutex);
+            for (const auto& file : shard.unusedFiles) {
+                candidates.emplace_back(evalEjectionScore(*file, now), file);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
 
-    while (!queue.empty() && overbudgetAmount > 0) {
-        auto file = queue.top();
-        queue.pop();
-        eject(file);
-        auto length = file->getLength();
-        overbudgetAmount -= std::min(length, overbudgetAmount);
+        for (const auto& candidate : candidates) {
+            if (0 == overbudgetAmount) {
+                break;
+            }
+            const auto& file = candidate.second;
+            auto& shard = getShard(file->getKey());
+            Lock lock(shard.mutex);
+            if (eject(shard, file)) {
+                auto length = file->getLength();
+                overbudgetAmount -= std::min(length, overbudgetAmount);
+            }
+        }
     }
 }
 
 void FileCache::wipe() {
-    Lock lock(_mutex);
-    while (!_unusedFiles.empty()) {
-        eject(*_unusedFiles.begin());
+    for (auto& shard : _shards) {
+        std::vector<FilePointer> unusedFiles;
+        Lock lock(shard.mutex);
+        unusedFiles.assign(shard.unusedFiles.begin(), shard.unusedFiles.end());
+        for (const auto& file : unusedFiles) {
+            eject(shard, file);
+        }
+        lock.unlock();
     }
+    emit dirty();
 }
 
 void FileCache::clear() {
-    Lock lock(_mutex);
-
     // Eliminate any overbudget files
     clean();
 
-    // Mark everything remaining as persisted while effectively ejecting from the cache
-    for (auto& file : _unusedFiles) {
-        file->_shouldPersist = true;
-        file->_parent.reset();
-        qCDebug(file_cache, "[%s] Persisting %s", _dirname.c_str(), file->getKey().c_str());
+    if (_usePersistentIndex && _initialized) {
+        writeIndex();
+    }
+
+    // Mark everything remaining as persisted while effectively ejecting from the cache.  That includes the files still
+    // in use, which the index lists too
+    for (auto& shard : _shards) {
+        Set unusedFiles;
+        std::vector<FilePointer> files;
+        {
+            Lock lock(shard.mutex);
+            unusedFiles.swap(shard.unusedFiles);
+            files.reserve(shard.files.size());
+            for (const auto& weakFile : shard.files) {
+                if (auto file = weakFile.second.lock()) {
+                    files.push_back(std::move(file));
+                }
+            }
+        }
+        for (auto& file : files) {
+            file->_shouldPersist = true;
+        }
+        for (auto& file : unusedFiles) {
+            file->_shouldPersist = true;
+            file->_parent.reset();
+            qCDebug(file_cache, "[%s] Persisting %s", _dirname.c_str(), file->getKey().c_str());
+        }
     }
-    _unusedFiles.clear();
 }
 
 void FileCache::releaseFile(File* file) {
-    Lock lock(_mutex);
-    if (file->_locked) {
+    bool isLocked;
+    {
+        auto& shard = getShard(file->getKey());
+        Lock lock(shard.mutex);
+        isLocked = file->_locked;
+    }
+
+    if (isLocked) {
         addUnusedFile(FilePointer(file, std::bind(&File::deleter, file)));
     } else {
         delete file;
@@ -344,8 +613,7 @@ void File::deleter(File* file) {
 File::File(Metadata&& metadata, const std::string& filepath) :
     _key(std::move(metadata.key)),
     _length(metadata.length),
-    _filepath(filepath),
-    _modified(QFileInfo(_filepath.c_str()).lastRead().toMSecsSinceEpoch()) {
+    _filepath(filepath) {
 }
 
 File::~File() {
@@ -356,8 +624,24 @@ File::~File() {
     }
 }
 
-void File::touch() {
-    utime(_filepath.c_str(), nullptr);
-    _modified = std::max<int64_t>(QFileInfo(_filepath.c_str()).lastRead().toMSecsSinceEpoch(), _modified);
+std::shared_ptr<storage::FileStorage> File::map() {
+    std::lock_guard<std::mutex> lock(_mappingMutex);
+    auto mapping = _mapping.lock();
+    if (!mapping) {
+        mapping = std::make_shared<storage::FileStorage>(QString::fromStdString(_filepath));
+        _mapping = mapping;
+    }
+    return mapping;
 }
 
+void File::touch(bool updateFilesystem) {
+    int64_t now;
+    if (updateFilesystem) {
+        utime(_filepath.c_str(), nullptr);
+        now = QFileInfo(_filepath.c_str()).lastRead().toMSecsSinceEpoch();
+    } else {
+        now = QDateTime::currentMSecsSinceEpoch();
+    }
+    int64_t modified = _modified;
+    while (modified < now && !_modified.compare_exchange_weak(modified, now)) {}
+}
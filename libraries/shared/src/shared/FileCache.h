@@ -10,6 +10,7 @@
 #ifndef hifi_FileCache_h
 #define hifi_FileCache_h
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <cstddef>
@@ -22,6 +23,8 @@
 #include <QObject>
 #include <QLoggingCategory>
 
+#include "Storage.h"
+
 Q_DECLARE_LOGGING_CATEGORY(file_cache)
 
 class FileCacheTests;
@@ -69,6 +72,12 @@ public:
     // to free up more space, regardless of the cache max size
     void setMinFreeSize(size_t size);
 
+    // Keep an index of the cached files in the cache directory, written on shutdown, so that initialize() can restore
+    // the cache without scanning the directory.  Access times are then kept in the index rather than on the files.
+    // Must be set before initialize()
+    void setPersistentIndex(bool enabled) { _usePersistentIndex = enabled; }
+    bool getPersistentIndex() const { return _usePersistentIndex; }
+
     using Key = std::string;
     struct Metadata {
         Metadata(const Key& key, size_t length) :
@@ -103,25 +112,44 @@ public:
     virtual std::unique_ptr<File> createFile(Metadata&& metadata, const std::string& filepath);
 
 private:
-    using Mutex = std::recursive_mutex;
+    using Mutex = std::mutex;
     using Lock = std::unique_lock<Mutex>;
     using Map = std::unordered_map<Key, std::weak_ptr<File>>;
     using Set = std::unordered_set<FilePointer>;
     using KeySet = std::unordered_set<Key>;
 
+    // The files are spread over shards by key, each with its own lock, so that lookups of different files don't
+    // contend.  A shard lock is never held while a file is written or released
+    static const size_t NUM_SHARDS { 16 };
+    struct Shard {
+        Mutex mutex;
+        Map files;
+        Set unusedFiles;
+        std::unordered_map<Key, int> writes; // in progress, so that ejected files don't remove them from the disk
+    };
+
     friend class File;
 
     std::string getFilepath(const Key& key);
-
-    FilePointer addFile(Metadata&& metadata, const std::string& filepath);
+    std::string getIndexFilepath() const;
+    Shard& getShard(const Key& key);
+
+    FilePointer addFile(Metadata&& metadata, const std::string& filepath, bool overwrite = false);
+    // Add a file found on disk at initialization to the unused files
+    void restoreFile(Metadata&& metadata, const std::string& filepath, int64_t modified);
+    bool restoreFromIndex();
+    void restoreFromDirectory();
+    void writeIndex();
     void addUnusedFile(const FilePointer& file);
     void releaseFile(File* file);
     void clean();
     void clear();
-    // Remove a file from the cache
-    void eject(FilePointer file);
+    // Remove an unused file from the cache and the disk, must be called with the lock of its shard held
+    bool eject(Shard& shard, const FilePointer& file);
 
     size_t getOverbudgetAmount() const;
+    // The higher the score, the sooner an unused file is ejected
+    static double evalEjectionScore(const File& file, int64_t now);
 
     // FIXME it might be desirable to have the min free space variable be static so it can be
     // shared among multiple instances of FileCache
@@ -135,11 +163,11 @@ private:
     const std::string _ext;
     const std::string _dirname;
     const std::string _dirpath;
-    bool _initialized { false };
+    std::atomic<bool> _initialized { false };
+    std::atomic<bool> _usePersistentIndex { false };
 
-    Mutex _mutex;
-    Map _files;
-    Set _unusedFiles;
+    Mutex _cleanMutex; // one ejection pass at a time
+    std::array<Shard, NUM_SHARDS> _shards;
 };
 
 class File {
@@ -151,6 +179,9 @@ public:
     const size_t& getLength() const { return _length; }
     const std::string& getFilepath() const { return _filepath; }
 
+    // Map the file into memory.  The mapping is shared by all the readers of the file while any of them holds it
+    std::shared_ptr<storage::FileStorage> map();
+
     virtual ~File();
     /// overrides should call File::deleter to maintain caching behavior
     static void deleter(File* file);
@@ -161,19 +192,22 @@ protected:
 
 private:
     friend class FileCache;
-    friend struct FilePointerComparator;
     friend class ::FileCacheTests;
 
     const Key _key;
     const size_t _length;
     const std::string _filepath;
 
-    void touch();
+    void touch(bool updateFilesystem);
     FileCacheWeakPointer _parent;
-    int64_t _modified { 0 };
+    std::atomic<int64_t> _modified { 0 };
     bool _locked { false };
+    bool _isUnchecked { false }; // restored from the index, and not yet seen to exist, guarded by the shard lock
 
     bool _shouldPersist { false };
+
+    std::mutex _mappingMutex;
+    std::weak_ptr<storage::FileStorage> _mapping;
 };
 
 }
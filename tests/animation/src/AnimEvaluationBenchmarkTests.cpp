@@ -0,0 +1,299 @@
+//
+//  AnimEvaluationBenchmarkTests.cpp
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimEvaluationBenchmarkTests.h"
+
+#include <random>
+
+#include <AnimBlendLinear.h>
+#include <AnimClip.h>
+#include <AnimContext.h>
+#include <AnimPoseBuffer.h>
+#include <AnimUtil.h>
+#include <AnimationCache.h>
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <NodeList.h>
+#include <ResourceManager.h>
+#include <ResourceRequestObserver.h>
+#include <StatTracker.h>
+
+QTEST_MAIN(AnimEvaluationBenchmarkTests)
+
+const int NUM_AVATARS = 100;
+const int NUM_CLIP_FRAMES = 30;
+const float FRAME_DT = 1.0f / 60.0f;
+const float TEST_EPSILON = 0.001f;
+
+// An AnimClip playing synthetic frames instead of a downloaded animation, shared through the AnimationCache.
+class SyntheticClip : public AnimClip {
+public:
+    SyntheticClip(const QString& id, const AnimSkeleton& skeleton, const std::vector<AnimPoseVec>& frames, bool mirrorFlag) :
+        AnimClip(id, "", 0.0f, (float)(frames.size() - 1), 1.0f, true, mirrorFlag, AnimBlendType_Normal, "", 0.0f) {
+        _networkAnim.reset();
+        _clipPoses = DependencyManager::get<AnimationCache>()->getClipPoses("synthetic:" + id, skeleton, [&] {
+            return frames;
+        });
+        _poses.resize(frames[0].size());
+    }
+};
+
+// a humanoid skeleton with the joint names AnimSkeleton mirrors by
+static std::vector<HFMJoint> makeHumanoidJoints() {
+    std::vector<HFMJoint> joints;
+    auto addJoint = [&](const QString& name, int parentIndex, const glm::vec3& translation) {
+        HFMJoint joint;
+        joint.name = name;
+        joint.parentIndex = parentIndex;
+        joint.translation = translation;
+        joint.isSkeletonJoint = true;
+        joints.push_back(joint);
+        return (int)joints.size() - 1;
+    };
+
+    int hips = addJoint("Hips", -1, glm::vec3(0.0f, 1.0f, 0.0f));
+    int spine = addJoint("Spine", hips, glm::vec3(0.0f, 0.1f, 0.0f));
+    int spine1 = addJoint("Spine1", spine, glm::vec3(0.0f, 0.1f, 0.0f));
+    int spine2 = addJoint("Spine2", spine1, glm::vec3(0.0f, 0.1f, 0.0f));
+    int neck = addJoint("Neck", spine2, glm::vec3(0.0f, 0.2f, 0.0f));
+    addJoint("Head", neck, glm::vec3(0.0f, 0.1f, 0.0f));
+
+    for (const QString& side : { QString("Left"), QString("Right") }) {
+        float x = side == "Left" ? 1.0f : -1.0f;
+        int upLeg = addJoint(side + "UpLeg", hips, glm::vec3(x * 0.1f, 0.0f, 0.0f));
+        int leg = addJoint(side + "Leg", upLeg, glm::vec3(0.0f, -0.45f, 0.0f));
+        int foot = addJoint(side + "Foot", leg, glm::vec3(0.0f, -0.45f, 0.0f));
+        addJoint(side + "ToeBase", foot, glm::vec3(0.0f, -0.05f, 0.1f));
+
+        int shoulder = addJoint(side + "Shoulder", spine2, glm::vec3(x * 0.05f, 0.15f, 0.0f));
+        int arm = addJoint(side + "Arm", shoulder, glm::vec3(x * 0.1f, 0.0f, 0.0f));
+        int foreArm = addJoint(side + "ForeArm", arm, glm::vec3(x * 0.3f, 0.0f, 0.0f));
+        int hand = addJoint(side + "Hand", foreArm, glm::vec3(x * 0.25f, 0.0f, 0.0f));
+        for (const QString& finger : { "Thumb", "Index", "Middle", "Ring", "Pinky" }) {
+            int parent = hand;
+            for (int i = 1; i <= 4; ++i) {
+                parent = addJoint(side + "Hand" + finger + QString::number(i), parent, glm::vec3(x * 0.02f, 0.0f, 0.0f));
+            }
+        }
+    }
+    return joints;
+}
+
+static AnimPoseVec makeRandomPoses(const AnimSkeleton& skeleton, std::mt19937& generator, float maxAngle) {
+    std::uniform_real_distribution<float> angle(-maxAngle, maxAngle);
+    std::uniform_real_distribution<float> axis(-1.0f, 1.0f);
+    AnimPoseVec poses = skeleton.getRelativeDefaultPoses();
+    for (auto& pose : poses) {
+        glm::vec3 randomAxis = glm::normalize(glm::vec3(axis(generator), axis(generator), axis(generator)) + glm::vec3(0.0f, 0.0f, 2.0f));
+        pose.rot() = pose.rot() * glm::angleAxis(angle(generator), randomAxis);
+    }
+    return poses;
+}
+
+static bool posesMatch(const AnimPose& a, const AnimPose& b) {
+    // q and -q are the same rotation
+    float rotError = 1.0f - fabsf(glm::dot(a.rot(), b.rot()));
+    return glm::length(a.scale() - b.scale()) < TEST_EPSILON && rotError < TEST_EPSILON &&
+        glm::length(a.trans() - b.trans()) < TEST_EPSILON;
+}
+
+void AnimEvaluationBenchmarkTests::initTestCase() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>();
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent);
+    DependencyManager::set<ResourceManager>();
+    DependencyManager::set<AnimationCache>();
+    DependencyManager::set<ResourceRequestObserver>();
+    DependencyManager::set<ResourceCacheSharedItems>();
+    DependencyManager::set<StatTracker>();
+
+    _skeleton = std::make_shared<AnimSkeleton>(makeHumanoidJoints(), QMap<int, glm::quat>());
+}
+
+void AnimEvaluationBenchmarkTests::cleanupTestCase() {
+    DependencyManager::get<ResourceManager>()->cleanup();
+}
+
+void AnimEvaluationBenchmarkTests::testPoseBufferMatchesAnimPose() {
+    std::mt19937 generator(1);
+    AnimPoseVec relPoses = makeRandomPoses(*_skeleton, generator, 1.0f);
+    AnimPoseVec otherPoses = makeRandomPoses(*_skeleton, generator, 1.0f);
+    const int numJoints = _skeleton->getNumJoints();
+
+    // relative to absolute and back
+    AnimPoseVec absPoses = relPoses;
+    _skeleton->convertRelativePosesToAbsolute(absPoses);
+    AnimPoseBuffer buffer(relPoses);
+    _skeleton->convertRelativePosesToAbsolute(buffer);
+    for (int i = 0; i < numJoints; ++i) {
+        QVERIFY(posesMatch(buffer.getPose(i), absPoses[i]));
+    }
+    _skeleton->convertAbsolutePosesToRelative(buffer);
+    for (int i = 0; i < numJoints; ++i) {
+        QVERIFY(posesMatch(buffer.getPose(i), relPoses[i]));
+    }
+
+    // blends
+    const float alpha = 0.3f;
+    AnimPoseVec blended(numJoints);
+    ::blend(numJoints, &relPoses[0], &otherPoses[0], alpha, &blended[0]);
+    AnimPoseBuffer blendedBuffer;
+    blendedBuffer.blend(AnimPoseBuffer(relPoses), AnimPoseBuffer(otherPoses), alpha);
+    for (int i = 0; i < numJoints; ++i) {
+        QVERIFY(posesMatch(blendedBuffer.getPose(i), blended[i]));
+    }
+    ::blendAdd(numJoints, &relPoses[0], &otherPoses[0], alpha, &blended[0]);
+    blendedBuffer.blendAdd(AnimPoseBuffer(relPoses), AnimPoseBuffer(otherPoses), alpha);
+    for (int i = 0; i < numJoints; ++i) {
+        QVERIFY(posesMatch(blendedBuffer.getPose(i), blended[i]));
+    }
+
+    // mirror
+    AnimPoseVec mirrored = relPoses;
+    _skeleton->mirrorRelativePoses(mirrored);
+    AnimPoseBuffer mirroredBuffer(relPoses);
+    _skeleton->mirrorRelativePoses(mirroredBuffer);
+    AnimPoseVec mirroredFromBuffer;
+    mirroredBuffer.store(mirroredFromBuffer);
+    QCOMPARE((int)mirroredFromBuffer.size(), numJoints);
+    for (int i = 0; i < numJoints; ++i) {
+        QVERIFY(posesMatch(mirroredFromBuffer[i], mirrored[i]));
+    }
+}
+
+void AnimEvaluationBenchmarkTests::benchmarkConvertRelativePosesToAbsolute_data() {
+    QTest::addColumn<bool>("useBuffer");
+    QTest::newRow("AnimPoseVec") << false;
+    QTest::newRow("AnimPoseBuffer") << true;
+}
+
+void AnimEvaluationBenchmarkTests::benchmarkConvertRelativePosesToAbsolute() {
+    QFETCH(bool, useBuffer);
+
+    std::mt19937 generator(2);
+    AnimPoseVec relPoses = makeRandomPoses(*_skeleton, generator, 1.0f);
+    AnimPoseVec poses;
+    AnimPoseBuffer buffer;
+
+    QBENCHMARK {
+        for (int i = 0; i < NUM_AVATARS; ++i) {
+            if (useBuffer) {
+                buffer.load(relPoses);
+                _skeleton->convertRelativePosesToAbsolute(buffer);
+                buffer.store(poses);
+            } else {
+                poses = relPoses;
+                _skeleton->convertRelativePosesToAbsolute(poses);
+            }
+        }
+    }
+}
+
+void AnimEvaluationBenchmarkTests::benchmarkEvaluateGraphs() {
+    std::mt19937 generator(3);
+    std::vector<AnimPoseVec> idleFrames;
+    std::vector<AnimPoseVec> walkFrames;
+    for (int i = 0; i < NUM_CLIP_FRAMES; ++i) {
+        idleFrames.push_back(makeRandomPoses(*_skeleton, generator, 0.1f));
+        walkFrames.push_back(makeRandomPoses(*_skeleton, generator, 0.5f));
+    }
+
+    // each avatar blends an idle clip with a mirrored walk clip, like the locomotion part of avatar-animation.json
+    std::vector<AnimNode::Pointer> graphs;
+    for (int i = 0; i < NUM_AVATARS; ++i) {
+        auto blend = std::make_shared<AnimBlendLinear>("idleToWalk", 0.25f + 0.5f * i / NUM_AVATARS, AnimBlendType_Normal);
+        blend->addChild(std::make_shared<SyntheticClip>("idle", *_skeleton, idleFrames, false));
+        blend->addChild(std::make_shared<SyntheticClip>("walk", *_skeleton, walkFrames, true));
+        blend->setSkeleton(_skeleton);
+        graphs.push_back(blend);
+    }
+
+    AnimContext context(false, false, false, glm::mat4(), glm::mat4(), 0);
+    AnimVariantMap vars;
+    AnimVariantMap triggers;
+    AnimPoseBuffer absPoses;
+
+    // spread the avatars over a few phases of the clips, the first evaluation also builds the mirrored frames
+    const int NUM_PHASES = 10;
+    for (int i = 0; i < NUM_AVATARS; ++i) {
+        graphs[i]->evaluate(vars, context, FRAME_DT * (1 + i % NUM_PHASES), triggers);
+    }
+
+    auto animCache = DependencyManager::get<AnimationCache>();
+    AnimationCache::ClipPoseStats statsBefore = animCache->getClipPoseStats();
+    QBENCHMARK {
+        for (auto& graph : graphs) {
+            triggers.clearMap();
+            const AnimPoseVec& poses = graph->evaluate(vars, context, FRAME_DT, triggers);
+            absPoses.load(poses);
+            _skeleton->convertRelativePosesToAbsolute(absPoses);
+        }
+    }
+    QCOMPARE((int)absPoses.size(), _skeleton->getNumJoints());
+
+    AnimationCache::ClipPoseStats stats = animCache->getClipPoseStats();
+    qInfo() << "clip samples:" << (stats.numSampleHits - statsBefore.numSampleHits) << "hits,"
+            << (stats.numSampleMisses - statsBefore.numSampleMisses) << "misses";
+}
+
+void AnimEvaluationBenchmarkTests::testClipPoseCache() {
+    std::mt19937 generator(4);
+    std::vector<AnimPoseVec> frames;
+    for (int i = 0; i < NUM_CLIP_FRAMES; ++i) {
+        frames.push_back(makeRandomPoses(*_skeleton, generator, 0.5f));
+    }
+
+    auto animCache = DependencyManager::get<AnimationCache>();
+    AnimationCache::ClipPoseStats statsBefore = animCache->getClipPoseStats();
+
+    // an identical skeleton shares the retargeted frames
+    AnimSkeleton otherSkeleton(makeHumanoidJoints(), QMap<int, glm::quat>());
+    QCOMPARE(otherSkeleton.getFingerprint(), _skeleton->getFingerprint());
+    int numRetargets = 0;
+    auto retarget = [&] {
+        ++numRetargets;
+        return frames;
+    };
+    auto clipPoses = animCache->getClipPoses("cacheTest", *_skeleton, retarget);
+    auto otherClipPoses = animCache->getClipPoses("cacheTest", otherSkeleton, retarget);
+    QVERIFY(otherClipPoses == clipPoses);
+    QCOMPARE(numRetargets, 1);
+
+    // the same quantized frame is only blended once, and matches ::blend() at the quantized alpha
+    AnimPoseVec poses;
+    AnimPoseVec otherPoses;
+    clipPoses->sample(3, 4, 0.26f, false, *_skeleton, poses);
+    clipPoses->sample(3, 4, 0.24f, false, otherSkeleton, otherPoses);
+    AnimationCache::ClipPoseStats stats = animCache->getClipPoseStats();
+    QCOMPARE((int)(stats.numRetargetHits - statsBefore.numRetargetHits), 1);
+    QCOMPARE((int)(stats.numRetargetMisses - statsBefore.numRetargetMisses), 1);
+    QCOMPARE((int)(stats.numSampleHits - statsBefore.numSampleHits), 1);
+    QCOMPARE((int)(stats.numSampleMisses - statsBefore.numSampleMisses), 1);
+
+    AnimPoseVec expected(frames[3].size());
+    ::blend(expected.size(), &frames[3][0], &frames[4][0], 0.25f, &expected[0]);
+    QCOMPARE(poses.size(), expected.size());
+    for (size_t i = 0; i < poses.size(); ++i) {
+        QVERIFY(posesMatch(poses[i], expected[i]));
+        QVERIFY(posesMatch(otherPoses[i], expected[i]));
+    }
+
+    // unless shared, frames are sampled at the given alpha, and not kept for others
+    clipPoses->sample(3, 4, 0.26f, false, *_skeleton, poses, false);
+    ::blend(expected.size(), &frames[3][0], &frames[4][0], 0.26f, &expected[0]);
+    for (size_t i = 0; i < poses.size(); ++i) {
+        QVERIFY(posesMatch(poses[i], expected[i]));
+    }
+    QCOMPARE(animCache->getClipPoseStats().numSampleMisses, stats.numSampleMisses);
+
+    // a different clip is retargeted on its own
+    animCache->getClipPoses("otherCacheTest", *_skeleton, retarget);
+    QCOMPARE(numRetargets, 2);
+}
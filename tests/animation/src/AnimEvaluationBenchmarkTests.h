@@ -0,0 +1,34 @@
+//
+//  AnimEvaluationBenchmarkTests.h
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimEvaluationBenchmarkTests_h
+#define hifi_AnimEvaluationBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+#include <AnimSkeleton.h>
+
+// Evaluates the animation graphs of a crowd of avatars, and checks the structure-of-arrays pose kernels against
+// their AnimPose counterparts and the sharing of clip poses in the AnimationCache.
+class AnimEvaluationBenchmarkTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void testPoseBufferMatchesAnimPose();
+    void testClipPoseCache();
+    void benchmarkConvertRelativePosesToAbsolute_data();
+    void benchmarkConvertRelativePosesToAbsolute();
+    void benchmarkEvaluateGraphs();
+
+private:
+    AnimSkeleton::Pointer _skeleton;
+};
+
+#endif // hifi_AnimEvaluationBenchmarkTests_h
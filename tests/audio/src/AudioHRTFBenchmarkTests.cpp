@@ -0,0 +1,135 @@
+//
+//  AudioHRTFBenchmarkTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioHRTFBenchmarkTests.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <AudioHRTF.h>
+
+QTEST_MAIN(AudioHRTFBenchmarkTests)
+
+static const int HRTF_DATASET_INDEX = 1;
+
+// One listener's worth of mono sources, each with its own HRTF state, spread around the listener.
+class HRTFScene {
+public:
+    HRTFScene(int numSources) : _hrtfs(numSources), _inputs(numSources), _sources(numSources) {
+        std::mt19937 random(numSources);
+        std::uniform_int_distribution<int> sample(-8192, 8191);
+        std::uniform_real_distribution<float> azimuth(-PI, PI);
+        std::uniform_real_distribution<float> distance(0.2f, 20.0f);
+
+        for (int i = 0; i < numSources; i++) {
+            _hrtfs[i].reset(new AudioHRTF());
+            _inputs[i].resize(HRTF_BLOCK);
+            for (auto& s : _inputs[i]) {
+                s = (int16_t)sample(random);
+            }
+            _sources[i] = { _hrtfs[i].get(), _inputs[i].data(), azimuth(random), distance(random), 0.5f };
+        }
+    }
+
+    // moves every source a little, so that each frame interpolates between old and new filters
+    void step() {
+        for (auto& source : _sources) {
+            source.azimuth += 0.01f;
+            if (source.azimuth > PI) {
+                source.azimuth -= TWO_PI;
+            }
+        }
+    }
+
+    void render(float* output) {
+        for (auto& source : _sources) {
+            source.hrtf->render(source.input, output, HRTF_DATASET_INDEX, source.azimuth, source.distance, source.gain,
+                                HRTF_BLOCK, source.lpfDistance);
+        }
+    }
+
+    void renderBatch(float* output) {
+        AudioHRTF::renderBatch(_sources.data(), (int)_sources.size(), output, HRTF_DATASET_INDEX, HRTF_BLOCK);
+    }
+
+private:
+    std::vector<std::unique_ptr<AudioHRTF>> _hrtfs;
+    std::vector<std::vector<int16_t>> _inputs;
+    std::vector<AudioHRTF::BatchSource> _sources;
+};
+
+static void addSourceCounts() {
+    QTest::addColumn<int>("numSources");
+    QTest::newRow("8 sources") << 8;
+    QTest::newRow("32 sources") << 32;
+    QTest::newRow("128 sources") << 128;
+}
+
+void AudioHRTFBenchmarkTests::renderBatchMatchesRender_data() {
+    QTest::addColumn<int>("numSources");
+    QTest::newRow("1 source") << 1;
+    QTest::newRow("7 sources") << 7;
+    QTest::newRow("32 sources") << 32;
+}
+
+void AudioHRTFBenchmarkTests::renderBatchMatchesRender() {
+    QFETCH(int, numSources);
+
+    HRTFScene perSource(numSources);
+    HRTFScene batched(numSources);
+
+    for (int frame = 0; frame < 10; frame++) {
+        float expected[2 * HRTF_BLOCK] = {};
+        float actual[2 * HRTF_BLOCK] = {};
+
+        perSource.render(expected);
+        batched.renderBatch(actual);
+
+        for (int i = 0; i < 2 * HRTF_BLOCK; i++) {
+            QCOMPARE(actual[i], expected[i]);
+        }
+
+        perSource.step();
+        batched.step();
+    }
+}
+
+void AudioHRTFBenchmarkTests::benchmarkRender_data() {
+    addSourceCounts();
+}
+
+void AudioHRTFBenchmarkTests::benchmarkRender() {
+    QFETCH(int, numSources);
+
+    HRTFScene scene(numSources);
+    float output[2 * HRTF_BLOCK] = {};
+
+    QBENCHMARK {
+        scene.render(output);
+        scene.step();
+    }
+}
+
+void AudioHRTFBenchmarkTests::benchmarkRenderBatch_data() {
+    addSourceCounts();
+}
+
+void AudioHRTFBenchmarkTests::benchmarkRenderBatch() {
+    QFETCH(int, numSources);
+
+    HRTFScene scene(numSources);
+    float output[2 * HRTF_BLOCK] = {};
+
+    QBENCHMARK {
+        scene.renderBatch(output);
+        scene.step();
+    }
+}
@@ -0,0 +1,27 @@
+//
+//  AudioHRTFBenchmarkTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioHRTFBenchmarkTests_h
+#define hifi_AudioHRTFBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+class AudioHRTFBenchmarkTests : public QObject {
+    Q_OBJECT
+private slots:
+    void renderBatchMatchesRender_data();
+    void renderBatchMatchesRender();
+    void benchmarkRender_data();
+    void benchmarkRender();
+    void benchmarkRenderBatch_data();
+    void benchmarkRenderBatch();
+};
+
+#endif // hifi_AudioHRTFBenchmarkTests_h
@@ -209,3 +209,83 @@ void KtxBenchmarks::benchmarkWriteKTX() {
     }
 }
 
+// A deterministic image with enough detail that block compression has work to do.
+static QImage createTestImage(int size) {
+    QImage image(size, size, QImage::Format_ARGB32);
+    for (int y = 0; y < size; y++) {
+        QRgb* line = reinterpret_cast<QRgb*>(image.scanLine(y));
+        for (int x = 0; x < size; x++) {
+            uint32_t hash = (uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u;
+            hash ^= hash >> 13;
+            line[x] = qRgb((x + (hash & 0x1F)) & 0xFF, (y + ((hash >> 5) & 0x1F)) & 0xFF, ((x ^ y) + ((hash >> 10) & 0x1F)) & 0xFF);
+        }
+    }
+    return image;
+}
+
+static gpu::TexturePointer compressTestImage(const QImage& image, int numThreads) {
+    std::atomic<bool> abortSignal { false };
+    int previousThreads = image::getTextureCompressionThreads();
+    image::setTextureCompressionThreads(numThreads);
+    auto texture = image::TextureUsage::process2DTextureColorFromImage(QImage(image), "test", true, gpu::BackendTarget::GL45, true, abortSignal);
+    image::setTextureCompressionThreads(previousThreads);
+    return texture;
+}
+
+static QString compressionThreadsToString(int numThreads) {
+    return numThreads == image::AUTOMATIC_COMPRESSION_THREADS ? "auto" : QString::number(numThreads);
+}
+
+void KtxBenchmarks::compressedTextureMatches_data() {
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("2048") << 2048;
+}
+
+void KtxBenchmarks::compressedTextureMatches() {
+    QFETCH(int, size);
+
+    QImage image = createTestImage(size);
+    auto sequentialTexture = compressTestImage(image, 1);
+    auto parallelTexture = compressTestImage(image, image::AUTOMATIC_COMPRESSION_THREADS);
+    QVERIFY(sequentialTexture);
+    QVERIFY(parallelTexture);
+    QCOMPARE(parallelTexture->getNumMips(), sequentialTexture->getNumMips());
+
+    auto dimensions = glm::ivec2(size, size);
+    auto sequentialKTX = gpu::Texture::serialize(*sequentialTexture, dimensions);
+    auto parallelKTX = gpu::Texture::serialize(*parallelTexture, dimensions);
+    QVERIFY(sequentialKTX);
+    QVERIFY(parallelKTX);
+
+    const auto& sequentialStorage = sequentialKTX->getStorage();
+    const auto& parallelStorage = parallelKTX->getStorage();
+    QCOMPARE(parallelStorage->size(), sequentialStorage->size());
+    QVERIFY(memcmp(parallelStorage->data(), sequentialStorage->data(), sequentialStorage->size()) == 0);
+}
+
+void KtxBenchmarks::benchmarkCompressTexture_data() {
+    QTest::addColumn<int>("size");
+    QTest::addColumn<int>("numThreads");
+
+    const int SIZES[] = { 2048, 4096, 8192 };
+    const int THREAD_COUNTS[] = { 1, image::AUTOMATIC_COMPRESSION_THREADS };
+    for (int size : SIZES) {
+        for (int numThreads : THREAD_COUNTS) {
+            QString desc = QString("%1 x %1, %2 threads").arg(size).arg(compressionThreadsToString(numThreads));
+            QTest::newRow(desc.toUtf8()) << size << numThreads;
+        }
+    }
+}
+
+void KtxBenchmarks::benchmarkCompressTexture() {
+    QFETCH(int, size);
+    QFETCH(int, numThreads);
+
+    QImage image = createTestImage(size);
+
+    QBENCHMARK {
+        gpu::TexturePointer texture = compressTestImage(image, numThreads);
+        QVERIFY(texture);
+    }
+}
@@ -21,6 +21,11 @@ private slots:
     void benchmarkCreateTexture();
     void benchmarkSerializeTexture();
     void benchmarkWriteKTX();
+
+    void compressedTextureMatches_data();
+    void compressedTextureMatches();
+    void benchmarkCompressTexture_data();
+    void benchmarkCompressTexture();
 };
 
 
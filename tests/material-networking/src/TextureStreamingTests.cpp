@@ -0,0 +1,166 @@
+//
+//  TextureStreamingTests.cpp
+//  tests/material-networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TextureStreamingTests.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QUuid>
+
+#include <DependencyManager.h>
+#include <LimitedNodeList.h>
+#include <NodeList.h>
+#include <ResourceCache.h>
+#include <ResourceManager.h>
+#include <ResourceRequestObserver.h>
+#include <StatTracker.h>
+#include <gpu/Texture.h>
+#include <material-networking/TextureCache.h>
+
+QTEST_MAIN(TextureStreamingTests)
+
+// A 256x256 texture has 9 mips. The ones that come with the header, 32x32 and coarser, fit in the last 5516 bytes of the
+// file that NetworkTexture requests first.
+static const int TEXTURE_SIZE = 256;
+static const int LOW_MIP_LEVEL = 3;
+static const int TIMEOUT = 5000;
+static const int SETTLE_TIME = 200;
+
+// A KTX with every mip, under a source hash of its own so that no texture or KTX cache file is shared between loads
+static QByteArray makeKtx() {
+    auto texture = gpu::Texture::create2D(gpu::Element::COLOR_RGBA_32, TEXTURE_SIZE, TEXTURE_SIZE,
+                                          gpu::Texture::MAX_NUM_MIPS);
+    texture->setStoredMipFormat(gpu::Element::COLOR_RGBA_32);
+    texture->setSourceHash(QUuid::createUuid().toRfc4122().toHex().toStdString());
+    for (uint16_t mip = 0; mip < texture->getNumMips(); ++mip) {
+        QByteArray pixels((int)texture->evalMipSize(mip), (char)mip);
+        texture->assignStoredMip(mip, pixels.size(), reinterpret_cast<const gpu::Byte*>(pixels.data()));
+    }
+
+    auto ktx = gpu::Texture::serialize(*texture, { TEXTURE_SIZE, TEXTURE_SIZE });
+    if (!ktx) {
+        return QByteArray();
+    }
+    return QByteArray(reinterpret_cast<const char*>(ktx->_storage->data()), (int)ktx->_storage->size());
+}
+
+void TextureStreamingTests::initTestCase() {
+    QStandardPaths::setTestModeEnabled(true); // keeps the KTX cache out of the user's data
+
+    DependencyManager::set<StatTracker>();
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<NodeList>(NodeType::Agent, INVALID_PORT);
+    DependencyManager::set<ResourceCacheSharedItems>();
+    DependencyManager::set<ResourceManager>();
+    DependencyManager::set<ResourceRequestObserver>();
+    DependencyManager::set<TextureCache>();
+
+    QVERIFY(_dir.isValid());
+}
+
+void TextureStreamingTests::cleanupTestCase() {
+    DependencyManager::get<TextureCache>()->setMipStreaming(false);
+    gpu::Texture::setAllowedGPUMemoryUsage(0);
+    DependencyManager::get<ResourceManager>()->cleanup();
+}
+
+QSharedPointer<NetworkTexture> TextureStreamingTests::loadKtx(const QString& name) {
+    QByteArray ktx = makeKtx();
+    QFile file(_dir.filePath(name));
+    if (ktx.isEmpty() || !file.open(QIODevice::WriteOnly) || file.write(ktx) != ktx.size()) {
+        return QSharedPointer<NetworkTexture>();
+    }
+    file.close();
+
+    return DependencyManager::get<TextureCache>()->getTexture(QUrl::fromLocalFile(file.fileName()));
+}
+
+void TextureStreamingTests::evalMipLevelForScreenSize_data() {
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("height");
+    QTest::addColumn<float>("pixels");
+    QTest::addColumn<int>("mipLevel");
+
+    QTest::newRow("full size") << 256 << 256 << 256.0f << 0;
+    QTest::newRow("larger than the texture") << 256 << 256 << 1000.0f << 0;
+    QTest::newRow("half size") << 256 << 256 << 128.0f << 1;
+    QTest::newRow("between mips") << 256 << 256 << 100.0f << 1;
+    QTest::newRow("low mips") << 256 << 256 << 32.0f << LOW_MIP_LEVEL;
+    QTest::newRow("one pixel") << 256 << 256 << 1.0f << 8;
+    QTest::newRow("no pixels") << 256 << 256 << 0.0f << 8;
+    QTest::newRow("longest side") << 256 << 64 << 64.0f << 2;
+    QTest::newRow("unknown size") << 0 << 0 << 64.0f << 0;
+}
+
+void TextureStreamingTests::evalMipLevelForScreenSize() {
+    QFETCH(int, width);
+    QFETCH(int, height);
+    QFETCH(float, pixels);
+    QFETCH(int, mipLevel);
+
+    QCOMPARE((int)NetworkTexture::evalMipLevelForScreenSize(width, height, pixels), mipLevel);
+}
+
+void TextureStreamingTests::loadsAllMipsWithoutStreaming() {
+    DependencyManager::get<TextureCache>()->setMipStreaming(false);
+    gpu::Texture::setAllowedGPUMemoryUsage(0);
+
+    auto texture = loadKtx("full.ktx");
+    QVERIFY(texture);
+    QTRY_VERIFY_WITH_TIMEOUT(texture->isLoaded(), TIMEOUT);
+    QTRY_COMPARE_WITH_TIMEOUT(texture->getResidentMipLevel(), 0, TIMEOUT);
+    QCOMPARE(texture->getRequestedMipLevel(), 0);
+}
+
+void TextureStreamingTests::streamsRequestedMips() {
+    DependencyManager::get<TextureCache>()->setMipStreaming(true);
+    gpu::Texture::setAllowedGPUMemoryUsage(0);
+
+    auto texture = loadKtx("streamed.ktx");
+    QVERIFY(texture);
+    QTRY_VERIFY_WITH_TIMEOUT(texture->isLoaded(), TIMEOUT);
+    QTRY_COMPARE_WITH_TIMEOUT(texture->getResidentMipLevel(), LOW_MIP_LEVEL, TIMEOUT);
+
+    // Nothing finer is loaded until it is asked for
+    QTest::qWait(SETTLE_TIME);
+    QCOMPARE(texture->getResidentMipLevel(), LOW_MIP_LEVEL);
+    QCOMPARE(texture->getRequestedMipLevel(), -1);
+
+    texture->requestMipLevel(1);
+    QTRY_COMPARE_WITH_TIMEOUT(texture->getResidentMipLevel(), 1, TIMEOUT);
+    QTest::qWait(SETTLE_TIME);
+    QCOMPARE(texture->getResidentMipLevel(), 1);
+
+    texture->requestScreenSize((float)TEXTURE_SIZE);
+    QTRY_COMPARE_WITH_TIMEOUT(texture->getResidentMipLevel(), 0, TIMEOUT);
+    QCOMPARE(texture->getRequestedMipLevel(), 0);
+    QCOMPARE(texture->getResidentSize(), (size_t)texture->getGPUTexture()->evalTotalSize(0));
+}
+
+void TextureStreamingTests::defersMipsOverBudget() {
+    DependencyManager::get<TextureCache>()->setMipStreaming(true);
+    // Nothing is populated on a GPU here, so a budget of a byte is too small for any mip
+    gpu::Texture::setAllowedGPUMemoryUsage(1);
+
+    auto texture = loadKtx("budget.ktx");
+    QVERIFY(texture);
+    QTRY_VERIFY_WITH_TIMEOUT(texture->isLoaded(), TIMEOUT);
+    QTRY_COMPARE_WITH_TIMEOUT(texture->getResidentMipLevel(), LOW_MIP_LEVEL, TIMEOUT);
+
+    texture->requestMipLevel(0);
+    QTest::qWait(SETTLE_TIME);
+    QCOMPARE(texture->getResidentMipLevel(), LOW_MIP_LEVEL);
+    QCOMPARE(texture->getRequestedMipLevel(), 0);
+
+    // The deferred mips load the next time the texture is asked for, once there is room for them
+    gpu::Texture::setAllowedGPUMemoryUsage(0);
+    texture->requestMipLevel(0);
+    QTRY_COMPARE_WITH_TIMEOUT(texture->getResidentMipLevel(), 0, TIMEOUT);
+}
@@ -0,0 +1,39 @@
+//
+//  TextureStreamingTests.h
+//  tests/material-networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TextureStreamingTests_h
+#define hifi_TextureStreamingTests_h
+
+#include <QtCore/QSharedPointer>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QtTest>
+
+class NetworkTexture;
+
+// Loads local KTX textures through TextureCache with mip streaming, headless: the mips are read by range through
+// FileResourceRequest and held by the KTX cache, without a GPU backend.
+class TextureStreamingTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void evalMipLevelForScreenSize_data();
+    void evalMipLevelForScreenSize();
+    void loadsAllMipsWithoutStreaming();
+    void streamsRequestedMips();
+    void defersMipsOverBudget();
+
+private:
+    QSharedPointer<NetworkTexture> loadKtx(const QString& name);
+
+    QTemporaryDir _dir;
+};
+
+#endif // hifi_TextureStreamingTests_h
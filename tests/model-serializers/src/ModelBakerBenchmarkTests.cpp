@@ -0,0 +1,199 @@
+//
+//  ModelBakerBenchmarkTests.cpp
+//  tests/model-serializers/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+
+
+// Bakes the avatars downloaded for ModelSerializersTests with different numbers of threads, and reports the time
+// taken by each task of the bake. To benchmark a single model with a single number of threads:
+//
+//     ./model-serializers-ModelBakerBenchmarkTests bake:Franny.glb-4
+//
+
+#include "ModelBakerBenchmarkTests.h"
+#include "GLTFSerializer.h"
+#include "FBXSerializer.h"
+#include "OBJSerializer.h"
+
+#include "Gzip.h"
+#include "model-networking/ModelLoader.h"
+#include <model-baker/Baker.h>
+#include <hfm/ModelFormatRegistry.h>
+#include "DependencyManager.h"
+#include "ResourceManager.h"
+#include "AssetClient.h"
+#include "LimitedNodeList.h"
+#include "NodeList.h"
+#include "ResourceRequestObserver.h"
+#include "StatTracker.h"
+
+#include <QByteArray>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QNetworkReply>
+
+QTEST_MAIN(ModelBakerBenchmarkTests)
+
+namespace {
+    const QStringList MODEL_FILES {
+        "models/src/DragonAvatar1.glb.gz",
+        "models/src/UkraineFranny.glb.gz",
+        "models/src/Franny.glb.gz",
+        "models/src/womanInTShirt.glb.gz",
+        "models/src/female-avatar-with-swords.glb.gz"
+    };
+
+    const QStringList BAKE_TASKS {
+        "CalculateMeshNormals",
+        "CalculateMeshTangents",
+        "CalculateBlendshapeNormals",
+        "CalculateBlendshapeTangents",
+        "BuildGraphicsMesh",
+        "BuildDracoMesh"
+    };
+
+    hfm::Model::Pointer loadModel(const QString& filename) {
+        QFile file(filename);
+        if (!file.open(QIODevice::ReadOnly)) {
+            return hfm::Model::Pointer();
+        }
+
+        QByteArray data = file.readAll();
+        QByteArray uncompressedData;
+        QUrl url("file:" + QCoreApplication::applicationDirPath());
+        if (filename.toLower().endsWith(".gz")) {
+            url.setPath(QCoreApplication::applicationDirPath() + "/" + filename.chopped(3));
+            if (!gunzip(data, uncompressedData)) {
+                return hfm::Model::Pointer();
+            }
+        } else {
+            url.setPath(QCoreApplication::applicationDirPath() + "/" + filename);
+            uncompressedData = data;
+        }
+
+        ModelLoader loader;
+        QMultiHash<QString, QVariant> serializerMapping;
+        serializerMapping.insert("combineParts", true);
+        serializerMapping.insert("deduplicateIndices", true);
+        return loader.load(uncompressedData, serializerMapping, url, std::string());
+    }
+
+    // Baker modifies the model it is given, so each bake gets a copy of its own.
+    std::shared_ptr<baker::Baker> createBaker(const hfm::Model::Pointer& model, int numThreads) {
+        auto bakedModel = std::make_shared<hfm::Model>(*model);
+        auto modelBaker = std::make_shared<baker::Baker>(bakedModel, hifi::VariantHash(), hifi::URL());
+        modelBaker->getConfiguration()->getJobConfig("BuildDracoMesh")->setEnabled(true);
+        modelBaker->setNumThreads(numThreads);
+        return modelBaker;
+    }
+
+    QString threadsToString(int numThreads) {
+        return numThreads == baker::BakeContext::AUTOMATIC_THREADS ? "auto" : QString::number(numThreads);
+    }
+}
+
+void ModelBakerBenchmarkTests::initTestCase() {
+    qRegisterMetaType<QNetworkReply*>("QNetworkReply*");
+
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<NodeList>(NodeType::Agent, INVALID_PORT);
+
+    DependencyManager::set<ModelFormatRegistry>(); // ModelFormatRegistry must be defined before ModelCache. See the ModelCache constructor.
+    DependencyManager::set<ResourceManager>();
+    DependencyManager::set<AssetClient>();
+    DependencyManager::set<ResourceRequestObserver>();
+    DependencyManager::set<StatTracker>();
+
+    auto modelFormatRegistry = DependencyManager::get<ModelFormatRegistry>();
+    modelFormatRegistry->addFormat(FBXSerializer());
+    modelFormatRegistry->addFormat(OBJSerializer());
+    modelFormatRegistry->addFormat(GLTFSerializer());
+}
+
+void ModelBakerBenchmarkTests::parallelBakeMatches_data() {
+    QTest::addColumn<QString>("filename");
+
+    for (const auto& filename : MODEL_FILES) {
+        QTest::newRow(QFileInfo(filename).completeBaseName().toUtf8().data()) << filename;
+    }
+}
+
+void ModelBakerBenchmarkTests::parallelBakeMatches() {
+    QFETCH(QString, filename);
+
+    auto model = loadModel(filename);
+    QVERIFY(model);
+
+    auto serialBaker = createBaker(model, 1);
+    serialBaker->run();
+    auto parallelBaker = createBaker(model, baker::BakeContext::AUTOMATIC_THREADS);
+    parallelBaker->run();
+
+    auto serialModel = serialBaker->getHFMModel();
+    auto parallelModel = parallelBaker->getHFMModel();
+    QCOMPARE(parallelModel->meshes.size(), serialModel->meshes.size());
+    for (int i = 0; i < serialModel->meshes.size(); i++) {
+        const auto& serialMesh = serialModel->meshes[i];
+        const auto& parallelMesh = parallelModel->meshes[i];
+        QVERIFY(parallelMesh.normals == serialMesh.normals);
+        QVERIFY(parallelMesh.tangents == serialMesh.tangents);
+        QCOMPARE((bool)parallelMesh._mesh, (bool)serialMesh._mesh);
+        QCOMPARE(parallelMesh.blendshapes.size(), serialMesh.blendshapes.size());
+        for (int j = 0; j < serialMesh.blendshapes.size(); j++) {
+            QVERIFY(parallelMesh.blendshapes[j].normals == serialMesh.blendshapes[j].normals);
+            QVERIFY(parallelMesh.blendshapes[j].tangents == serialMesh.blendshapes[j].tangents);
+        }
+    }
+
+    QVERIFY(parallelBaker->getDracoMeshes() == serialBaker->getDracoMeshes());
+    QVERIFY(parallelBaker->getDracoErrors() == serialBaker->getDracoErrors());
+    QVERIFY(parallelBaker->getDracoMaterialLists() == serialBaker->getDracoMaterialLists());
+}
+
+void ModelBakerBenchmarkTests::bake_data() {
+    QTest::addColumn<QString>("filename");
+    QTest::addColumn<int>("numThreads");
+
+    const std::vector<int> THREAD_COUNTS { 1, 2, 4, baker::BakeContext::AUTOMATIC_THREADS };
+    for (const auto& filename : MODEL_FILES) {
+        for (int numThreads : THREAD_COUNTS) {
+            QString testname = QFileInfo(filename).completeBaseName() + "-" + threadsToString(numThreads);
+            QTest::newRow(testname.toUtf8().data()) << filename << numThreads;
+        }
+    }
+}
+
+void ModelBakerBenchmarkTests::bake() {
+    QFETCH(QString, filename);
+    QFETCH(int, numThreads);
+
+    auto model = loadModel(filename);
+    QVERIFY(model);
+
+    int numBlendshapes = 0;
+    for (const auto& mesh : model->meshes) {
+        numBlendshapes += mesh.blendshapes.size();
+    }
+
+    std::shared_ptr<baker::Baker> modelBaker;
+    QElapsedTimer timer;
+    QBENCHMARK {
+        // the model's arrays are implicitly shared, so copying it for the baker is cheap
+        modelBaker = createBaker(model, numThreads);
+        timer.start();
+        modelBaker->run();
+    }
+    qint64 elapsed = timer.elapsed();
+
+    auto config = modelBaker->getConfiguration();
+    qInfo() << QFileInfo(filename).completeBaseName() << "with" << model->meshes.size() << "meshes and" << numBlendshapes
+        << "blendshapes, baked on" << threadsToString(numThreads) << "threads in" << elapsed << "ms";
+    for (const auto& task : BAKE_TASKS) {
+        qInfo() << "   " << task << config->getJobConfig(task)->getCPURunTime() << "ms";
+    }
+}
@@ -0,0 +1,27 @@
+//
+//  ModelBakerBenchmarkTests.h
+//  tests/model-serializers/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef overte_ModelBakerBenchmarkTests_h
+#define overte_ModelBakerBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+class ModelBakerBenchmarkTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void parallelBakeMatches_data();
+    void parallelBakeMatches();
+    void bake_data();
+    void bake();
+};
+
+#endif // overte_ModelBakerBenchmarkTests_h
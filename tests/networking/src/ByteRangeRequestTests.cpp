@@ -0,0 +1,192 @@
+//
+//  ByteRangeRequestTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ByteRangeRequestTests.h"
+
+#include <algorithm>
+
+#include <QtCore/QFile>
+#include <QtCore/QRandomGenerator>
+#include <QtNetwork/QTcpSocket>
+
+#include <DependencyManager.h>
+#include <FileResourceRequest.h>
+#include <HTTPResourceRequest.h>
+#include <StatTracker.h>
+
+QTEST_MAIN(ByteRangeRequestTests)
+
+static const QString LARGE_FILE = "large.ktx";
+static const QString SMALL_FILE = "small.ktx";
+
+// The ranges NetworkTexture uses, see NetworkTexture::makeRequest() and NetworkTexture::startMipRangeRequest()
+static const qint64 HEADER_SIZE = 1000;
+static const qint64 HIGH_MIP_MAX_SIZE = 5516;
+
+void ByteRangeRequestTests::initTestCase() {
+    DependencyManager::set<StatTracker>();
+
+    QVERIFY(_dir.isValid());
+    QRandomGenerator random(42);
+    for (const auto& entry : { std::make_pair(LARGE_FILE, 16384), std::make_pair(SMALL_FILE, 600) }) {
+        QByteArray content(entry.second, Qt::Uninitialized);
+        for (auto& byte : content) {
+            byte = (char)random.bounded(256);
+        }
+        _files[entry.first] = content;
+
+        QFile file(_dir.filePath(entry.first));
+        QVERIFY(file.open(QFile::WriteOnly));
+        QCOMPARE(file.write(content), (qint64)content.size());
+    }
+
+    connect(&_server, &QTcpServer::newConnection, this, [this] {
+        while (auto socket = _server.nextPendingConnection()) {
+            connect(socket, &QTcpSocket::readyRead, this, [this, socket] { serve(socket); });
+            connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+        }
+    });
+    QVERIFY(_server.listen(QHostAddress::LocalHost));
+}
+
+void ByteRangeRequestTests::serve(QTcpSocket* socket) {
+    QByteArray request = socket->property("request").toByteArray() + socket->readAll();
+    socket->setProperty("request", request);
+    if (!request.contains("\r\n\r\n")) {
+        return;
+    }
+
+    auto lines = request.split('\n');
+    auto path = lines[0].split(' ').value(1).mid(1);
+    auto found = _files.find(QString(path));
+    if (found == _files.end()) {
+        socket->write("HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+        socket->disconnectFromHost();
+        return;
+    }
+
+    // Only the forms HTTPResourceRequest sends: "bytes=<from>-<to>" and "bytes=-<suffix length>"
+    const QByteArray& content = found.value();
+    static const QByteArray RANGE_PREFIX = "range: bytes=";
+    qint64 size = content.size();
+    qint64 from = 0;
+    qint64 to = size - 1;
+    bool isRange = false;
+    for (const auto& line : lines) {
+        if (line.toLower().startsWith(RANGE_PREFIX)) {
+            auto range = line.trimmed().mid(RANGE_PREFIX.size()).split('-');
+            if (range[0].isEmpty()) {
+                from = std::max((qint64)0, size - range[1].toLongLong());
+            } else {
+                from = range[0].toLongLong();
+                to = std::min(to, range[1].toLongLong());
+            }
+            isRange = true;
+        }
+    }
+
+    QByteArray body = content.mid(from, to - from + 1);
+    QByteArray response = isRange ? "HTTP/1.1 206 Partial Content\r\n" : "HTTP/1.1 200 OK\r\n";
+    if (isRange) {
+        response += QString("Content-Range: bytes %1-%2/%3\r\n").arg(from).arg(to).arg(size).toLatin1();
+    }
+    response += "Content-Type: application/octet-stream\r\n";
+    response += "Content-Length: " + QByteArray::number(body.size()) + "\r\n";
+    response += "Connection: close\r\n\r\n";
+    socket->write(response + body);
+    socket->disconnectFromHost();
+}
+
+QByteArray ByteRangeRequestTests::fetch(ResourceRequest* request, ByteRange range) {
+    request->setByteRange(range);
+
+    QSignalSpy finished(request, &ResourceRequest::finished);
+    request->send();
+    if (request->getState() != ResourceRequest::Finished) {
+        finished.wait(5000);
+    }
+
+    if (request->getState() != ResourceRequest::Finished || request->getResult() != ResourceRequest::Success) {
+        return QByteArray();
+    }
+    return request->getData();
+}
+
+void ByteRangeRequestTests::addRangeRows() {
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<qint64>("fromInclusive");
+    QTest::addColumn<qint64>("toExclusive");
+    QTest::addColumn<int>("expectedFrom");
+    QTest::addColumn<int>("expectedSize");
+
+    const int largeSize = _files[LARGE_FILE].size();
+    const int smallSize = _files[SMALL_FILE].size();
+    QTest::newRow("header") << LARGE_FILE << (qint64)0 << HEADER_SIZE << 0 << (int)HEADER_SIZE;
+    QTest::newRow("low mips") << LARGE_FILE << -HIGH_MIP_MAX_SIZE << (qint64)0
+        << largeSize - (int)HIGH_MIP_MAX_SIZE << (int)HIGH_MIP_MAX_SIZE;
+    QTest::newRow("mip") << LARGE_FILE << (qint64)4096 << (qint64)8192 << 4096 << 4096;
+    QTest::newRow("header of a small file") << SMALL_FILE << (qint64)0 << HEADER_SIZE << 0 << smallSize;
+    QTest::newRow("low mips of a small file") << SMALL_FILE << -HIGH_MIP_MAX_SIZE << (qint64)0 << 0 << smallSize;
+}
+
+void ByteRangeRequestTests::fileRanges_data() {
+    addRangeRows();
+}
+
+void ByteRangeRequestTests::fileRanges() {
+    QFETCH(QString, file);
+    QFETCH(qint64, fromInclusive);
+    QFETCH(qint64, toExclusive);
+    QFETCH(int, expectedFrom);
+    QFETCH(int, expectedSize);
+
+    FileResourceRequest request(QUrl::fromLocalFile(_dir.filePath(file)), ResourceRequest::IS_NOT_OBSERVABLE);
+    ByteRange range;
+    range.fromInclusive = fromInclusive;
+    range.toExclusive = toExclusive;
+    QByteArray data = fetch(&request, range);
+
+    QCOMPARE(data.size(), expectedSize);
+    QVERIFY(data == _files[file].mid(expectedFrom, expectedSize));
+}
+
+void ByteRangeRequestTests::httpRanges_data() {
+    addRangeRows();
+}
+
+void ByteRangeRequestTests::httpRanges() {
+    QFETCH(QString, file);
+    QFETCH(qint64, fromInclusive);
+    QFETCH(qint64, toExclusive);
+    QFETCH(int, expectedFrom);
+    QFETCH(int, expectedSize);
+
+    QUrl url(QString("http://127.0.0.1:%1/%2").arg(_server.serverPort()).arg(file));
+    HTTPResourceRequest request(url, ResourceRequest::IS_NOT_OBSERVABLE);
+    ByteRange range;
+    range.fromInclusive = fromInclusive;
+    range.toExclusive = toExclusive;
+    QByteArray data = fetch(&request, range);
+
+    QCOMPARE(data.size(), expectedSize);
+    QVERIFY(data == _files[file].mid(expectedFrom, expectedSize));
+}
+
+void ByteRangeRequestTests::invalidFileRange() {
+    FileResourceRequest request(QUrl::fromLocalFile(_dir.filePath(SMALL_FILE)), ResourceRequest::IS_NOT_OBSERVABLE);
+    ByteRange range;
+    range.fromInclusive = _files[SMALL_FILE].size() + 1;
+    range.toExclusive = range.fromInclusive + HEADER_SIZE;
+    request.setByteRange(range);
+    request.send();
+
+    QCOMPARE(request.getState(), ResourceRequest::Finished);
+    QCOMPARE(request.getResult(), ResourceRequest::InvalidByteRange);
+}
@@ -0,0 +1,45 @@
+//
+//  ByteRangeRequestTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ByteRangeRequestTests_h
+#define hifi_ByteRangeRequestTests_h
+
+#include <QtCore/QHash>
+#include <QtCore/QTemporaryDir>
+#include <QtNetwork/QTcpServer>
+#include <QtTest/QtTest>
+
+#include <ByteRange.h>
+
+class ResourceRequest;
+
+// The ranges NetworkTexture requests a KTX by, through FileResourceRequest and through HTTPResourceRequest from a local
+// stand-in server that serves ranges the way HTTP servers do.
+class ByteRangeRequestTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void fileRanges_data();
+    void fileRanges();
+    void httpRanges_data();
+    void httpRanges();
+    void invalidFileRange();
+
+private:
+    void addRangeRows();
+    void serve(QTcpSocket* socket);
+    QByteArray fetch(ResourceRequest* request, ByteRange range);
+
+    QTemporaryDir _dir;
+    QTcpServer _server;
+    QHash<QString, QByteArray> _files;
+};
+
+#endif // hifi_ByteRangeRequestTests_h
@@ -0,0 +1,204 @@
+//
+//  DomainListJournalTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DomainListJournalTests.h"
+
+#include <random>
+
+#include <DomainListJournal.h>
+#include <NodeType.h>
+
+QTEST_MAIN(DomainListJournalTests)
+
+static quint16 nextPort = 40000;
+
+static SharedNodePointer createNode(NodeType_t type) {
+    SockAddr publicSocket(SocketType::UDP, QHostAddress("203.0.113.1"), nextPort++);
+    SockAddr localSocket(SocketType::UDP, QHostAddress("192.168.0.2"), nextPort++);
+    return SharedNodePointer(new Node(QUuid::createUuid(), type, publicSocket, localSocket));
+}
+
+static void moveNode(const SharedNodePointer& node) {
+    node->setPublicSocket(SockAddr(SocketType::UDP, QHostAddress("203.0.113.1"), nextPort++));
+}
+
+static QSet<QUuid> toSet(const QVector<QUuid>& ids) {
+    return QSet<QUuid>(ids.begin(), ids.end());
+}
+
+void DomainListJournalTests::journalsChanges() {
+    std::vector<SharedNodePointer> nodes { createNode(NodeType::AudioMixer), createNode(NodeType::AvatarMixer),
+                                           createNode(NodeType::Agent) };
+    DomainListJournal journal;
+    QCOMPARE(journal.getVersion(), (quint64)0);
+
+    QVERIFY(journal.update(nodes));
+    QCOMPARE(journal.getVersion(), (quint64)1);
+    QCOMPARE(journal.getNodes().size(), 3);
+
+    DomainListJournal::Changes changes;
+    QVERIFY(!journal.getChangesSince(0, changes)); // never received a whole list
+    QVERIFY(!journal.getChangesSince(2, changes)); // from the future, e.g. another domain-server
+    QVERIFY(journal.getChangesSince(1, changes));
+    QVERIFY(changes.changed.isEmpty() && changes.removed.isEmpty());
+
+    // nothing changed, nothing journaled
+    QVERIFY(!journal.update(nodes));
+    QCOMPARE(journal.getVersion(), (quint64)1);
+
+    SharedNodePointer moved = nodes[0];
+    SharedNodePointer removed = nodes[2];
+    SharedNodePointer added = createNode(NodeType::Agent);
+    moveNode(moved);
+    nodes.pop_back();
+    nodes.push_back(added);
+    QVERIFY(journal.update(nodes));
+    QCOMPARE(journal.getVersion(), (quint64)2);
+
+    changes = DomainListJournal::Changes();
+    QVERIFY(journal.getChangesSince(1, changes));
+    QCOMPARE(toSet(changes.changed), QSet<QUuid>({ moved->getUUID(), added->getUUID() }));
+    QCOMPARE(changes.removed.size(), 1);
+    QCOMPARE(changes.removed.front().first, removed->getUUID());
+    QCOMPARE(changes.removed.front().second, (NodeType_t)NodeType::Agent);
+
+    // a node that comes back is sent again
+    nodes.push_back(removed);
+    QVERIFY(journal.update(nodes));
+    changes = DomainListJournal::Changes();
+    QVERIFY(journal.getChangesSince(2, changes));
+    QCOMPARE(changes.changed, QVector<QUuid>({ removed->getUUID() }));
+    QVERIFY(changes.removed.isEmpty());
+
+    // and a node that missed both updates gets the node's latest state only
+    changes = DomainListJournal::Changes();
+    QVERIFY(journal.getChangesSince(1, changes));
+    QCOMPARE(toSet(changes.changed), QSet<QUuid>({ moved->getUUID(), added->getUUID(), removed->getUUID() }));
+    QVERIFY(changes.removed.isEmpty());
+}
+
+void DomainListJournalTests::fallsBehind() {
+    std::vector<SharedNodePointer> nodes;
+    for (int i = 0; i < 100; ++i) {
+        nodes.push_back(createNode(NodeType::Agent));
+    }
+    DomainListJournal journal;
+    journal.update(nodes);
+
+    int numUpdates = DomainListJournal::MAX_NUM_ENTRIES / (int)nodes.size() + 1;
+    for (int i = 0; i < numUpdates; ++i) {
+        for (auto& node : nodes) {
+            moveNode(node);
+        }
+        journal.update(nodes);
+    }
+
+    DomainListJournal::Changes changes;
+    QVERIFY(!journal.getChangesSince(1, changes));
+    QVERIFY(journal.getChangesSince(journal.getVersion() - 1, changes));
+    QCOMPARE(changes.changed.size(), (int)nodes.size());
+}
+
+void DomainListJournalTests::bytesPerCheckIn_data() {
+    QTest::addColumn<int>("numAgents");
+    QTest::newRow("50 agents") << 50;
+    QTest::newRow("200 agents") << 200;
+    QTest::newRow("500 agents") << 500;
+}
+
+void DomainListJournalTests::bytesPerCheckIn() {
+    QFETCH(int, numAgents);
+
+    // each second, 2% of the agents move to another public socket, and one agent leaves while another arrives
+    const int NUM_SECONDS = 30;
+    const float MOVE_PROBABILITY = 0.02f;
+    const int RECORD_HEADER_BYTES = sizeof(quint32) + sizeof(DomainListRecord);
+    const int CONNECTION_SECRET_BYTES = NUM_BYTES_RFC4122_UUID;
+
+    const NodeSet SERVER_TYPES { NodeType::AudioMixer, NodeType::AvatarMixer, NodeType::EntityServer, NodeType::AssetServer,
+                                 NodeType::MessagesMixer, NodeType::EntityScriptServer };
+    std::vector<SharedNodePointer> nodes;
+    for (auto type : SERVER_TYPES) {
+        nodes.push_back(createNode(type));
+    }
+    for (int i = 0; i < numAgents; ++i) {
+        nodes.push_back(createNode(NodeType::Agent));
+    }
+
+    // as the domain-server sets them up: agents don't hear about other agents, the servers hear about everyone
+    auto getInterestSet = [&](const SharedNodePointer& node) {
+        NodeSet interestSet = SERVER_TYPES;
+        if (node->getType() != NodeType::Agent) {
+            interestSet << NodeType::Agent;
+        }
+        return interestSet;
+    };
+
+    DomainListJournal journal;
+    QHash<QUuid, quint64> seenVersions;
+    std::mt19937 generator(numAgents);
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+    quint64 numCheckIns = 0;
+    quint64 numBytes = 0;
+    quint64 numWholeListBytes = 0;
+    for (int second = 0; second < NUM_SECONDS; ++second) {
+        for (size_t i = SERVER_TYPES.size(); i < nodes.size(); ++i) {
+            if (chance(generator) < MOVE_PROBABILITY) {
+                moveNode(nodes[i]);
+            }
+        }
+        seenVersions.remove(nodes.back()->getUUID());
+        nodes.back() = createNode(NodeType::Agent);
+        journal.update(nodes);
+
+        for (const auto& node : nodes) {
+            NodeSet interestSet = getInterestSet(node);
+            auto isOfInterest = [&](const QUuid& otherNodeID, NodeType_t otherNodeType) {
+                return otherNodeID != node->getUUID() && interestSet.contains(otherNodeType);
+            };
+
+            int wholeListBytes = 0;
+            for (auto it = journal.getNodes().cbegin(); it != journal.getNodes().cend(); ++it) {
+                if (isOfInterest(it.key(), it->type)) {
+                    wholeListBytes += RECORD_HEADER_BYTES + it->data.size() + CONNECTION_SECRET_BYTES;
+                }
+            }
+
+            int bytes = wholeListBytes;
+            DomainListJournal::Changes changes;
+            if (journal.getChangesSince(seenVersions.value(node->getUUID()), changes)) {
+                bytes = 0;
+                for (const auto& otherNodeID : changes.changed) {
+                    const auto& otherNode = journal.getNodes()[otherNodeID];
+                    if (isOfInterest(otherNodeID, otherNode.type)) {
+                        bytes += RECORD_HEADER_BYTES + otherNode.data.size() + CONNECTION_SECRET_BYTES;
+                    }
+                }
+                for (const auto& removed : changes.removed) {
+                    if (isOfInterest(removed.first, removed.second)) {
+                        bytes += RECORD_HEADER_BYTES + NUM_BYTES_RFC4122_UUID;
+                    }
+                }
+            }
+            seenVersions[node->getUUID()] = journal.getVersion();
+
+            ++numCheckIns;
+            numBytes += bytes;
+            numWholeListBytes += wholeListBytes;
+        }
+    }
+
+    float bytesPerCheckIn = (float)numBytes / (float)numCheckIns;
+    float wholeListBytesPerCheckIn = (float)numWholeListBytes / (float)numCheckIns;
+    qInfo() << numAgents << "agents:" << bytesPerCheckIn << "node bytes per check-in, against"
+            << wholeListBytesPerCheckIn << "when sending the whole list";
+    QVERIFY(bytesPerCheckIn < wholeListBytesPerCheckIn);
+}
@@ -0,0 +1,27 @@
+//
+//  DomainListJournalTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DomainListJournalTests_h
+#define hifi_DomainListJournalTests_h
+
+#include <QtTest/QtTest>
+
+class DomainListJournalTests : public QObject {
+    Q_OBJECT
+private slots:
+    void journalsChanges();
+    void fallsBehind();
+
+    // DomainList bytes per check-in with a domain's worth of agents coming, going and changing sockets
+    void bytesPerCheckIn_data();
+    void bytesPerCheckIn();
+};
+
+#endif // hifi_DomainListJournalTests_h
@@ -185,3 +185,31 @@ void PacketTests::primitiveTest() {
     QCOMPARE(recvPacket->peekPrimitive(&noValue), 0);
     QCOMPARE(recvPacket->readPrimitive(&noValue), 0);
 }
+
+void PacketTests::bufferPoolTest() {
+    auto pool = std::make_shared<udt::PacketBufferPool>(1);
+    auto data = pool->acquire();
+    memset(data.get(), 0, udt::PacketBufferPool::BUFFER_SIZE); // an unsourced packet of type Unknown
+    const char* address = data.get();
+    QCOMPARE(pool->getNumAllocations(), (quint64)1);
+
+    {
+        auto packet = NLPacket::fromReceivedPacket(std::move(data), NLPacket::totalHeaderSize(PacketType::Unknown),
+                                                   SockAddr());
+        packet->setBufferPool(pool);
+        auto movedPacket = NLPacket::fromBase(std::move(packet));
+        QCOMPARE(movedPacket->getData(), address);
+    }
+
+    // the buffer is reused rather than allocating another
+    auto reused = pool->acquire();
+    QCOMPARE((const char*)reused.get(), address);
+    QCOMPARE(pool->getNumAllocations(), (quint64)1);
+
+    // packets outliving their pool free their buffer themselves
+    auto packet = NLPacket::fromReceivedPacket(std::move(reused), NLPacket::totalHeaderSize(PacketType::Unknown),
+                                               SockAddr());
+    packet->setBufferPool(pool);
+    pool.reset();
+    packet.reset();
+}
@@ -36,6 +36,9 @@ private slots:
 
     // Test set/get packet type
     void packetTypeTest();
+
+    // Test that received packets give their buffer back to the pool it came from
+    void bufferPoolTest();
 };
 
 #endif // hifi_PacketTests_h
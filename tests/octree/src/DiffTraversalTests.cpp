@@ -0,0 +1,227 @@
+//
+//  DiffTraversalTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DiffTraversalTests.h"
+
+#include <random>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <DependencyManager.h>
+#include <DiffTraversal.h>
+#include <EntityTree.h>
+#include <NodeList.h>
+#include <ViewFrustum.h>
+
+QTEST_MAIN(DiffTraversalTests)
+
+const int NUM_ENTITIES = 100000;
+const float DOMAIN_HALF_SIZE = 1000.0f;
+const uint64_t TIME_BUDGET = 200; // usec, as in EntityTreeSendThread
+const int NUM_PARALLEL_THREADS = 4;
+
+static DiffTraversal::View createView() {
+    ViewFrustum viewFrustum;
+    viewFrustum.setPosition(glm::vec3(0.0f));
+    viewFrustum.setOrientation(glm::quat());
+    viewFrustum.setProjection(glm::radians(90.0f), 16.0f / 9.0f, 0.1f, 2.0f * DOMAIN_HALF_SIZE);
+    viewFrustum.calculate();
+
+    DiffTraversal::View view;
+    view.viewFrustums.push_back(ConicalViewFrustum(viewFrustum));
+    return view;
+}
+
+// the scan a send thread does on a First traversal
+static void traverseSequentially(DiffTraversal& traversal, const DiffTraversal::View& view, EntityTreeElementPointer root,
+                                 EntityPriorityQueue& sendQueue) {
+    traversal.prepareNewTraversal(view, root, true);
+    traversal.setScanCallback([&](DiffTraversal::VisibleElement& next) {
+        next.element->forEachEntity([&](EntityItemPointer entity) {
+            if (sendQueue.contains(entity.get())) {
+                return;
+            }
+            float priority = traversal.getCurrentView().computePriority(entity);
+            if (priority != PrioritizedEntity::DO_NOT_SEND) {
+                sendQueue.emplace(entity, priority);
+            }
+        });
+    });
+    while (!traversal.finished()) {
+        traversal.traverse(TIME_BUDGET);
+    }
+}
+
+static void traverseInParallel(DiffTraversal& traversal, const DiffTraversal::View& view, EntityTreeElementPointer root,
+                               EntityPriorityQueue& sendQueue) {
+    traversal.prepareNewTraversal(view, root, true);
+    QVERIFY(traversal.canTraverseInParallel());
+    while (!traversal.finished()) {
+        QVERIFY(traversal.canTraverseInParallel());
+        traversal.traverseInParallel(sendQueue, TIME_BUDGET);
+    }
+}
+
+// pops every entity and returns them sorted by pointer, for comparison
+static std::vector<std::pair<EntityItem*, float>> drain(EntityPriorityQueue& sendQueue) {
+    std::vector<std::pair<EntityItem*, float>> entities;
+    while (!sendQueue.empty()) {
+        entities.emplace_back(sendQueue.top().getRawEntityPointer(), sendQueue.top().getPriority());
+        sendQueue.pop();
+    }
+    std::sort(entities.begin(), entities.end());
+    return entities;
+}
+
+void DiffTraversalTests::initTestCase() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>(false, [&]{ return QString("Mozilla/5.0 (OverteDiffTraversalTests)"); });
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::EntityServer);
+
+    _tree = std::make_shared<EntityTree>(true);
+    _tree->createRootElement();
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> position(-DOMAIN_HALF_SIZE, DOMAIN_HALF_SIZE);
+    std::uniform_real_distribution<float> size(0.1f, 10.0f);
+    _tree->withWriteLock([&] {
+        for (int i = 0; i < NUM_ENTITIES; ++i) {
+            EntityItemProperties properties;
+            properties.setType(EntityTypes::Box);
+            properties.setPosition(glm::vec3(position(generator), position(generator), position(generator)));
+            properties.setDimensions(glm::vec3(size(generator)));
+            QVERIFY(_tree->addEntity(QUuid::createUuid(), properties));
+        }
+    });
+}
+
+void DiffTraversalTests::cleanupTestCase() {
+    DiffTraversal::setNumParallelTraversalThreads(0);
+    _tree.reset();
+    DependencyManager::destroy<NodeList>();
+    DependencyManager::destroy<AddressManager>();
+    DependencyManager::destroy<AccountManager>();
+}
+
+void DiffTraversalTests::parallelMatchesSequential() {
+    auto root = std::static_pointer_cast<EntityTreeElement>(_tree->getRoot());
+    auto view = createView();
+
+    _tree->withReadLock([&] {
+        DiffTraversal sequential;
+        EntityPriorityQueue sequentialQueue;
+        traverseSequentially(sequential, view, root, sequentialQueue);
+
+        DiffTraversal::setNumParallelTraversalThreads(NUM_PARALLEL_THREADS);
+        DiffTraversal parallel;
+        EntityPriorityQueue parallelQueue;
+        traverseInParallel(parallel, view, root, parallelQueue);
+
+        auto parallelEntities = drain(parallelQueue);
+        auto sequentialEntities = drain(sequentialQueue);
+        QVERIFY(!sequentialEntities.empty());
+        QVERIFY((int)sequentialEntities.size() < NUM_ENTITIES); // the view culls some
+        QCOMPARE(parallelEntities.size(), sequentialEntities.size());
+        QVERIFY(parallelEntities == sequentialEntities);
+
+        // and the next traversal carries on from the completed one
+        QCOMPARE(parallel.prepareNewTraversal(view, root), DiffTraversal::Repeat);
+        QVERIFY(!parallel.canTraverseInParallel());
+    });
+}
+
+void DiffTraversalTests::parallelLeavesQueuedEntities() {
+    auto root = std::static_pointer_cast<EntityTreeElement>(_tree->getRoot());
+    auto view = createView();
+
+    _tree->withReadLock([&] {
+        DiffTraversal::setNumParallelTraversalThreads(NUM_PARALLEL_THREADS);
+
+        DiffTraversal traversal;
+        EntityPriorityQueue sendQueue;
+        traverseInParallel(traversal, view, root, sendQueue);
+        size_t numQueued = drain(sendQueue).size();
+
+        // an entity already queued, e.g. for removal, keeps its place
+        EntityItemPointer queued;
+        root->forEachEntity([&](EntityItemPointer entity) { queued = queued ? queued : entity; });
+        if (!queued) {
+            for (int i = 0; i < NUMBER_OF_CHILDREN && !queued; ++i) {
+                auto child = root->getChildAtIndex(i);
+                if (child) {
+                    child->forEachEntity([&](EntityItemPointer entity) { queued = queued ? queued : entity; });
+                }
+            }
+        }
+        QVERIFY(queued);
+        sendQueue.emplace(queued, PrioritizedEntity::FORCE_REMOVE, true);
+
+        traverseInParallel(traversal, view, root, sendQueue);
+        auto entities = drain(sendQueue);
+        QVERIFY(entities.size() == numQueued || entities.size() == numQueued + 1);
+        auto it = std::find_if(entities.begin(), entities.end(), [&](const std::pair<EntityItem*, float>& entity) {
+            return entity.first == queued.get();
+        });
+        QVERIFY(it != entities.end());
+        QCOMPARE(it->second, PrioritizedEntity::FORCE_REMOVE);
+    });
+}
+
+void DiffTraversalTests::parallelResumesAcrossCalls() {
+    auto root = std::static_pointer_cast<EntityTreeElement>(_tree->getRoot());
+    auto view = createView();
+
+    _tree->withReadLock([&] {
+        DiffTraversal sequential;
+        EntityPriorityQueue sequentialQueue;
+        traverseSequentially(sequential, view, root, sequentialQueue);
+
+        // with no budget each call scans only a few elements, and the next one carries on
+        DiffTraversal::setNumParallelTraversalThreads(NUM_PARALLEL_THREADS);
+        DiffTraversal parallel;
+        EntityPriorityQueue parallelQueue;
+        parallel.prepareNewTraversal(view, root, true);
+        int numCalls = 0;
+        while (!parallel.finished()) {
+            QVERIFY(parallel.canTraverseInParallel());
+            parallel.traverseInParallel(parallelQueue, 0);
+            ++numCalls;
+        }
+        QVERIFY(numCalls > 1);
+        QVERIFY(drain(parallelQueue) == drain(sequentialQueue));
+        QVERIFY(!parallel.canTraverseInParallel());
+    });
+}
+
+void DiffTraversalTests::sequentialFirstTraversalBenchmark() {
+    auto root = std::static_pointer_cast<EntityTreeElement>(_tree->getRoot());
+    auto view = createView();
+    _tree->withReadLock([&] {
+        QBENCHMARK {
+            DiffTraversal traversal;
+            EntityPriorityQueue sendQueue;
+            traverseSequentially(traversal, view, root, sendQueue);
+        }
+    });
+}
+
+void DiffTraversalTests::parallelFirstTraversalBenchmark() {
+    auto root = std::static_pointer_cast<EntityTreeElement>(_tree->getRoot());
+    auto view = createView();
+    DiffTraversal::setNumParallelTraversalThreads(NUM_PARALLEL_THREADS);
+    _tree->withReadLock([&] {
+        QBENCHMARK {
+            DiffTraversal traversal;
+            EntityPriorityQueue sendQueue;
+            traverseInParallel(traversal, view, root, sendQueue);
+        }
+    });
+}
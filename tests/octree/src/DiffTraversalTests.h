@@ -0,0 +1,39 @@
+//
+//  DiffTraversalTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DiffTraversalTests_h
+#define hifi_DiffTraversalTests_h
+
+#include <memory>
+
+#include <QtTest/QtTest>
+
+class EntityTree;
+
+class DiffTraversalTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void parallelMatchesSequential();
+    void parallelLeavesQueuedEntities();
+    void parallelResumesAcrossCalls();
+
+    // time to a client's first full scene of a 100k entity tree
+    void sequentialFirstTraversalBenchmark();
+    void parallelFirstTraversalBenchmark();
+
+private:
+    std::shared_ptr<EntityTree> _tree;
+};
+
+#endif // hifi_DiffTraversalTests_h
@@ -0,0 +1,146 @@
+//
+//  EntityMapTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityMapTests.h"
+
+#include <random>
+#include <thread>
+
+#include <EntityItemProperties.h>
+#include <EntityMap.h>
+
+QTEST_MAIN(EntityMapTests)
+
+const int NUM_ENTITIES = 100000;
+const int NUM_OPERATIONS_PER_THREAD = 200000;
+const int WRITE_PERCENTAGE = 5;
+
+static EntityItemPointer createEntity() {
+    EntityItemProperties properties;
+    return EntityTypes::constructEntityItem(EntityTypes::Box, EntityItemID(QUuid::createUuid()), properties);
+}
+
+template <typename Map>
+static void verifyMap() {
+    Map map;
+    EntityItemPointer entity = createEntity();
+    EntityItemPointer otherEntity = createEntity();
+    QVERIFY(entity && otherEntity);
+
+    QVector<EntityItemID> ids;
+    for (int i = 0; i < 1000; ++i) {
+        ids.push_back(EntityItemID(QUuid::createUuid()));
+        QVERIFY(map.insert(ids.back(), i % 2 ? entity : otherEntity));
+    }
+    QCOMPARE(map.size(), ids.size());
+    QVERIFY(!map.insert(ids.front(), entity));
+    QCOMPARE(map.value(ids.front()), otherEntity);
+    QCOMPARE(map.value(ids[1]), entity);
+    QVERIFY(!map.value(EntityItemID(QUuid::createUuid())));
+
+    map.remove(ids.front());
+    map.remove(ids.front());
+    QVERIFY(!map.value(ids.front()));
+    QCOMPARE(map.size(), ids.size() - 1);
+
+    int numVisited = 0;
+    map.forEach([&](const EntityItemPointer& visited) {
+        QVERIFY(visited == entity || visited == otherEntity);
+        ++numVisited;
+    });
+    QCOMPARE(numVisited, ids.size() - 1);
+
+    auto entities = map.take();
+    QCOMPARE(entities.size(), ids.size() - 1);
+    QCOMPARE(map.size(), 0);
+    QVERIFY(!map.value(ids[1]));
+
+    entities.remove(ids[1]);
+    map.reset(entities);
+    QCOMPARE(map.size(), ids.size() - 2);
+    QVERIFY(!map.value(ids[1]));
+    QCOMPARE(map.value(ids[2]), otherEntity);
+}
+
+void EntityMapTests::lockedMap() {
+    verifyMap<LockedEntityMap>();
+}
+
+void EntityMapTests::shardedMap() {
+    verifyMap<ShardedEntityMap>();
+}
+
+template <typename Map>
+static void runConcurrentAccess(Map& map, const QVector<EntityItemID>& ids, const EntityItemPointer& entity, int numThreads) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t] {
+            std::mt19937 generator(t);
+            std::uniform_int_distribution<int> index(0, ids.size() - 1);
+            std::uniform_int_distribution<int> percentage(0, 99);
+            int numFound = 0;
+            for (int i = 0; i < NUM_OPERATIONS_PER_THREAD; ++i) {
+                if (percentage(generator) < WRITE_PERCENTAGE) {
+                    EntityItemID id(QUuid::createUuid());
+                    map.insert(id, entity);
+                    map.remove(id);
+                } else if (map.value(ids[index(generator)])) {
+                    ++numFound;
+                }
+            }
+            Q_ASSERT(numFound > 0);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void EntityMapTests::concurrentAccessBenchmark_data() {
+    QTest::addColumn<bool>("sharded");
+    QTest::addColumn<int>("numThreads");
+
+    for (int numThreads : { 1, 2, 4, 8, 16 }) {
+        QTest::newRow(qPrintable(QString("locked, %1 threads").arg(numThreads))) << false << numThreads;
+        QTest::newRow(qPrintable(QString("sharded, %1 threads").arg(numThreads))) << true << numThreads;
+    }
+}
+
+void EntityMapTests::concurrentAccessBenchmark() {
+    QFETCH(bool, sharded);
+    QFETCH(int, numThreads);
+
+    EntityItemPointer entity = createEntity();
+    QVector<EntityItemID> ids;
+    ids.reserve(NUM_ENTITIES);
+    for (int i = 0; i < NUM_ENTITIES; ++i) {
+        ids.push_back(EntityItemID(QUuid::createUuid()));
+    }
+
+    if (sharded) {
+        ShardedEntityMap map;
+        for (const auto& id : ids) {
+            map.insert(id, entity);
+        }
+        QBENCHMARK {
+            runConcurrentAccess(map, ids, entity, numThreads);
+        }
+        QCOMPARE(map.size(), NUM_ENTITIES);
+    } else {
+        LockedEntityMap map;
+        for (const auto& id : ids) {
+            map.insert(id, entity);
+        }
+        QBENCHMARK {
+            runConcurrentAccess(map, ids, entity, numThreads);
+        }
+        QCOMPARE(map.size(), NUM_ENTITIES);
+    }
+}
@@ -0,0 +1,28 @@
+//
+//  EntityMapTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityMapTests_h
+#define hifi_EntityMapTests_h
+
+#include <QtTest/QtTest>
+
+class EntityMapTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void lockedMap();
+    void shardedMap();
+
+    // mostly lookups with some inserts and removes, from a growing number of threads
+    void concurrentAccessBenchmark_data();
+    void concurrentAccessBenchmark();
+};
+
+#endif // hifi_EntityMapTests_h
@@ -0,0 +1,175 @@
+//
+//  EntitySnapshotTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntitySnapshotTests.h"
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <DependencyManager.h>
+#include <EntityTree.h>
+#include <NodeList.h>
+#include <OctreeDataUtils.h>
+
+QTEST_MAIN(EntitySnapshotTests)
+
+const int NUM_BENCHMARK_ENTITIES = 20000;
+
+static EntityTreePointer createTree() {
+    auto tree = std::make_shared<EntityTree>(true);
+    tree->createRootElement();
+    return tree;
+}
+
+static EntityItemProperties boxProperties(int index) {
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setName(QString("box %1").arg(index));
+    properties.setPosition(glm::vec3((float)(index % 100), (float)(index / 100 % 100), (float)(index / 10000)));
+    properties.setDimensions(glm::vec3(0.5f));
+    properties.setUserData(QString("{\"index\":%1}").arg(index));
+    properties.setCreated(1000000 + index);
+    return properties;
+}
+
+// Peak resident set size since the last call, in KB, or -1 where it can't be measured.
+static qint64 takePeakRSS() {
+#ifdef Q_OS_LINUX
+    qint64 peak = -1;
+    QFile status("/proc/self/status");
+    if (status.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        for (const QByteArray& line : status.readAll().split('\n')) {
+            if (line.startsWith("VmHWM:")) {
+                peak = line.mid(6).trimmed().split(' ').first().toLongLong();
+            }
+        }
+    }
+    QFile clearRefs("/proc/self/clear_refs");
+    if (clearRefs.open(QIODevice::WriteOnly)) {
+        clearRefs.write("5"); // resets the peak to the current RSS
+    }
+    return peak;
+#else
+    return -1;
+#endif
+}
+
+void EntitySnapshotTests::initTestCase() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>(false, [&]{ return QString("Mozilla/5.0 (OverteEntitySnapshotTests)"); });
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::EntityServer);
+
+    QVERIFY(_directory.isValid());
+    _jsonFilename = _directory.filePath("benchmark.json.gz");
+    _snapshotFilename = _directory.filePath("benchmark.bin");
+
+    auto tree = createTree();
+    tree->withWriteLock([&] {
+        for (int i = 0; i < NUM_BENCHMARK_ENTITIES; ++i) {
+            QUuid id = QUuid::createUuid();
+            QVERIFY(tree->addEntity(id, boxProperties(i)));
+            _entityIDs << id;
+        }
+    });
+    QVERIFY(tree->writeToFile(_jsonFilename.toLocal8Bit().constData(), nullptr, "json.gz"));
+    QVERIFY(tree->writeToFile(_snapshotFilename.toLocal8Bit().constData(), nullptr, "bin"));
+    qDebug() << NUM_BENCHMARK_ENTITIES << "entities:" << QFileInfo(_jsonFilename).size() << "bytes as json.gz,"
+             << QFileInfo(_snapshotFilename).size() << "bytes as snapshot";
+}
+
+void EntitySnapshotTests::cleanupTestCase() {
+    DependencyManager::destroy<NodeList>();
+    DependencyManager::destroy<AddressManager>();
+    DependencyManager::destroy<AccountManager>();
+}
+
+void EntitySnapshotTests::roundTrip() {
+    auto tree = createTree();
+    bool success = false;
+    tree->withWriteLock([&] { success = tree->readFromSnapshotFile(_snapshotFilename); });
+    QVERIFY(success);
+
+    for (int i = 0; i < _entityIDs.size(); i += 997) {
+        auto expected = boxProperties(i);
+        auto entity = tree->findEntityByID(_entityIDs[i]);
+        QVERIFY(entity);
+        QCOMPARE(entity->getType(), EntityTypes::Box);
+        QCOMPARE(entity->getName(), expected.getName());
+        QCOMPARE(entity->getUserData(), expected.getUserData());
+        QCOMPARE(entity->getWorldPosition(), expected.getPosition());
+        QCOMPARE(entity->getCreated(), expected.getCreated());
+    }
+}
+
+void EntitySnapshotTests::oversizedEntityRoundTrip() {
+    // strings over 64KB don't fit an edit packet, so this entity is stored as JSON
+    QString userData = QString("{\"data\":\"%1\"}").arg(QString(100000, 'x'));
+    QUuid id = QUuid::createUuid();
+    QString filename = _directory.filePath("oversized.bin");
+    {
+        auto tree = createTree();
+        auto properties = boxProperties(0);
+        properties.setUserData(userData);
+        tree->withWriteLock([&] { tree->addEntity(id, properties); });
+        QVERIFY(tree->writeToFile(filename.toLocal8Bit().constData(), nullptr, "bin"));
+    }
+
+    auto tree = createTree();
+    bool success = false;
+    tree->withWriteLock([&] { success = tree->readFromSnapshotFile(filename); });
+    QVERIFY(success);
+    auto entity = tree->findEntityByID(id);
+    QVERIFY(entity);
+    QCOMPARE(entity->getUserData(), userData);
+    QCOMPARE(entity->getCreated(), boxProperties(0).getCreated());
+}
+
+void EntitySnapshotTests::rejectsOtherVersions() {
+    QFile original(_snapshotFilename);
+    QVERIFY(original.open(QIODevice::ReadOnly));
+    QByteArray data = original.readAll();
+
+    OctreeUtils::SnapshotHeader header;
+    QVERIFY(OctreeUtils::readSnapshotHeader(reinterpret_cast<const uchar*>(data.constData()), data.size(), header));
+    header.recordPacketVersion -= 1;
+    data.replace(0, sizeof(header), QByteArray(reinterpret_cast<const char*>(&header), sizeof(header)));
+
+    QString filename = _directory.filePath("old.bin");
+    QFile old(filename);
+    QVERIFY(old.open(QIODevice::WriteOnly));
+    old.write(data);
+    old.close();
+
+    auto tree = createTree();
+    bool success = true;
+    tree->withWriteLock([&] { success = tree->readFromSnapshotFile(filename); });
+    QVERIFY(!success);
+    QVERIFY(!tree->findEntityByID(_entityIDs.first()));
+}
+
+void EntitySnapshotTests::loadSnapshotBenchmark() {
+    takePeakRSS();
+    qint64 baseline = takePeakRSS();
+    QBENCHMARK {
+        auto tree = createTree();
+        tree->withWriteLock([&] { tree->readFromSnapshotFile(_snapshotFilename); });
+    }
+    qDebug() << "Peak RSS growth loading the snapshot:" << takePeakRSS() - baseline << "KB";
+}
+
+void EntitySnapshotTests::loadJSONBenchmark() {
+    takePeakRSS();
+    qint64 baseline = takePeakRSS();
+    QBENCHMARK {
+        auto tree = createTree();
+        tree->withWriteLock([&] { tree->readJSONFromGzippedFile(_jsonFilename); });
+    }
+    qDebug() << "Peak RSS growth loading json.gz:" << takePeakRSS() - baseline << "KB";
+}
@@ -0,0 +1,41 @@
+//
+//  EntitySnapshotTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntitySnapshotTests_h
+#define hifi_EntitySnapshotTests_h
+
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QUuid>
+#include <QtCore/QVector>
+#include <QtTest/QtTest>
+
+class EntitySnapshotTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void roundTrip();
+    void oversizedEntityRoundTrip();
+    void rejectsOtherVersions();
+
+    // load time and peak RSS of the same content as json.gz and as a binary snapshot
+    void loadSnapshotBenchmark();
+    void loadJSONBenchmark();
+
+private:
+    QTemporaryDir _directory;
+    QVector<QUuid> _entityIDs;
+    QString _jsonFilename;
+    QString _snapshotFilename;
+};
+
+#endif // hifi_EntitySnapshotTests_h
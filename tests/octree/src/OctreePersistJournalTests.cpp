@@ -0,0 +1,181 @@
+//
+//  OctreePersistJournalTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreePersistJournalTests.h"
+
+#include <QtCore/QTemporaryDir>
+
+#include <OctreeDataUtils.h>
+#include <OctreePersistJournal.h>
+
+QTEST_MAIN(OctreePersistJournalTests)
+
+static QVariantMap entityProperties(const QUuid& id, const QString& name) {
+    QVariantMap properties;
+    properties["id"] = id.toString();
+    properties["type"] = "Box";
+    properties["name"] = name;
+    return properties;
+}
+
+static QHash<QUuid, QString> readEntityNames(const QString& persistFilename, OctreeUtils::RawEntityData& data) {
+    QHash<QUuid, QString> names;
+    if (data.readOctreeDataInfoFromFile(persistFilename)) {
+        for (const auto& entity : data.variantEntityData) {
+            auto map = entity.toMap();
+            names[QUuid(map["id"].toString())] = map["name"].toString();
+        }
+    }
+    return names;
+}
+
+void OctreePersistJournalTests::changeTracking() {
+    QTemporaryDir directory;
+    OctreePersistJournal journal(directory.filePath("models.json.gz"));
+
+    QUuid added = QUuid::createUuid();
+    QUuid edited = QUuid::createUuid();
+    QUuid addedThenDeleted = QUuid::createUuid();
+
+    journal.entityAdded(added);
+    journal.entityEdited(added);
+    journal.entityEdited(edited);
+    journal.entityAdded(addedThenDeleted);
+    journal.entityDeleted(addedThenDeleted);
+
+    auto changes = journal.takeChanges();
+    QCOMPARE(changes.added, QVector<QUuid>({ added }));
+    QCOMPARE(changes.edited, QVector<QUuid>({ edited }));
+    QCOMPARE(changes.deleted, QVector<QUuid>({ addedThenDeleted }));
+    QVERIFY(journal.takeChanges().isEmpty());
+
+    // restoring doesn't override what happened since
+    journal.entityDeleted(edited);
+    journal.restoreChanges(changes);
+    auto restored = journal.takeChanges();
+    QCOMPARE(restored.added, QVector<QUuid>({ added }));
+    QCOMPARE(restored.deleted.size(), 2);
+    QVERIFY(restored.edited.isEmpty());
+}
+
+void OctreePersistJournalTests::compactIntoEmptyFile() {
+    QTemporaryDir directory;
+    QString persistFilename = directory.filePath("models.json.gz");
+    QUuid dataID = QUuid::createUuid();
+    QUuid first = QUuid::createUuid();
+    QUuid second = QUuid::createUuid();
+
+    {
+        OctreePersistJournal journal(persistFilename);
+        journal.entityAdded(first);
+        journal.entityAdded(second);
+        auto changes = journal.takeChanges();
+        QVariantList entities;
+        for (const auto& id : changes.getChangedIDs()) {
+            entities << entityProperties(id, "v1");
+        }
+        QVERIFY(journal.append(dataID, 1, changes, entities) > 0);
+
+        journal.entityEdited(first);
+        journal.entityDeleted(second);
+        changes = journal.takeChanges();
+        QVERIFY(journal.append(dataID, 2, changes, { entityProperties(first, "v2") }) > 0);
+    }
+
+    auto segments = OctreePersistJournal::findSegments(persistFilename);
+    QCOMPARE(segments.size(), 1);
+    QVERIFY(OctreePersistJournal::compact(persistFilename, segments));
+    QVERIFY(OctreePersistJournal::findSegments(persistFilename).isEmpty());
+
+    OctreeUtils::RawEntityData data;
+    auto names = readEntityNames(persistFilename, data);
+    QCOMPARE(names.size(), 1);
+    QCOMPARE(names.value(first), QString("v2"));
+    QCOMPARE(data.id, dataID);
+    QCOMPARE(data.dataVersion, (OctreeUtils::Version)2);
+}
+
+void OctreePersistJournalTests::compactIntoExistingFile() {
+    QTemporaryDir directory;
+    QString persistFilename = directory.filePath("models.json.gz");
+    QUuid dataID = QUuid::createUuid();
+    QUuid kept = QUuid::createUuid();
+    QUuid edited = QUuid::createUuid();
+    QUuid deleted = QUuid::createUuid();
+    QUuid added = QUuid::createUuid();
+
+    OctreeUtils::RawEntityData snapshot;
+    snapshot.id = dataID;
+    snapshot.dataVersion = 10;
+    snapshot.version = 1;
+    snapshot.variantEntityData << entityProperties(kept, "kept") << entityProperties(edited, "old")
+                               << entityProperties(deleted, "deleted");
+    QFile file(persistFilename);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write(snapshot.toGzippedByteArray());
+    file.close();
+
+    // two segments, as left behind by a compaction that started a new one
+    OctreePersistJournal journal(persistFilename);
+    journal.entityEdited(edited);
+    journal.entityDeleted(deleted);
+    auto changes = journal.takeChanges();
+    QVERIFY(journal.append(dataID, 11, changes, { entityProperties(edited, "new") }) > 0);
+    journal.startCompaction();
+    journal.waitForCompaction();
+    QCOMPARE(journal.getNumCompactions(), 1);
+    QVERIFY(journal.takeCompactionCompleted());
+
+    journal.entityAdded(added);
+    changes = journal.takeChanges();
+    QVERIFY(journal.append(dataID, 12, changes, { entityProperties(added, "added") }) > 0);
+    journal.startCompaction();
+    journal.waitForCompaction();
+
+    OctreeUtils::RawEntityData data;
+    auto names = readEntityNames(persistFilename, data);
+    QCOMPARE(names.size(), 3);
+    QCOMPARE(names.value(kept), QString("kept"));
+    QCOMPARE(names.value(edited), QString("new"));
+    QCOMPARE(names.value(added), QString("added"));
+    QVERIFY(!names.contains(deleted));
+    QCOMPARE(data.dataVersion, (OctreeUtils::Version)12);
+    QCOMPARE(data.version, (OctreeUtils::Version)1);
+}
+
+void OctreePersistJournalTests::truncatedBatchIsIgnored() {
+    QTemporaryDir directory;
+    QString persistFilename = directory.filePath("models.json.gz");
+    QUuid dataID = QUuid::createUuid();
+    QUuid first = QUuid::createUuid();
+    QUuid second = QUuid::createUuid();
+
+    {
+        OctreePersistJournal journal(persistFilename);
+        journal.entityAdded(first);
+        QVERIFY(journal.append(dataID, 1, journal.takeChanges(), { entityProperties(first, "first") }) > 0);
+        journal.entityAdded(second);
+        QVERIFY(journal.append(dataID, 2, journal.takeChanges(), { entityProperties(second, "second") }) > 0);
+    }
+
+    // simulate a crash in the middle of writing the second batch
+    auto segments = OctreePersistJournal::findSegments(persistFilename);
+    QCOMPARE(segments.size(), 1);
+    QFile segment(segments.first());
+    QVERIFY(segment.resize(segment.size() - 4));
+
+    QVERIFY(OctreePersistJournal::compact(persistFilename, segments));
+
+    OctreeUtils::RawEntityData data;
+    auto names = readEntityNames(persistFilename, data);
+    QCOMPARE(names.size(), 1);
+    QVERIFY(names.contains(first));
+    QCOMPARE(data.dataVersion, (OctreeUtils::Version)1);
+}
@@ -0,0 +1,26 @@
+//
+//  OctreePersistJournalTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreePersistJournalTests_h
+#define hifi_OctreePersistJournalTests_h
+
+#include <QtTest/QtTest>
+
+class OctreePersistJournalTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void changeTracking();
+    void compactIntoEmptyFile();
+    void compactIntoExistingFile();
+    void truncatedBatchIsIgnored();
+};
+
+#endif // hifi_OctreePersistJournalTests_h
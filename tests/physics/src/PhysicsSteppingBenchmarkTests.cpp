@@ -0,0 +1,123 @@
+//
+//  PhysicsSteppingBenchmarkTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsSteppingBenchmarkTests.h"
+
+#include <memory>
+#include <vector>
+
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <btBulletDynamicsCommon.h>
+
+#include <ThreadSafeDynamicsWorld.h>
+
+QTEST_MAIN(PhysicsSteppingBenchmarkTests)
+
+const int NUM_COLUMNS_PER_SIDE = 16;
+const int NUM_BOXES_PER_COLUMN = 16;
+const float BOX_HALF_EXTENT = 0.5f;
+const float COLUMN_SPACING = 3.0f * BOX_HALF_EXTENT;
+const btScalar FIXED_TIMESTEP = 1.0f / 60.0f;
+const int NUM_SETTLING_STEPS = 30;
+const int NUM_BENCHMARK_STEPS = 60;
+
+void PhysicsSteppingBenchmarkTests::benchmarkStepStackedBoxes_data() {
+    QTest::addColumn<int>("numThreads");
+
+    for (int numThreads : { 1, 2, 4, 8 }) {
+        QTest::newRow(QString("%1 threads").arg(numThreads).toLatin1().data()) << numThreads;
+    }
+}
+
+void PhysicsSteppingBenchmarkTests::benchmarkStepStackedBoxes() {
+    QFETCH(int, numThreads);
+
+    // same setup as PhysicsEngine::init()
+    bool multithreaded = numThreads > 1 && ThreadSafeDynamicsWorld::setNumTaskSchedulerThreads(numThreads);
+    if (numThreads > 1 && !multithreaded) {
+        QSKIP("Bullet was built without multithreading support");
+    }
+
+    btDefaultCollisionConfiguration collisionConfig;
+    std::unique_ptr<btCollisionDispatcher> dispatcher;
+    std::unique_ptr<btSequentialImpulseConstraintSolver> solver;
+    if (multithreaded) {
+        dispatcher.reset(new btCollisionDispatcherMt(&collisionConfig));
+        solver.reset(new btSequentialImpulseConstraintSolverMt());
+    } else {
+        dispatcher.reset(new btCollisionDispatcher(&collisionConfig));
+        solver.reset(new btSequentialImpulseConstraintSolver());
+    }
+    btDbvtBroadphase broadphase;
+    ThreadSafeDynamicsWorld world(dispatcher.get(), &broadphase, solver.get(), &collisionConfig);
+    world.setMultithreaded(multithreaded);
+    world.setGravity(btVector3(0.0f, -9.8f, 0.0f));
+
+    const float groundHalfExtent = NUM_COLUMNS_PER_SIDE * COLUMN_SPACING;
+    btBoxShape groundShape(btVector3(groundHalfExtent, BOX_HALF_EXTENT, groundHalfExtent));
+    btBoxShape boxShape(btVector3(BOX_HALF_EXTENT, BOX_HALF_EXTENT, BOX_HALF_EXTENT));
+
+    std::vector<std::unique_ptr<btRigidBody>> bodies;
+    btTransform transform;
+    transform.setIdentity();
+    transform.setOrigin(btVector3(0.0f, -BOX_HALF_EXTENT, 0.0f));
+    bodies.emplace_back(new btRigidBody(0.0f, nullptr, &groundShape));
+    bodies.back()->setWorldTransform(transform);
+    world.addRigidBody(bodies.back().get());
+
+    const btScalar mass = 1.0f;
+    btVector3 inertia;
+    boxShape.calculateLocalInertia(mass, inertia);
+    const float offset = -0.5f * (NUM_COLUMNS_PER_SIDE - 1) * COLUMN_SPACING;
+    for (int i = 0; i < NUM_COLUMNS_PER_SIDE; ++i) {
+        for (int j = 0; j < NUM_COLUMNS_PER_SIDE; ++j) {
+            for (int k = 0; k < NUM_BOXES_PER_COLUMN; ++k) {
+                // leave a small gap so that every box lands on the one below
+                transform.setOrigin(btVector3(offset + i * COLUMN_SPACING, (2.0f * k + 1.05f) * BOX_HALF_EXTENT,
+                                              offset + j * COLUMN_SPACING));
+                btRigidBody::btRigidBodyConstructionInfo info(mass, nullptr, &boxShape, inertia);
+                info.m_startWorldTransform = transform;
+                bodies.emplace_back(new btRigidBody(info));
+                world.addRigidBody(bodies.back().get());
+            }
+        }
+    }
+
+    for (int i = 0; i < NUM_SETTLING_STEPS; ++i) {
+        world.stepSimulationWithSubstepCallback(FIXED_TIMESTEP, 1, FIXED_TIMESTEP);
+    }
+
+    QElapsedTimer timer;
+    qint64 elapsed = 0;
+    int numSteps = 0;
+    QBENCHMARK {
+        timer.start();
+        for (int i = 0; i < NUM_BENCHMARK_STEPS; ++i) {
+            world.stepSimulationWithSubstepCallback(FIXED_TIMESTEP, 1, FIXED_TIMESTEP);
+        }
+        elapsed += timer.nsecsElapsed();
+        numSteps += NUM_BENCHMARK_STEPS;
+    }
+    qInfo() << numThreads << "threads," << (bodies.size() - 1) << "boxes:"
+            << (double)elapsed / (1000.0 * numSteps) << "usec per step";
+
+    // the stacks must still stand on the ground
+    for (size_t i = 1; i < bodies.size(); ++i) {
+        QVERIFY(bodies[i]->getWorldTransform().getOrigin().getY() > 0.0f);
+    }
+
+    for (auto& body : bodies) {
+        world.removeRigidBody(body.get());
+    }
+    if (multithreaded) {
+        ThreadSafeDynamicsWorld::setNumTaskSchedulerThreads(1);
+    }
+}
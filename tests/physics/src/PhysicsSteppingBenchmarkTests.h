@@ -0,0 +1,25 @@
+//
+//  PhysicsSteppingBenchmarkTests.h
+//  tests/physics/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PhysicsSteppingBenchmarkTests_h
+#define hifi_PhysicsSteppingBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+// Steps columns of stacked boxes with the single threaded and the multithreaded ThreadSafeDynamicsWorld.
+class PhysicsSteppingBenchmarkTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void benchmarkStepStackedBoxes_data();
+    void benchmarkStepStackedBoxes();
+};
+
+#endif // hifi_PhysicsSteppingBenchmarkTests_h
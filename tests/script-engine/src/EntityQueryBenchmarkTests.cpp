@@ -0,0 +1,147 @@
+//
+//  EntityQueryBenchmarkTests.cpp
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "EntityQueryBenchmarkTests.h"
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <DependencyManager.h>
+#include <EntityScriptingInterface.h>
+#include <NodeList.h>
+
+#include "ScriptCache.h"
+#include "ScriptEngine.h"
+#include "ScriptEngines.h"
+#include "StatTracker.h"
+
+QTEST_MAIN(EntityQueryBenchmarkTests)
+
+const int NUM_ENTITIES = 10000;
+
+static glm::vec3 boxPosition(int index) {
+    return glm::vec3((float)(index % 100), (float)(index / 100 % 100), 1.0f);
+}
+
+void EntityQueryBenchmarkTests::initTestCase() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>(false, [&]{ return QString("Mozilla/5.0 (OverteEntityQueryBenchmarkTests)"); });
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent);
+    DependencyManager::set<ScriptEngines>(ScriptManager::NETWORKLESS_TEST_SCRIPT, QUrl(""));
+    DependencyManager::set<ScriptCache>();
+    DependencyManager::set<StatTracker>();
+    DependencyManager::set<ScriptInitializers>();
+    DependencyManager::set<EntityScriptingInterface>(false);
+
+    _tree = std::make_shared<EntityTree>(true);
+    _tree->createRootElement();
+    _tree->withWriteLock([&] {
+        for (int i = 0; i < NUM_ENTITIES; ++i) {
+            EntityItemProperties properties;
+            properties.setType(EntityTypes::Box);
+            properties.setName(QString("box %1").arg(i));
+            properties.setPosition(boxPosition(i));
+            properties.setDimensions(glm::vec3(0.5f));
+            QUuid entityID = QUuid::createUuid();
+            QVERIFY(_tree->addEntity(entityID, properties));
+            _entityIDs.append(entityID);
+        }
+    });
+    DependencyManager::get<EntityScriptingInterface>()->setEntityTree(_tree);
+
+    _manager = newScriptManager(ScriptManager::NETWORKLESS_TEST_SCRIPT, "", "testEntityQuery.js");
+}
+
+void EntityQueryBenchmarkTests::queryEntityProperties() {
+    auto engine = _manager->engine();
+    auto scopeGuard = engine->getScopeGuard();
+    auto entities = DependencyManager::get<EntityScriptingInterface>();
+
+    QVector<QUuid> entityIDs { _entityIDs[0], QUuid::createUuid(), _entityIDs[NUM_ENTITIES - 1] };
+    ScriptValue properties = engine->newArray(3);
+    properties.setProperty(0, "name");
+    properties.setProperty(1, "position");
+    properties.setProperty(2, "notAColumn");
+
+    ScriptValue result = entities->queryEntityPropertiesInternal(engine.get(), entityIDs, properties);
+
+    // the unknown entity is left out
+    QCOMPARE(result.property("id").property("length").toInt32(), 2);
+    QCOMPARE(QUuid(result.property("id").property(1).toString()), _entityIDs[NUM_ENTITIES - 1]);
+    QCOMPARE(result.property("name").property(0).toString(), QString("box 0"));
+    QCOMPARE(result.property("name").property(1).toString(), QString("box %1").arg(NUM_ENTITIES - 1));
+
+    // positions are packed 3 floats per entity
+    ScriptValue positions = result.property("position");
+    QCOMPARE(positions.property("length").toInt32(), 6);
+    glm::vec3 expected = boxPosition(NUM_ENTITIES - 1);
+    QCOMPARE((float)positions.property(3).toNumber(), expected.x);
+    QCOMPARE((float)positions.property(4).toNumber(), expected.y);
+    QCOMPARE((float)positions.property(5).toNumber(), expected.z);
+
+    // properties that weren't asked for aren't returned
+    QVERIFY(result.property("rotation").isUndefined());
+    QVERIFY(result.property("notAColumn").isUndefined());
+}
+
+void EntityQueryBenchmarkTests::benchmarkGetEntityProperties() {
+    auto engine = _manager->engine();
+    auto scopeGuard = engine->getScopeGuard();
+    auto entities = DependencyManager::get<EntityScriptingInterface>();
+
+    ScriptValue properties = engine->newArray(2);
+    properties.setProperty(0, "name");
+    properties.setProperty(1, "position");
+
+    QBENCHMARK {
+        for (const auto& entityID : _entityIDs) {
+            entities->getEntityProperties(entityID, properties);
+        }
+    }
+}
+
+void EntityQueryBenchmarkTests::benchmarkGetMultipleEntityProperties() {
+    auto engine = _manager->engine();
+    auto scopeGuard = engine->getScopeGuard();
+    auto entities = DependencyManager::get<EntityScriptingInterface>();
+
+    ScriptValue properties = engine->newArray(2);
+    properties.setProperty(0, "name");
+    properties.setProperty(1, "position");
+
+    QBENCHMARK {
+        entities->getMultipleEntityPropertiesInternal(engine.get(), _entityIDs, properties);
+    }
+}
+
+void EntityQueryBenchmarkTests::benchmarkQueryEntityProperties() {
+    auto engine = _manager->engine();
+    auto scopeGuard = engine->getScopeGuard();
+    auto entities = DependencyManager::get<EntityScriptingInterface>();
+
+    ScriptValue properties = engine->newArray(2);
+    properties.setProperty(0, "name");
+    properties.setProperty(1, "position");
+
+    QBENCHMARK {
+        entities->queryEntityPropertiesInternal(engine.get(), _entityIDs, properties);
+    }
+}
+
+void EntityQueryBenchmarkTests::cleanupTestCase() {
+    _manager.reset();
+    DependencyManager::get<EntityScriptingInterface>()->setEntityTree(nullptr);
+    _tree.reset();
+    DependencyManager::destroy<EntityScriptingInterface>();
+    DependencyManager::destroy<NodeList>();
+    DependencyManager::destroy<AddressManager>();
+    DependencyManager::destroy<AccountManager>();
+}
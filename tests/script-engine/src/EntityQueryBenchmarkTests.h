@@ -0,0 +1,37 @@
+//
+//  EntityQueryBenchmarkTests.h
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+#include <EntityTree.h>
+#include "ScriptManager.h"
+
+using ScriptManagerPointer = std::shared_ptr<ScriptManager>;
+
+// Compares scanning many entities with Entities.queryEntityProperties against getEntityProperties per entity and
+// getMultipleEntityProperties.
+class EntityQueryBenchmarkTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void queryEntityProperties();
+    void benchmarkGetEntityProperties();
+    void benchmarkGetMultipleEntityProperties();
+    void benchmarkQueryEntityProperties();
+    void cleanupTestCase();
+
+private:
+    EntityTreePointer _tree;
+    QVector<QUuid> _entityIDs;
+    ScriptManagerPointer _manager;
+};
@@ -205,3 +205,42 @@ void ScriptEngineBenchmarkTests::benchmarkSimpleScript() {
     }
 
 }
+
+void ScriptEngineBenchmarkTests::benchmarkNativeCall_data() {
+    QTest::addColumn<QString>("call");
+
+    // Vec3.sum, Quat.multiply and Quat.getForward have typed bindings, Vec3.multiply is overloaded on the argument count
+    // it's called with and Uuid.isNull has no binding, so those two go through the generic QMetaMethod dispatch
+    QTest::newRow("Vec3.sum") << "Vec3.sum(v, v)";
+    QTest::newRow("Vec3.multiply") << "Vec3.multiply(v, 2)";
+    QTest::newRow("Quat.multiply") << "Quat.multiply(q, q)";
+    QTest::newRow("Quat.getForward") << "Quat.getForward(q)";
+    QTest::newRow("Uuid.isNull") << "Uuid.isNull(id)";
+}
+
+void ScriptEngineBenchmarkTests::benchmarkNativeCall() {
+    QFETCH(QString, call);
+
+    // each iteration includes starting the script manager, see benchmarkSimpleScript, the script itself reports the time
+    // per call
+    const int NUM_CALLS = 100000;
+    QString source = QString(
+        "var v = { x: 1, y: 2, z: 3 }; var q = { x: 0, y: 0.7071, z: 0, w: 0.7071 }; var id = Uuid.NONE;"
+        "var start = Date.now();"
+        "for (var i = 0; i < %1; i++) { %2; }"
+        "print((Date.now() - start) * 1000 / %1);"
+        "Script.stop(true);").arg(NUM_CALLS).arg(call);
+
+    QString printed;
+    QBENCHMARK {
+        auto sm = makeManager(source, "testNativeCall.js");
+        connect(sm.get(), &ScriptManager::printedMessage, [&printed](const QString& message, const QString& engineName){
+            printed = message;
+        });
+
+        sm->run();
+    }
+
+    QVERIFY(!printed.isEmpty());
+    qInfo() << call << "took" << printed << "us per call";
+}
@@ -29,6 +29,8 @@ private slots:
     void benchmarkSetProperty16K();
     void benchmarkQueryProperty();
     void benchmarkSimpleScript();
+    void benchmarkNativeCall_data();
+    void benchmarkNativeCall();
 
 private:
     ScriptManagerPointer makeManager(const QString &source, const QString &filename);
@@ -10,6 +10,10 @@
 
 #include "FileCacheTests.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <shared/FileCache.h>
 
 QTEST_GUILESS_MAIN(FileCacheTests)
@@ -40,6 +44,20 @@ FileCachePointer makeFileCache(QString location) {
     return result;
 }
 
+// Without the free space requirement, so that only the max size decides what is ejected
+static FileCachePointer makeIsolatedFileCache(QString location, bool usePersistentIndex) {
+    auto result = std::make_shared<FileCache>(location.toStdString(), "tmp");
+    result->setPersistentIndex(usePersistentIndex);
+    result->setMinFreeSize(0);
+    result->initialize();
+    result->setMaxSize(MAX_UNUSED_SIZE);
+    return result;
+}
+
+static size_t countCachedFiles(const QString& location) {
+    return QDir(location).entryList({ "*.tmp" }, QDir::Files).size();
+}
+
 void FileCacheTests::initTestCase() {
 }
 
@@ -161,6 +179,207 @@ void FileCacheTests::testWipe() {
     QCOMPARE(getCacheDirectorySize(), (size_t)0);
 }
 
+void FileCacheTests::testEjectionScoring() {
+    const QString location = _testDir.filePath("scoring");
+    auto cache = makeIsolatedFileCache(location, false);
+    const QByteArray SMALL_DATA { 1024, '1' };
+
+    {
+        auto smallFile = cache->writeFile(SMALL_DATA.data(), FileCache::Metadata("small", SMALL_DATA.size()));
+        auto bigFile = cache->writeFile(TEST_DATA.data(), FileCache::Metadata("big", TEST_DATA.size()));
+        QVERIFY(smallFile && bigFile);
+
+        // The small file has been left unused for longer, which alone would make it the first to go
+        int64_t now = QDateTime::currentMSecsSinceEpoch();
+        smallFile->_modified = now - 10000;
+        bigFile->_modified = now - 5000;
+    }
+    QCOMPARE(cache->getNumCachedFiles(), (size_t)2);
+
+    // Over budget by the size of the small file, which ejecting either file fixes
+    cache->setMaxSize(TEST_DATA.size());
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)1);
+    QVERIFY(cache->getFile("small"));
+    QVERIFY(!cache->getFile("big"));
+    QCOMPARE(countCachedFiles(location), (size_t)1);
+}
+
+void FileCacheTests::testPersistentIndex() {
+    const QString location = _testDir.filePath("index");
+    const QString indexFilepath = location + "/index";
+    const QByteArray DATA { 1024, 'i' };
+    const int NUM_FILES = 10;
+
+    {
+        auto cache = makeIsolatedFileCache(location, true);
+        int64_t start = QDateTime::currentMSecsSinceEpoch() - 60000;
+        for (int i = 0; i < NUM_FILES; ++i) {
+            auto file = cache->writeFile(DATA.data(), FileCache::Metadata(getFileKey(i), DATA.size()));
+            QVERIFY(file);
+            file->_modified = start + i * 1000;
+        }
+        QCOMPARE(cache->getNumCachedFiles(), (size_t)NUM_FILES);
+        QVERIFY(!QFile::exists(indexFilepath));
+    }
+    QVERIFY(QFile::exists(indexFilepath));
+
+    // Removed behind the cache's back
+    QVERIFY(QFile::remove(location + "/" + getFileKey(5).c_str() + ".tmp"));
+
+    auto cache = makeIsolatedFileCache(location, true);
+    QVERIFY(!QFile::exists(indexFilepath));
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)NUM_FILES);
+    QCOMPARE(cache->getNumCachedFiles(), (size_t)NUM_FILES);
+
+    QVERIFY(!cache->getFile(getFileKey(5)));
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)NUM_FILES - 1);
+
+    // The access times came back with the index, so the files used longest ago are ejected first. Once over budget, the
+    // cache is ejected down to 90% of it, which takes a second file
+    cache->setMaxSize(DATA.size() * (NUM_FILES - 2));
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)NUM_FILES - 3);
+    QVERIFY(!cache->getFile(getFileKey(0)));
+    QVERIFY(!cache->getFile(getFileKey(1)));
+    for (int i = 2; i < NUM_FILES; ++i) {
+        if (i != 5) {
+            QVERIFY(cache->getFile(getFileKey(i)));
+        }
+    }
+    QCOMPARE(countCachedFiles(location), (size_t)NUM_FILES - 3);
+
+    // Without the index, the same files are found by scanning the directory
+    cache.reset();
+    QVERIFY(QFile::remove(indexFilepath));
+    cache = makeIsolatedFileCache(location, true);
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)NUM_FILES - 3);
+
+    // A file still in use when the cache is destroyed is listed by the index, so it stays on the disk
+    auto heldFile = cache->writeFile(DATA.data(), FileCache::Metadata("held", DATA.size()));
+    QVERIFY(heldFile);
+    cache.reset();
+    heldFile.reset();
+    QVERIFY(QFile::exists(location + "/held.tmp"));
+
+    cache = makeIsolatedFileCache(location, true);
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)NUM_FILES - 2);
+    QCOMPARE(cache->getSizeTotalFiles(), (size_t)(DATA.size() * (NUM_FILES - 2)));
+    QVERIFY(cache->getFile("held"));
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)NUM_FILES - 2);
+    QCOMPARE(countCachedFiles(location), (size_t)NUM_FILES - 2);
+}
+
+void FileCacheTests::testConcurrentAccess() {
+    const QString location = _testDir.filePath("concurrent");
+    auto cache = makeIsolatedFileCache(location, false);
+    const QByteArray DATA { 4096, 'c' };
+    const int NUM_THREADS = 8;
+    const int NUM_KEYS = 64;
+    const int NUM_ITERATIONS = 2000;
+    const int NUM_HELD_FILES = 4;
+    std::atomic<int> failures { 0 };
+
+    auto run = [&](int thread) {
+        // Each thread holds on to a few files, so that some are in use while others are released or ejected
+        std::vector<FilePointer> heldFiles(NUM_HELD_FILES);
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            std::string key = getFileKey((thread * 7 + i) % NUM_KEYS);
+            auto file = cache->getFile(key);
+            if (!file) {
+                file = cache->writeFile(DATA.data(), FileCache::Metadata(key, DATA.size()));
+            }
+            if (!file || file->getKey() != key || file->getLength() != (size_t)DATA.size()) {
+                ++failures;
+            }
+            heldFiles[i % NUM_HELD_FILES] = file;
+        }
+    };
+    auto runThreads = [&] {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            threads.emplace_back(run, i);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+
+    runThreads();
+    QCOMPARE(failures.load(), 0);
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)NUM_KEYS);
+    QCOMPARE(cache->getNumCachedFiles(), (size_t)NUM_KEYS);
+    QCOMPARE(cache->getSizeTotalFiles(), (size_t)(NUM_KEYS * DATA.size()));
+    QCOMPARE(countCachedFiles(location), (size_t)NUM_KEYS);
+
+    // Again with only room for a quarter of the files, so that they are ejected and written again concurrently
+    const size_t maxSize = NUM_KEYS / 4 * DATA.size();
+    cache->setMaxSize(maxSize);
+    runThreads();
+    QCOMPARE(failures.load(), 0);
+    QVERIFY(cache->getSizeTotalFiles() <= maxSize);
+    QCOMPARE(cache->getNumCachedFiles(), cache->getNumTotalFiles());
+    QCOMPARE(countCachedFiles(location), cache->getNumTotalFiles());
+}
+
+void FileCacheTests::benchmarkConcurrentHits() {
+    const QString location = _testDir.filePath("hits");
+    auto cache = makeIsolatedFileCache(location, true);
+    const QByteArray DATA { 1024, 'h' };
+    const int NUM_THREADS = 8;
+    const int NUM_KEYS = 256;
+    const int NUM_ITERATIONS = 10000;
+
+    for (int i = 0; i < NUM_KEYS; ++i) {
+        QVERIFY(cache->writeFile(DATA.data(), FileCache::Metadata(getFileKey(i), DATA.size())));
+    }
+
+    std::atomic<int> misses { 0 };
+    QBENCHMARK {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            threads.emplace_back([&, i] {
+                for (int j = 0; j < NUM_ITERATIONS; ++j) {
+                    if (!cache->getFile(getFileKey((i * 31 + j) % NUM_KEYS))) {
+                        ++misses;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    QCOMPARE(misses.load(), 0);
+}
+
+void FileCacheTests::benchmarkStartup_data() {
+    QTest::addColumn<bool>("usePersistentIndex");
+    QTest::newRow("directory") << false;
+    QTest::newRow("index") << true;
+}
+
+void FileCacheTests::benchmarkStartup() {
+    QFETCH(bool, usePersistentIndex);
+    const QString location = _testDir.filePath(usePersistentIndex ? "startup-index" : "startup-directory");
+    const int NUM_FILES = 100000;
+    const QByteArray DATA { 16, 's' };
+
+    QVERIFY(QDir().mkpath(location));
+    for (int i = 0; i < NUM_FILES; ++i) {
+        QFile file(location + "/" + QString("%1.tmp").arg(i, 8, 16, QChar('0')));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QCOMPARE(file.write(DATA), (qint64)DATA.size());
+    }
+
+    // The index is only written on shutdown, so it is there for every startup but the first
+    {
+        auto cache = makeIsolatedFileCache(location, usePersistentIndex);
+    }
+
+    QBENCHMARK {
+        auto cache = makeIsolatedFileCache(location, usePersistentIndex);
+        QCOMPARE(cache->getNumTotalFiles(), (size_t)NUM_FILES);
+    }
+}
 
 void FileCacheTests::cleanupTestCase() {
 }
@@ -21,6 +21,12 @@ private slots:
     void testFreeSpacePreservation();
     void cleanupTestCase();
     void testWipe();
+    void testEjectionScoring();
+    void testPersistentIndex();
+    void testConcurrentAccess();
+    void benchmarkConcurrentHits();
+    void benchmarkStartup_data();
+    void benchmarkStartup();
 
 private:
     size_t getFreeSpace() const;
@@ -0,0 +1,121 @@
+//
+//  EntitySnapshotApp.cpp
+//  tools/entity-snapshot/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntitySnapshotApp.h"
+
+#include <QCommandLineParser>
+#include <QDataStream>
+#include <QFile>
+#include <QUrl>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <DependencyManager.h>
+#include <EntityTree.h>
+#include <NodeList.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+static QString fileTypeOf(const QString& fileName) {
+    for (const QString& extension : { QString("json.gz"), QString("json"), QString("bin") }) {
+        if (fileName.endsWith("." + extension, Qt::CaseInsensitive)) {
+            return extension;
+        }
+    }
+    return QString();
+}
+
+EntitySnapshotApp::EntitySnapshotApp(int argc, char* argv[]) : QCoreApplication(argc, argv) {
+
+    // parse command-line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Overte entity snapshot converter\n"
+        "Converts entity server content between JSON (.json, .json.gz) and binary snapshots (.bin). Snapshots can only be "
+        "read by entity servers of the same version, so keep the JSON for exchanging content.");
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption inputFilenameOption("i", "input file", "models.json.gz");
+    parser.addOption(inputFilenameOption);
+
+    const QCommandLineOption outputFilenameOption("o", "output file", "models.bin");
+    parser.addOption(outputFilenameOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << Qt::endl;
+        parser.showHelp();
+        _returnCode = 1;
+        return;
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        return;
+    }
+
+    QString inputFilename = parser.value(inputFilenameOption);
+    QString outputFilename = parser.value(outputFilenameOption);
+    QString inputType = fileTypeOf(inputFilename);
+    QString outputType = fileTypeOf(outputFilename);
+    if (inputType.isEmpty() || outputType.isEmpty()) {
+        qCritical() << "Input and output files must be .json, .json.gz or .bin";
+        parser.showHelp();
+        _returnCode = 1;
+        return;
+    }
+
+    // adding entities to a tree requires a node list
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>(false, [&]{ return QString("Mozilla/5.0 (OverteEntitySnapshot)"); });
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::EntityServer);
+
+    auto tree = std::make_shared<EntityTree>(true);
+    tree->createRootElement();
+
+    quint64 readStart = usecTimestampNow();
+    bool success = false;
+    tree->withWriteLock([&] {
+        if (inputType == "bin") {
+            success = tree->readFromSnapshotFile(inputFilename);
+        } else if (inputType == "json.gz") {
+            success = tree->readJSONFromGzippedFile(inputFilename);
+        } else {
+            QFile file(inputFilename);
+            if (file.open(QIODevice::ReadOnly)) {
+                QDataStream jsonStream(&file);
+                QUrl relativeURL = QUrl::fromLocalFile(inputFilename).adjusted(QUrl::RemoveFilename);
+                success = tree->readJSONFromStream(file.size(), jsonStream, false, relativeURL);
+            }
+        }
+    });
+    if (!success) {
+        qCritical() << "Failed to read entities from" << inputFilename;
+        _returnCode = 2;
+        return;
+    }
+    quint64 readUsecs = usecTimestampNow() - readStart;
+
+    quint64 writeStart = usecTimestampNow();
+    if (!tree->writeToFile(outputFilename.toLocal8Bit().constData(), nullptr, outputType)) {
+        qCritical() << "Failed to write entities to" << outputFilename;
+        _returnCode = 3;
+        return;
+    }
+    quint64 writeUsecs = usecTimestampNow() - writeStart;
+
+    qInfo() << "Converted" << inputFilename << "to" << outputFilename << "- read in" << readUsecs / USECS_PER_MSEC << "ms,"
+            << "written in" << writeUsecs / USECS_PER_MSEC << "ms";
+}
+
+EntitySnapshotApp::~EntitySnapshotApp() {
+    DependencyManager::destroy<NodeList>();
+    DependencyManager::destroy<AddressManager>();
+    DependencyManager::destroy<AccountManager>();
+}
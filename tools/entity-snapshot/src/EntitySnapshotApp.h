@@ -0,0 +1,30 @@
+//
+//  EntitySnapshotApp.h
+//  tools/entity-snapshot/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Converts entity server content between JSON (.json, .json.gz) and binary snapshots (.bin)
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntitySnapshotApp_h
+#define hifi_EntitySnapshotApp_h
+
+#include <QCoreApplication>
+
+class EntitySnapshotApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    EntitySnapshotApp(int argc, char* argv[]);
+    ~EntitySnapshotApp();
+
+    int getReturnCode() const { return _returnCode; }
+
+private:
+    int _returnCode { 0 };
+};
+
+#endif // hifi_EntitySnapshotApp_h
@@ -17,6 +17,7 @@
 #include <udt/Constants.h>
 #include <udt/Packet.h>
 #include <udt/PacketList.h>
+#include <udt/SendScheduler.h>
 
 #include <LogHandler.h>
 
@@ -56,21 +57,37 @@ const QCommandLineOption MESSAGE_SEED {
 const QCommandLineOption STATS_INTERVAL {
     "stats-interval", "stats output interval (default is 100ms)", "milliseconds"
 };
+const QCommandLineOption SEND_SCHEDULER_THREADS {
+    "send-scheduler-threads", "number of shared send threads (default is 0, one thread per connection)", "threads"
+};
+const QCommandLineOption BATCHED_IO {
+    "batched-io", "read and write datagrams in batches with recvmmsg/sendmmsg where supported (default is off)"
+};
 
 const QStringList CLIENT_STATS_TABLE_HEADERS {
     "Send (Mb/s)", "Est. Max (Mb/s)", "RTT (ms)", "CW (P)", "Period (us)",
-    "Recv ACK", "Procd ACK", "Sent Packets", "Re-sent Packets"
+    "Recv ACK", "Procd ACK", "Sent Packets", "Re-sent Packets", "Write P/s", "Syscalls/P"
 };
 
 const QStringList SERVER_STATS_TABLE_HEADERS {
     "  Mb/s  ", "Recv Mb/s", "Est. Max (Mb/s)", "RTT (ms)", "CW (P)",
-    "Sent ACK", "Duplicates (P)"
+    "Sent ACK", "Duplicates (P)", "Read P/s", "Syscalls/P"
 };
 
 UDTTest::UDTTest(int& argc, char** argv) :
     QCoreApplication(argc, argv)
 {
     parseArguments();
+
+    if (_argumentParser.isSet(SEND_SCHEDULER_THREADS)) {
+        udt::SendScheduler::getInstance().setNumThreads(_argumentParser.value(SEND_SCHEDULER_THREADS).toInt());
+    }
+    qDebug() << "Using" << udt::SendScheduler::getInstance().getNumThreads() << "shared send threads";
+
+    if (_argumentParser.isSet(BATCHED_IO)) {
+        _socket.setBatchedIOEnabled(true);
+    }
+    qDebug() << "Batched datagram I/O is" << (_socket.isBatchedIOEnabled() ? "enabled" : "disabled");
     
     // randomize the seed for packet size randomization
     srand(time(NULL));
@@ -225,7 +242,7 @@ void UDTTest::parseArguments() {
     _argumentParser.addOptions({
         PORT_OPTION, TARGET_OPTION, PACKET_SIZE, MIN_PACKET_SIZE, MAX_PACKET_SIZE,
         MAX_SEND_BYTES, MAX_SEND_PACKETS, UNRELIABLE_PACKETS, ORDERED_PACKETS,
-        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL
+        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL, SEND_SCHEDULER_THREADS, BATCHED_IO
     });
     
     if (!_argumentParser.parse(arguments())) {
@@ -365,6 +382,19 @@ void UDTTest::sampleStats() {
     static const double MS_PER_SECOND = 1000.0;
     static const double PPS_TO_MBPS = udt::MAX_PACKET_SIZE * MEGABITS_PER_BYTE;
 
+    // datagrams moved per second and the socket syscalls each one cost over this interval
+    auto ioStats = _socket.getIOStats();
+    auto datagramsRead = ioStats.datagramsRead - _lastIOStats.datagramsRead;
+    auto readSyscalls = ioStats.readSyscalls - _lastIOStats.readSyscalls;
+    auto datagramsWritten = ioStats.datagramsWritten - _lastIOStats.datagramsWritten;
+    auto writeSyscalls = ioStats.writeSyscalls - _lastIOStats.writeSyscalls;
+    _lastIOStats = ioStats;
+
+    double readPacketsPerSecond = (datagramsRead * MS_PER_SECOND) / _statsInterval;
+    double readSyscallsPerPacket = datagramsRead > 0 ? (double)readSyscalls / datagramsRead : 0.0;
+    double writePacketsPerSecond = (datagramsWritten * MS_PER_SECOND) / _statsInterval;
+    double writeSyscallsPerPacket = datagramsWritten > 0 ? (double)writeSyscalls / datagramsWritten : 0.0;
+
 
     if (!_target.isNull()) {
         if (first) {
@@ -387,7 +417,9 @@ void UDTTest::sampleStats() {
             QString::number(stats.events[udt::ConnectionStats::Stats::ReceivedACK]).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
             QString::number(stats.events[udt::ConnectionStats::Stats::ProcessedACK]).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
             QString::number(stats.sentPackets).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
-            QString::number(stats.retransmittedPackets).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size())
+            QString::number(stats.retransmittedPackets).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
+            QString::number(writePacketsPerSecond, 'f', 0).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size()),
+            QString::number(writeSyscallsPerPacket, 'f', 2).rightJustified(CLIENT_STATS_TABLE_HEADERS[++headerIndex].size())
         };
         
         // output this line of values
@@ -415,7 +447,9 @@ void UDTTest::sampleStats() {
                 QString::number(stats.rtt / USECS_PER_MSEC, 'f', 2).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
                 QString::number(stats.congestionWindowSize).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
                 QString::number(stats.events[udt::ConnectionStats::Stats::SentACK]).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
-                QString::number(stats.events[udt::ConnectionStats::Stats::Duplicate]).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size())
+                QString::number(stats.events[udt::ConnectionStats::Stats::Duplicate]).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
+                QString::number(readPacketsPerSecond, 'f', 0).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size()),
+                QString::number(readSyscallsPerPacket, 'f', 2).rightJustified(SERVER_STATS_TABLE_HEADERS[++headerIndex].size())
             };
             
             // output this line of values
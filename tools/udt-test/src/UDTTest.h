@@ -72,6 +72,7 @@ private:
     int _totalQueuedBytes { 0 }; // keeps track of the number of bytes we have already queued
     
     int _statsInterval { 100 }; // recording interval for stats in milliseconds
+    udt::NetworkSocket::IOStats _lastIOStats; // socket I/O counters at the previous stats sample
 };
 
 #endif // hifi_UDTTest_h